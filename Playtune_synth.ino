@@ -6,6 +6,11 @@
 #include <Audio.h>
 #include "synth_Playtune.h"
 
+#define SD_EXAMPLES 0 // set to 1 for the examples that read a sample bank or a score from an SD card
+#if SD_EXAMPLES
+#include <SD.h>
+#endif
+
 AudioSynthPlaytune pt;
 AudioOutputAnalog audioOut;
 AudioConnection cord1(pt, audioOut);
@@ -16,14 +21,23 @@ void setup() {
   delay(200);
   Serial.print("Begin "); Serial.println(__FILE__);
   AudioMemory(18);
+#if SD_EXAMPLES // play with the sounds in a sample bank made by host/playtune_mkbank, read from an SD card
+  if (SD.begin(BUILTIN_SDCARD)) {
+    File file = SD.open("SOUNDS.BNK");
+    uint32_t size = file.size();
+    void *bank = malloc(size); // (it stays there as long as we use it)
+    if (bank && file.read(bank, size) == (int)size && pt.useBank(bank, size))
+      Serial.println("using the sounds in SOUNDS.BNK");
+    file.close();
+  }
+#endif
 }
 
-void playnote(byte note, byte instr, byte vol, int wait) { // (Uses hidden undocumented stuff!)
-  pt.tune_setinstrument(0, instr);
-  pt.tune_playnote(0, note, vol);
-  pt.tune_playing = true;
+void playnote(byte note, byte instr, byte vol, int wait) { // (through the command queue, so update() can be running)
+  pt.queueInstrument(0, instr);
+  pt.queueNoteOn(0, note, vol);
   delay(wait);
-  pt.tune_stopnote(0);
+  pt.queueNoteOff(0);
   delay(100);
 }
 void show_stats(void) {
@@ -46,9 +60,24 @@ void show_stats(void) {
 
 void loop() {
 
+#if SD_EXAMPLES // stream a score that is too big for flash from an SD card, reading it between audio interrupts
+  static File file;
+  if (SD.begin(BUILTIN_SDCARD) && (file = SD.open("SCORE.BIN"))) {
+    pt.play([](void *context, byte * buffer, int bytes) {
+      return ((File *)context)->read(buffer, bytes);
+    }, &file);
+    while (pt.isPlaying()) {
+      pt.refill();
+      show_stats();
+    }
+    file.close();
+    Serial.print("the score ran dry "); Serial.print(pt.underruns()); Serial.println(" times");
+  }
+#endif
+
 #if 1 // play scores
 #define playscore(s) extern const unsigned char PROGMEM s []; \
-  pt.play(s); \
+  pt.queuePlay(s); \
   while (pt.isPlaying()) show_stats();\
   delay(1000);
 
@@ -69,11 +98,9 @@ void loop() {
       playnote(drum, 0, 127, 1000);
   if (0) for (byte tgens = 1; tgens <= 16; ++tgens) { // try all numbers of channels
       pt.num_tgens_used = tgens; // (this affects the mixer input attenuation)
-      extern const int32_t mixer_amplitude_fractions[MAX_TGENS];
-      pt.amplitude_fraction = mixer_amplitude_fractions[pt.num_tgens_used - 1];
+      pt.queueGain(mixer_amplitude_fractions[pt.num_tgens_used - 1]);
       playnote(60, 0, 127, 100);
     }
-  pt.tune_playing = false;
   delay(1000);
 #endif
 
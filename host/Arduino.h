@@ -0,0 +1,58 @@
+/* Arduino.h
+
+    A host (Linux, Mac, etc.) stand-in for the small part of the Arduino/Teensyduino
+    core that synth_Playtune uses, so the synthesizer can be compiled, run, and profiled
+    on a desktop machine. None of this is used when building for a Teensy.
+
+    Copyright (C) 2026, the Playtune_synth contributors (MIT license; see LICENSE.txt)
+*/
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+// flash memory is just ordinary memory here, as it is on the Teensy ARM processors
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define memcpy_P(dest, src, num) memcpy((dest), (src), (num))
+
+// Teensyduino defines these as macros; templates avoid trouble with the C++ standard headers
+template <class A, class B> inline auto min(A a, B b) {
+  return a < b ? a : b;
+}
+template <class A, class B> inline auto max(A a, B b) {
+  return a > b ? a : b;
+}
+
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(unsigned long msec);
+
+// console debugging output goes to stderr
+class HostSerial {
+  public:
+    void begin(unsigned long) { }
+    void print(const char *s) { fputs(s, stderr); }
+    void print(char c) { fputc(c, stderr); }
+    void print(long n) { fprintf(stderr, "%ld", n); }
+    void print(unsigned long n) { fprintf(stderr, "%lu", n); }
+    void print(int n) { print((long)n); }
+    void print(unsigned int n) { print((unsigned long)n); }
+    void print(double n) { fprintf(stderr, "%.2f", n); }
+    template <class T> void println(T x) { print(x); fputc('\n', stderr); }
+    void println(void) { fputc('\n', stderr); }
+    operator bool() { return true; }
+};
+extern HostSerial Serial;
+
+#endif
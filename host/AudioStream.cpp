@@ -0,0 +1,80 @@
+/* AudioStream.cpp
+
+    The host stand-in for the Teensy Audio Library's block memory pool,
+    plus the few Arduino core functions that the host programs use.
+
+    Copyright (C) 2026, the Playtune_synth contributors (MIT license; see LICENSE.txt)
+*/
+
+#include <time.h>
+#include "AudioStream.h"
+
+HostSerial Serial;
+
+#define DEFAULT_POOL_BLOCKS 8  // used if the program never calls AudioMemory()
+
+static audio_block_t *memory_pool = NULL;
+static unsigned int memory_pool_size = 0;
+int AudioStream::memory_used = 0;
+int AudioStream::memory_used_max = 0;
+
+void AudioStream::initialize_memory(audio_block_t *data, unsigned int num) {
+  memory_pool = data;
+  memory_pool_size = num;
+  for (unsigned int i = 0; i < num; ++i) {
+    data[i].ref_count = 0;
+    data[i].memory_pool_index = i;
+  }
+  memory_used = memory_used_max = 0;
+}
+
+audio_block_t * AudioStream::allocate(void) {
+  if (!memory_pool) {
+    static audio_block_t default_pool[DEFAULT_POOL_BLOCKS];
+    initialize_memory(default_pool, DEFAULT_POOL_BLOCKS);
+  }
+  for (unsigned int i = 0; i < memory_pool_size; ++i) {
+    audio_block_t *block = &memory_pool[i];
+    if (block->ref_count == 0) {
+      block->ref_count = 1;
+      if (++memory_used > memory_used_max) memory_used_max = memory_used;
+      return block;
+    }
+  }
+  return NULL; // out of blocks, just as on the Teensy
+}
+
+void AudioStream::release(audio_block_t *block) {
+  if (block->ref_count > 1) --block->ref_count;
+  else if (block->ref_count == 1) {
+    block->ref_count = 0;
+    --memory_used;
+  }
+}
+
+void AudioStream::transmit(audio_block_t *block, unsigned char index) {
+  // there is nobody to send it to, so hold on to it until the host program looks
+  if (index != 0) return;
+  if (host_output) release(host_output);
+  ++block->ref_count;
+  host_output = block;
+}
+
+static uint64_t host_microseconds(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+unsigned long micros(void) {
+  return (unsigned long)host_microseconds();
+}
+
+unsigned long millis(void) {
+  return (unsigned long)(host_microseconds() / 1000);
+}
+
+void delay(unsigned long msec) {
+  struct timespec ts = { (time_t)(msec / 1000), (long)(msec % 1000) * 1000000 };
+  nanosleep(&ts, NULL);
+}
@@ -0,0 +1,63 @@
+/* AudioStream.h
+
+    A host stand-in for the PJRC Teensy Audio Library's AudioStream base class.
+    It has the same block allocation interface, but there are no connections
+    and no update interrupt: the host program calls update() itself, and then
+    picks up whatever block the object sent to transmit().
+
+    Copyright (C) 2026, the Playtune_synth contributors (MIT license; see LICENSE.txt)
+*/
+
+#ifndef AudioStream_h
+#define AudioStream_h
+
+#include "Arduino.h"
+
+#define AUDIO_BLOCK_SAMPLES  128
+#define AUDIO_SAMPLE_RATE_EXACT 44117.64706 // 48 MHz / 1088, or 96 MHz * 2 / 17 / 256
+#define AUDIO_SAMPLE_RATE AUDIO_SAMPLE_RATE_EXACT
+
+typedef struct audio_block_struct {
+  uint8_t  ref_count;
+  uint8_t  reserved1;
+  uint16_t memory_pool_index;
+  int16_t  data[AUDIO_BLOCK_SAMPLES];
+} audio_block_t;
+
+// the host program calls update() itself, so there is no audio interrupt to hold off
+#define AudioNoInterrupts()
+#define AudioInterrupts()
+
+#define AudioMemory(num) do { \
+  static audio_block_t data[num]; \
+  AudioStream::initialize_memory(data, num); \
+} while (0)
+
+class AudioStream
+{
+  public:
+    AudioStream(unsigned char ninput, audio_block_t **iqueue) : host_output(NULL) { }
+    virtual ~AudioStream() {
+      if (host_output) release(host_output);
+    }
+    static void initialize_memory(audio_block_t *data, unsigned int num);
+    // host only: the block most recently transmitted by this object, or NULL if none
+    const audio_block_t *transmitted(void) const {
+      return host_output;
+    }
+    // host only: forget the transmitted block, so the next update() starts fresh
+    void clearTransmitted(void) {
+      if (host_output) release(host_output);
+      host_output = NULL;
+    }
+    static int memory_used, memory_used_max;
+  protected:
+    static audio_block_t * allocate(void);
+    static void release(audio_block_t * block);
+    void transmit(audio_block_t *block, unsigned char index = 0);
+    virtual void update(void) = 0;
+  private:
+    audio_block_t *host_output;
+};
+
+#endif
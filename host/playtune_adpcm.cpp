@@ -0,0 +1,126 @@
+/* playtune_adpcm.cpp
+
+    Generate synth_Playtune_adpcm.cpp, the IMA-ADPCM compressed versions of the percussion
+    waveforms in synth_Playtune_waves.cpp, which synth_Playtune plays instead of those when
+    COMPRESSED_PERCUSSION is on. See synth_Playtune_adpcm.h for the format.
+
+    For each sample, we try all 16 codes with the same decoder that synth_Playtune uses, and
+    keep the one that comes closest. Each block starts with the step index the previous one
+    ended with, so the decoder doesn't have to adapt all over again. We report how much
+    smaller each waveform got, and the signal-to-noise ratio of the result.
+
+    Run this again, with the host build's "adpcm" target, whenever a percussion waveform is
+    added or changed, and add the new waveform to the list below in the same order as
+    drum_waveforms[] in synth_Playtune.cpp.
+
+    usage: playtune_adpcm output.cpp
+
+    Copyright (C) 2026, the Playtune_synth contributors (MIT license; see LICENSE.txt)
+*/
+
+#include <math.h>
+#include "synth_Playtune.h"
+#include "synth_Playtune_adpcm.h"
+
+#define WAVEFORM(name) extern const int16_t name[];
+#define WAVEFORMS \
+  WAVEFORM(waveform_base_drum_04) WAVEFORM(waveform_snare_drum_1) WAVEFORM(waveform_mid_high_tom) \
+  WAVEFORM(waveform_cymbal_2) WAVEFORM(waveform_hi_bongo) WAVEFORM(waveform_steel_bell_c6)
+WAVEFORMS
+#undef WAVEFORM
+#define WAVEFORM(name) {#name, name},
+static const struct {
+  const char *name;
+  const int16_t *samples;
+} waveforms[] = { WAVEFORMS };
+#undef WAVEFORM
+extern const uint32_t drum_waveform_size[];
+
+// Compress a waveform into data[], and return the number of bytes.
+// Put the decoded samples into decoded[], to see how close they are.
+
+static int compress(const int16_t *samples, int num_samples, uint8_t *data, int16_t *decoded) {
+  struct adpcm_state_t state = {0, 0};
+  int bytes = 0;
+  for (int first = 0; first < num_samples; first += ADPCM_BLOCK_SAMPLES) {
+    uint8_t *block = data + bytes;
+    block[0] = samples[first] & 0xff;
+    block[1] = (samples[first] >> 8) & 0xff;
+    block[2] = state.step_index; // (whatever the last block ended with)
+    block[3] = 0;
+    decoded[first] = adpcm_start_block(&state, block);
+    int block_samples = num_samples - first < ADPCM_BLOCK_SAMPLES ? num_samples - first : ADPCM_BLOCK_SAMPLES;
+    memset(block + ADPCM_HEADER_BYTES, 0, ADPCM_BLOCK_SAMPLES / 2);
+    for (int sample = 1; sample < block_samples; ++sample) {
+      struct adpcm_state_t best_state = state;
+      int best_code = 0, best_error = INT32_MAX;
+      for (int code = 0; code < 16; ++code) {
+        struct adpcm_state_t trial = state;
+        int error = abs(adpcm_decode(&trial, code) - samples[first + sample]);
+        if (error < best_error) {
+          best_error = error;
+          best_code = code;
+          best_state = trial;
+        }
+      }
+      state = best_state;
+      decoded[first + sample] = state.predictor;
+      block[ADPCM_HEADER_BYTES + (sample - 1) / 2] |= (sample - 1) & 1 ? best_code << 4 : best_code;
+    }
+    bytes += ADPCM_HEADER_BYTES + block_samples / 2; // the codes for samples 1..block_samples-1
+  }
+  return bytes;
+}
+
+int main(int argc, char **argv) {
+  if (argc != 2) {
+    fprintf(stderr, "usage: playtune_adpcm output.cpp\n");
+    return 8;
+  }
+  FILE *fp = fopen(argv[1], "w");
+  if (!fp) {
+    fprintf(stderr, "can't create %s\n", argv[1]);
+    return 4;
+  }
+  fprintf(fp, "/* synth_Playtune_adpcm.cpp\n\n"
+          "    IMA-ADPCM compressed percussion waveforms for synth_Playtune, an audio object\n"
+          "    for the PJRC Teensy Audio Library. See synth_Playtune_adpcm.h for the format.\n\n"
+          "    This file was generated by host/playtune_adpcm.cpp from synth_Playtune_waves.cpp.\n"
+          "    Don't edit it; change that and run it again.\n\n"
+          "    Copyright (C) 2026, the Playtune_synth contributors (MIT license; see LICENSE.txt)\n*/\n\n"
+          "#include \"Arduino.h\"\n#include \"synth_Playtune.h\"\n\n#if DO_PERCUSSION && COMPRESSED_PERCUSSION\n");
+  const int num_waveforms = sizeof(waveforms) / sizeof(waveforms[0]);
+  int total_samples = 0, total_bytes = 0;
+  for (int waveform = 0; waveform < num_waveforms; ++waveform) {
+    int num_samples = drum_waveform_size[waveform];
+    uint8_t *data = (uint8_t *) malloc(num_samples / ADPCM_BLOCK_SAMPLES * ADPCM_BLOCK_BYTES + ADPCM_BLOCK_BYTES);
+    int16_t *decoded = (int16_t *) malloc(num_samples * sizeof(int16_t));
+    int bytes = compress(waveforms[waveform].samples, num_samples, data, decoded);
+    double signal = 0, noise = 0;
+    for (int sample = 0; sample < num_samples; ++sample) {
+      double value = waveforms[waveform].samples[sample];
+      signal += value * value;
+      noise += (value - decoded[sample]) * (value - decoded[sample]);
+    }
+    printf("%-24s %6d samples, %6d bytes -> %6d bytes, SNR %.1f dB\n", waveforms[waveform].name,
+           num_samples, num_samples * 2, bytes, noise > 0 ? 10 * log10(signal / noise) : 999.);
+    total_samples += num_samples;
+    total_bytes += bytes;
+    fprintf(fp, "\nextern const uint8_t %s_adpcm[] PROGMEM = { // %d samples\n", waveforms[waveform].name, num_samples);
+    for (int byte = 0; byte < bytes; ++byte)
+      fprintf(fp, "%s%d,%s", byte % 24 == 0 ? "  " : " ", data[byte], byte % 24 == 23 || byte == bytes - 1 ? "\n" : "");
+    fprintf(fp, "};\n");
+    free(data);
+    free(decoded);
+  }
+  printf("total                    %6d samples, %6d bytes -> %6d bytes\n", total_samples, total_samples * 2, total_bytes);
+  fprintf(fp, "\nextern const uint32_t drum_waveform_size[] = { // number of samples in each\n ");
+  for (int waveform = 0; waveform < num_waveforms; ++waveform)
+    fprintf(fp, " %u%s", (unsigned) drum_waveform_size[waveform], waveform < num_waveforms - 1 ? "," : "\n");
+  fprintf(fp, "};\n\n#endif // DO_PERCUSSION && COMPRESSED_PERCUSSION\n");
+  if (fclose(fp) != 0) {
+    fprintf(stderr, "can't write %s\n", argv[1]);
+    return 4;
+  }
+  return 0;
+}
@@ -0,0 +1,458 @@
+/* playtune_bench.cpp
+
+    Measure how long AudioSynthPlaytune::update() takes to make a 128-sample block
+    with 1 to MAX_TGENS tone generators playing instruments, percussion, or a mix
+    of both. The results are written to stdout as CSV, one line per measurement,
+    so that they can be compared between versions.
+
+    The compile-time options DO_ENVELOPE and DYNAMIC_VOLUME are reported in each line;
+    the host build makes one version of this program for each combination of them.
+    Each case is timed with each of the rendering kernels in playtune_simd.cpp that
+    this processor can run, so the vectorized ones can be compared with the scalar one.
+
+    Before timing anything, it checks that the optimized sample arithmetic in
+    synth_Playtune_dsp.h gives exactly the same results as the original scalar code,
+    that every vectorized kernel gives exactly the same results as the scalar kernel,
+    that percussion notes play for exactly as long as their waveforms, however long,
+    that a smaller AudioSynthPlaytuneT with fewer features plays them the same way,
+    that a layer gives its tone generators, and their share of the mixer, back to the main
+    score when it ends, and that a streamed score's header is read whole however it arrives.
+
+    usage: playtune_bench [-r repetitions] [-k kernel] [-l label] [-n] [-c]
+      -r n      time each case n times and report the fastest (default 50)
+      -k name   time only this kernel: scalar, sse4.1, avx2, avx512, or neon
+      -l label  put this label (a version name, perhaps) in the first column
+      -n        don't write the CSV header line
+      -c        just do the checks
+
+    Copyright (C) 2026, the Playtune_synth contributors (MIT license; see LICENSE.txt)
+*/
+
+#include <time.h>
+#include <math.h>
+#include "synth_Playtune.h"
+#include "synth_Playtune_dsp.h"
+#include "playtune_simd.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_CYCLE_COUNTER 1
+#endif
+
+#define BENCH_BLOCKS 32 // blocks per timing; the shortest drum sound lasts about 36 blocks
+
+enum bench_mode_t {BENCH_INSTRUMENTS, BENCH_PERCUSSION, BENCH_MIX};
+static const char *mode_names[] = {"instruments", "percussion", "mix"};
+
+static AudioSynthPlaytune pt;
+
+static uint64_t nanoseconds_now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static uint64_t cycles_now(void) {
+#if HAVE_CYCLE_COUNTER
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+// start notes on the first num_voices tone generators
+static void start_voices(bench_mode_t mode, int num_voices) {
+  pt.stop();
+  pt.num_tgens_used = MAX_TGENS; // we mix all the generators, as for a score with a 16-generator header
+  pt.amplitude_fraction = mixer_amplitude_fractions[num_voices];
+  for (int tgen = 0; tgen < num_voices; ++tgen) {
+    bool drum = mode == BENCH_PERCUSSION || (mode == BENCH_MIX && (tgen & 1));
+    if (drum) pt.tune_playnote(tgen, 128 + tgen % 6, 100); // the first six drums
+    else {
+      pt.tune_setinstrument(tgen, tgen % 15);
+      pt.tune_playnote(tgen, 48 + 3 * tgen, 100);
+    }
+  }
+}
+
+static void bench(const char *label, bench_mode_t mode, int num_voices, int repetitions) {
+  uint64_t best_ns = UINT64_MAX, best_cycles = UINT64_MAX;
+  for (int rep = 0; rep < repetitions; ++rep) {
+    start_voices(mode, num_voices);
+    uint64_t start_ns = nanoseconds_now(), start_cycles = cycles_now();
+    for (int block = 0; block < BENCH_BLOCKS; ++block) {
+      pt.clearTransmitted();
+      pt.update();
+    }
+    uint64_t cycles = cycles_now() - start_cycles, ns = nanoseconds_now() - start_ns;
+    if (ns < best_ns) best_ns = ns;
+    if (cycles < best_cycles) best_cycles = cycles;
+  }
+  printf("%s,%d,%d,%s,%s,%d,%.1f,", label, DO_ENVELOPE, DYNAMIC_VOLUME, playtune_render_kernel_name,
+         mode_names[mode], num_voices, (double)best_ns / BENCH_BLOCKS);
+  if (HAVE_CYCLE_COUNTER) printf("%.0f\n", (double)best_cycles / BENCH_BLOCKS);
+  else printf("\n");
+}
+
+//------------------------------------------------------------------------------
+//  Checks of the optimized arithmetic against the original scalar code
+//------------------------------------------------------------------------------
+
+static uint32_t random_seed = 12345;
+static uint32_t random_32(void) { // Marsaglia xorshift
+  random_seed ^= random_seed << 13;
+  random_seed ^= random_seed >> 17;
+  random_seed ^= random_seed << 5;
+  return random_seed;
+}
+static int32_t random_range(int32_t low, int32_t high) { // low..high inclusive
+  return low + (int32_t)(random_32() % (uint32_t)(high - low + 1));
+}
+
+static int32_t scalar_interpolate(int32_t val1, int32_t val2, uint32_t scale) {
+  val1 *= 0xFFFF - scale;
+  val2 *= scale;
+  return (val1 + val2) >> 16;
+}
+
+static int check_failures = 0;
+static void check(bool ok, const char *what, int32_t a, int32_t b, int32_t c, int32_t d) {
+  if (!ok && ++check_failures <= 10)
+    fprintf(stderr, "check failed: %s for %d %d %d %d\n", what, (int)a, (int)b, (int)c, (int)d);
+}
+
+static void check_kernels(void) {
+  static const int32_t edges[] = { -32768, -32767, -16384, -1, 0, 1, 16384, 32766, 32767 };
+  const int num_edges = sizeof(edges) / sizeof(edges[0]);
+  // interpolation: every fraction, for all pairs of edge values and some random ones
+  for (int pair = 0; pair < num_edges * num_edges + 200; ++pair) {
+    int32_t val1, val2;
+    if (pair < num_edges * num_edges) {
+      val1 = edges[pair / num_edges];
+      val2 = edges[pair % num_edges];
+    } else {
+      val1 = random_range(-32768, 32767);
+      val2 = random_range(-32768, 32767);
+    }
+    for (uint32_t scale = 0; scale <= 0xFFFF; ++scale)
+      check(playtune_interpolate(val1, val2, scale) >> 16 == scalar_interpolate(val1, val2, scale),
+            "interpolate", val1, val2, scale, 0);
+  }
+  // envelope and gain scaling, over the ranges those values can have
+  for (int trial = 0; trial < 2000000; ++trial) {
+    int32_t val1 = random_range(-32768, 32767), val2 = random_range(-32768, 32767);
+    uint32_t scale = random_32() & 0xFFFF;
+    int32_t our_level = scalar_interpolate(val1, val2, scale);
+    int32_t env_mult = random_range(0, 0x10000), ampl_frac = random_range(0, 0x10000);
+    int32_t volume_frac = ((random_32() & 0x7f) + 1) << 9, mix = random_range(-500000, 500000);
+    int32_t gain_frac = playtune_gain(volume_frac, ampl_frac);
+    check(gain_frac == (int32_t)((double)volume_frac * ampl_frac / 65536 + .5),
+          "gain", volume_frac, ampl_frac, gain_frac, 0);
+    int32_t interpolated = playtune_interpolate(val1, val2, scale);
+    check(playtune_mix(mix, interpolated, gain_frac) == mix + signed_multiply_32x16b(gain_frac, our_level),
+          "mix", our_level, gain_frac, mix, 0);
+    check(playtune_mix_enveloped(mix, interpolated, env_mult, gain_frac) ==
+          mix + signed_multiply_32x16b(gain_frac, signed_multiply_32x16b(env_mult, our_level)),
+          "mix_enveloped", our_level, env_mult, gain_frac, mix);
+  }
+  // the compile-time e^x, and the exponential envelope phases whose multipliers it makes,
+  // which should end up within 0.1% of where they're going
+  for (double x = -20; x <= 5; x += 0.001)
+    check(fabs(playtune_exp(x) / exp(x) - 1) < 1e-12, "exp", (int32_t)(x * 1000), 0, 0, 0);
+  for (int count = 1; count <= 100000; count += count / 3 + 1) {
+    uint32_t multiplier = (uint32_t)(playtune_exp(log(0.001) / count) * 4294967296.0), distance = 1 << 30;
+    for (int sample = 0; sample < count; ++sample)
+      distance = playtune_decay(distance, multiplier);
+    check(fabs(distance / (double)(1 << 30) - 0.001) < 0.0001, "decay", count, multiplier, distance, 0);
+  }
+}
+
+// the vectorized rendering kernels, on random runs of instruments and percussion,
+// including runs too short to fill a vector and ones that cross an instrument's last point
+
+#define MAX_KERNELS 8
+
+static void check_render_kernels(void) {
+  const char *names[MAX_KERNELS];
+  int num_kernels = playtune_available_kernels(names, MAX_KERNELS);
+  static int16_t waveform[1024];
+  for (int point = 0; point < 1024; ++point)
+    waveform[point] = point < 8 ? (point & 1 ? 32767 : -32768) : random_range(-32768, 32767);
+  for (int trial = 0; trial < 200000; ++trial) {
+    struct playtune_run_t start;
+    bool drum = trial & 1;
+    int count = random_range(1, AUDIO_BLOCK_SAMPLES);
+    start.waveform = drum ? waveform + random_range(0, 8) : waveform + 256 * random_range(0, 3);
+    start.index_shift = drum ? 17 : 23;
+    start.index_mask = drum ? 0xffffffff : 0xff;
+    if (drum) { // stay within the 1024 points
+      start.tone_phase = random_range(0, 511) << 17 | (random_32() & 0x1ffff);
+      start.tone_incr = random_range(1, 3 << 17);
+    } else {
+      start.tone_phase = random_32() & 0x7fffffff;
+      start.tone_incr = random_32() >> random_range(2, 31);
+    }
+    switch (trial % 3) {
+      case 0: // no envelope
+        start.env_mult = 0x10000;
+        start.env_incr = 0;
+        break;
+      case 1: // envelope that stays between 0 and 1.0
+        start.env_mult = random_range(0, 0x10000);
+        start.env_incr = random_range(-start.env_mult, 0x10000 - start.env_mult) / count;
+        break;
+      default: // anything, to check the fallback to the scalar kernel
+        start.env_mult = random_range(-0x20000, 0x20000);
+        start.env_incr = random_range(-0x800, 0x800);
+    }
+    start.gain_frac = playtune_gain(((random_32() & 0x7f) + 1) << 9, random_range(0, 0x10000));
+    int32_t initial_mix[AUDIO_BLOCK_SAMPLES], expected[AUDIO_BLOCK_SAMPLES], mix[AUDIO_BLOCK_SAMPLES];
+    for (int sample = 0; sample < count; ++sample)
+      initial_mix[sample] = random_range(-500000, 500000);
+    struct playtune_run_t scalar_run = start;
+    memcpy(expected, initial_mix, count * sizeof(int32_t));
+    playtune_render_scalar(&scalar_run, expected, count);
+    for (int kernel = 1; kernel < num_kernels; ++kernel) {
+      struct playtune_run_t run = start;
+      memcpy(mix, initial_mix, count * sizeof(int32_t));
+      playtune_select_kernel(names[kernel]);
+      playtune_render_kernel(&run, mix, count);
+      for (int sample = 0; sample < count; ++sample)
+        if (mix[sample] != expected[sample]) {
+          check(false, names[kernel], trial, sample, mix[sample], expected[sample]);
+          break;
+        }
+      check(run.tone_phase == scalar_run.tone_phase && run.env_mult == scalar_run.env_mult,
+            names[kernel], trial, count, run.tone_phase, scalar_run.tone_phase);
+    }
+  }
+  playtune_select_kernel("auto");
+}
+
+// percussion notes, which should play exactly one sample for each phase before the last point of
+// the waveform (so there is a point after it to interpolate towards), however long the waveform is,
+// and then stop
+
+#if DO_PERCUSSION && !COMPRESSED_PERCUSSION
+extern const int16_t *drum_waveforms[];
+extern const uint32_t drum_waveform_size[];
+
+static void check_drum(const int16_t *waveform, uint32_t num_samples, uint32_t tone_incr) {
+  uint32_t length = 0; // count the samples the slow way, with a phase that can't overflow
+  for (uint64_t phase = 0; phase < (uint64_t)(num_samples - 1) << 17; phase += tone_incr)
+    ++length;
+  pt.stop();
+  pt.num_tgens_used = MAX_TGENS;
+  pt.amplitude_fraction = 0x10000;
+  pt.tune_playdrum(0, waveform, num_samples, tone_incr, 127); // (with a gain of exactly 1.0)
+  uint64_t phase = 0;
+  for (uint32_t first = 0; first <= length; first += AUDIO_BLOCK_SAMPLES) {
+    pt.clearTransmitted();
+    pt.update();
+    const audio_block_t *block = pt.transmitted();
+    for (uint32_t sample = first; sample < first + AUDIO_BLOCK_SAMPLES; ++sample, phase += tone_incr) {
+      int32_t expected = 0;
+      if (sample < length) {
+        uint32_t index = phase >> 17, scale = (phase >> 1) & 0xFFFF;
+        expected = scalar_interpolate(waveform[index], waveform[index + 1], scale);
+      }
+      if (block->data[sample - first] != expected) {
+        check(false, "drum", num_samples, tone_incr, sample, length);
+        return;
+      }
+    }
+  }
+}
+
+static void check_drums(void) {
+  for (int drum = 0; drum_waveforms[drum]; ++drum) { // the real ones, at various rates
+    check_drum(drum_waveforms[drum], drum_waveform_size[drum], 0x20000);
+    for (int trial = 0; trial < 20; ++trial)
+      check_drum(drum_waveforms[drum], drum_waveform_size[drum], random_range(0x800, 0x80000));
+  }
+  static int16_t long_waveform[300001]; // and one much longer than 16383 points
+  for (int point = 0; point < 300001; ++point)
+    long_waveform[point] = random_range(1000, 32767); // (never silent, so stopping early would show)
+  check_drum(long_waveform, 300001, 0x20000);
+  check_drum(long_waveform, 300001, 0x1ffff);
+  check_drum(long_waveform, 300001, random_range(0x20000, 0x80000));
+  check_drum(long_waveform, 2, 0x20000);
+  pt.stop();
+}
+
+// A 4-voice synthesizer without envelopes, next to the full one, should play percussion notes
+// (which don't have envelopes) exactly as it does
+
+static AudioSynthPlaytuneT<4, PLAYTUNE_FEATURES & ~PT_ENVELOPE> lean_pt;
+
+static void check_lean_synth(void) {
+  pt.stop();
+  pt.num_tgens_used = lean_pt.num_tgens_used = 4;
+  pt.amplitude_fraction = lean_pt.amplitude_fraction = mixer_amplitude_fractions[4];
+  for (int tgen = 0; tgen < 4; ++tgen) {
+    pt.tune_playnote(tgen, 128 + tgen, 100);
+    lean_pt.tune_playnote(tgen, 128 + tgen, 100);
+  }
+  for (int block = 0; block < 4 * BENCH_BLOCKS; ++block) { // (until they have all ended)
+    pt.clearTransmitted();
+    pt.update();
+    lean_pt.clearTransmitted();
+    lean_pt.update();
+    for (int sample = 0; sample < AUDIO_BLOCK_SAMPLES; ++sample)
+      if (pt.transmitted()->data[sample] != lean_pt.transmitted()->data[sample]) {
+        check(false, "lean synth", block, sample, pt.transmitted()->data[sample], lean_pt.transmitted()->data[sample]);
+        return;
+      }
+  }
+  pt.stop();
+}
+#endif
+
+#if MAX_SCORES > 1
+// A layer on generators 12..15 that has ended shouldn't keep the main score from playing a note
+// on generator 13 afterwards, or keep the mixer attenuating a smaller score for its generators
+
+static const byte layer_main_score[] = {
+  'P', 't', 6, HDR_F1_VOLUME_PRESENT, 0, 16, // a header with volumes, for 16 generators
+  0x03, 0xe8, 0x9d, 60, 127,                 // after 1 second, play a note on generator 13
+  0x03, 0xe8, 0xf0                           // for 1 second, and stop
+};
+static const byte layer_small_score[] = {
+  'P', 't', 6, HDR_F1_VOLUME_PRESENT, 0, 4,  // the same for 4 generators, on generator 0
+  0x03, 0xe8, 0x90, 60, 127,
+  0x03, 0xe8, 0xf0
+};
+static const byte layer_sting[] = {
+  'P', 't', 6, HDR_F1_VOLUME_PRESENT, 0, 4,
+  0x90, 72, 127, 0x00, 0x64, 0x80, 0xf0      // a note for 100 msec
+};
+
+static int layer_peak(const byte *score, bool with_layer) { // the loudest sample in the score's second second
+  pt.stop();
+  pt.play(score);
+  if (with_layer) pt.playLayer(1, layer_sting, 12, 4);
+  int peak = 0;
+  for (int block = 0; pt.isPlaying(); ++block) {
+    pt.clearTransmitted();
+    pt.update();
+    for (int sample = 0; sample < AUDIO_BLOCK_SAMPLES && block * AUDIO_BLOCK_SAMPLES > AUDIO_SAMPLE_RATE; ++sample)
+      peak = max(peak, abs(pt.transmitted()->data[sample]));
+  }
+  check(!pt.layerPlaying(1), "layer still playing", 0, 0, 0, 0);
+  return peak;
+}
+
+static void check_layers(void) {
+  int peak_alone = layer_peak(layer_main_score, false), peak_after_layer = layer_peak(layer_main_score, true);
+  check(peak_alone > 0 && peak_after_layer > peak_alone / 2, "layer release", peak_alone, peak_after_layer, 0, 0);
+  peak_alone = layer_peak(layer_small_score, false);
+  int32_t fraction_alone = pt.amplitude_fraction;
+  peak_after_layer = layer_peak(layer_small_score, true);
+  // (the note starts at another random phase, so the peaks can differ a little)
+  check(peak_alone > 0 && abs(peak_after_layer - peak_alone) < peak_alone / 32 && pt.amplitude_fraction == fraction_alone,
+        "layer mixer level", peak_alone, peak_after_layer, fraction_alone, pt.amplitude_fraction);
+}
+#endif
+
+#if STREAM_BUFFER_BYTES
+// A streamed score should be read the same way however few bytes the reader returns at a time,
+// and one that ends in the middle of its header shouldn't play at all
+
+static const byte stream_score[] = {
+  'P', 't', 6, HDR_F1_VOLUME_PRESENT, 0, 4, // a header with volumes, for 4 generators
+  0x90, 60, 127, 0x01, 0xf4, 0x80, 0xf0     // a note for 500 msec
+};
+
+struct stream_reader_t {
+  uint32_t offset, length, chunk; // where we are in stream_score, where it ends, and how much to read at once
+};
+
+static int read_stream(void *context, byte *buffer, int bytes) {
+  struct stream_reader_t *reader = (struct stream_reader_t *) context;
+  int got = min((uint32_t)bytes, min(reader->chunk, reader->length - reader->offset));
+  memcpy(buffer, stream_score + reader->offset, got);
+  reader->offset += got;
+  return got;
+}
+
+static int stream_blocks(uint32_t length, uint32_t chunk) { // how long the score plays, in blocks
+  struct stream_reader_t reader = {0, length, chunk};
+  pt.stop();
+  pt.play(read_stream, &reader);
+  int blocks = 0;
+  for (; pt.isPlaying() && blocks < 10000; ++blocks) {
+    pt.refill();
+    pt.update();
+  }
+  return blocks;
+}
+
+static void check_stream(void) {
+  pt.play(stream_score);
+  int blocks = 0;
+  for (; pt.isPlaying(); ++blocks) pt.update();
+  for (uint32_t chunk = 1; chunk <= sizeof(stream_score); ++chunk) {
+    int streamed_blocks = stream_blocks(sizeof(stream_score), chunk) - pt.underruns(); // (each one is a block late)
+    check(streamed_blocks == blocks && pt.num_tgens_used == 4, "stream header", chunk, blocks, streamed_blocks, pt.num_tgens_used);
+  }
+  for (uint32_t length = 3; length < 6; ++length)
+    check(stream_blocks(length, 1) == 0, "stream ending in its header", length, 0, 0, 0);
+}
+#endif
+
+static void usage(void) {
+  fprintf(stderr, "usage: playtune_bench [-r repetitions] [-k kernel] [-l label] [-n] [-c]\n");
+  exit(8);
+}
+
+int main(int argc, char **argv) {
+  int repetitions = 50;
+  const char *label = "", *kernel = NULL;
+  bool header = true, check_only = false;
+  for (int argno = 1; argno < argc; ++argno) {
+    if (strcmp(argv[argno], "-n") == 0) header = false;
+    else if (strcmp(argv[argno], "-c") == 0) check_only = true;
+    else if (argno + 1 < argc && strcmp(argv[argno], "-r") == 0) repetitions = atoi(argv[++argno]);
+    else if (argno + 1 < argc && strcmp(argv[argno], "-k") == 0) kernel = argv[++argno];
+    else if (argno + 1 < argc && strcmp(argv[argno], "-l") == 0) label = argv[++argno];
+    else usage();
+  }
+  if (repetitions <= 0) usage();
+  const char *kernels[MAX_KERNELS];
+  int num_kernels = playtune_available_kernels(kernels, MAX_KERNELS);
+  if (kernel) {
+    if (!playtune_select_kernel(kernel)) {
+      fprintf(stderr, "this processor can't run the %s kernel\n", kernel);
+      return 4;
+    }
+    kernels[0] = kernel;
+    num_kernels = 1;
+  }
+  check_kernels();
+  check_render_kernels();
+#if DO_PERCUSSION && !COMPRESSED_PERCUSSION
+  check_drums();
+  check_lean_synth();
+#endif
+#if MAX_SCORES > 1
+  check_layers();
+#endif
+#if STREAM_BUFFER_BYTES
+  check_stream();
+#endif
+  if (check_failures) {
+    fprintf(stderr, "%d checks failed\n", check_failures);
+    return 1;
+  }
+  if (check_only) {
+    fprintf(stderr, "all checks passed\n");
+    return 0;
+  }
+  if (header) printf("label,envelope,dynamic_volume,kernel,mode,voices,ns_per_block,cycles_per_block\n");
+  for (int kernel_num = 0; kernel_num < num_kernels; ++kernel_num) {
+    playtune_select_kernel(kernels[kernel_num]);
+    for (int mode = BENCH_INSTRUMENTS; mode <= BENCH_MIX; ++mode)
+      for (int num_voices = 1; num_voices <= MAX_TGENS; ++num_voices)
+        bench(label, (bench_mode_t)mode, num_voices, repetitions);
+  }
+  return 0;
+}
@@ -0,0 +1,112 @@
+/* playtune_mipmaps.cpp
+
+    Generate synth_Playtune_mipmaps.cpp, the band-limited copies of the instrument
+    waveforms in synth_Playtune_waves.cpp that synth_Playtune uses to play high notes
+    without aliasing when BANDLIMITED_WAVES is on.
+
+    A 256-point waveform has up to 128 harmonics. Playing it by stepping through more than
+    one point per sample pushes the highest of them past the Nyquist frequency, where they
+    fold back down as inharmonic noise. So for each instrument we make WAVE_MIPMAPS copies:
+    copy L (1..WAVE_MIPMAPS) has only the harmonics up to 128 / 2^L, which stay below the
+    Nyquist frequency while stepping up to 2^L points per sample. tune_playnote picks the
+    copy from the note's tone_incr.
+
+    Each copy is made by taking the discrete Fourier transform of the waveform, zeroing
+    the harmonics above the limit, and transforming it back. If cutting the harmonics
+    makes the peaks overshoot 16 bits, the whole copy is scaled down to fit.
+
+    Run this again, with the host build's "mipmaps" target, whenever a waveform is added
+    or changed, and add the new waveform to the list below in the same order as
+    instrument_waveforms[] in synth_Playtune.cpp.
+
+    usage: playtune_mipmaps output.cpp
+
+    Copyright (C) 2026, the Playtune_synth contributors (MIT license; see LICENSE.txt)
+*/
+
+#include <math.h>
+#include "synth_Playtune.h"
+
+#define WAVE_POINTS 256
+
+#define WAVEFORM(name) extern const int16_t name[WAVE_POINTS];
+#define WAVEFORMS \
+  WAVEFORM(waveform_aguitar_0033) WAVEFORM(waveform_altosax_0001) WAVEFORM(waveform_birds_0011) \
+  WAVEFORM(waveform_cello_0005) WAVEFORM(waveform_clarinett_0001) WAVEFORM(waveform_clavinet_0021) \
+  WAVEFORM(waveform_dbass_0015) WAVEFORM(waveform_ebass_0037) WAVEFORM(waveform_eguitar_0002) \
+  WAVEFORM(waveform_eorgan_0064) WAVEFORM(waveform_epiano_0044) WAVEFORM(waveform_flute_0001) \
+  WAVEFORM(waveform_oboe_0002) WAVEFORM(waveform_piano_0013) WAVEFORM(waveform_violin_0003)
+WAVEFORMS
+#undef WAVEFORM
+#define WAVEFORM(name) {#name, name},
+static const struct {
+  const char *name;
+  const int16_t *points;
+} waveforms[] = { WAVEFORMS };
+#undef WAVEFORM
+
+// Make a copy of a waveform with only the harmonics up to max_harmonic
+
+static void band_limit(const int16_t *points, int max_harmonic, int16_t *copy) {
+  double cosines[WAVE_POINTS / 2 + 1], sines[WAVE_POINTS / 2 + 1], result[WAVE_POINTS];
+  for (int harmonic = 0; harmonic <= max_harmonic; ++harmonic) {
+    cosines[harmonic] = sines[harmonic] = 0;
+    for (int point = 0; point < WAVE_POINTS; ++point) {
+      double angle = 2 * M_PI * harmonic * point / WAVE_POINTS;
+      cosines[harmonic] += points[point] * cos(angle);
+      sines[harmonic] += points[point] * sin(angle);
+    }
+  }
+  double peak = 0;
+  for (int point = 0; point < WAVE_POINTS; ++point) {
+    double value = cosines[0] / WAVE_POINTS;
+    for (int harmonic = 1; harmonic <= max_harmonic; ++harmonic) {
+      double angle = 2 * M_PI * harmonic * point / WAVE_POINTS;
+      double weight = harmonic == WAVE_POINTS / 2 ? 1.0 : 2.0; // (the Nyquist term appears only once)
+      value += weight * (cosines[harmonic] * cos(angle) + sines[harmonic] * sin(angle)) / WAVE_POINTS;
+    }
+    result[point] = value;
+    if (fabs(value) > peak) peak = fabs(value);
+  }
+  double scale = peak > 32767 ? 32767 / peak : 1.0;
+  for (int point = 0; point < WAVE_POINTS; ++point)
+    copy[point] = (int16_t)lround(result[point] * scale);
+}
+
+int main(int argc, char **argv) {
+  if (argc != 2) {
+    fprintf(stderr, "usage: playtune_mipmaps output.cpp\n");
+    return 8;
+  }
+  FILE *fp = fopen(argv[1], "w");
+  if (!fp) {
+    fprintf(stderr, "can't create %s\n", argv[1]);
+    return 4;
+  }
+  fprintf(fp, "/* synth_Playtune_mipmaps.cpp\n\n"
+          "    Band-limited copies of the instrument waveforms for synth_Playtune, an audio object\n"
+          "    for the PJRC Teensy Audio Library, for playing high notes without aliasing.\n"
+          "    Copy L of each waveform has only its harmonics up to 128 / 2^L.\n\n"
+          "    This file was generated by host/playtune_mipmaps.cpp from synth_Playtune_waves.cpp.\n"
+          "    Don't edit it; change that and run it again.\n\n"
+          "    Copyright (C) 2026, the Playtune_synth contributors (MIT license; see LICENSE.txt)\n*/\n\n"
+          "#include \"Arduino.h\"\n#include \"synth_Playtune.h\"\n\n#if BANDLIMITED_WAVES\n");
+  for (unsigned waveform = 0; waveform < sizeof(waveforms) / sizeof(waveforms[0]); ++waveform) {
+    fprintf(fp, "\nextern const int16_t %s_mipmaps[WAVE_MIPMAPS][256] PROGMEM = {\n", waveforms[waveform].name);
+    for (int level = 1; level <= WAVE_MIPMAPS; ++level) {
+      int16_t copy[WAVE_POINTS];
+      band_limit(waveforms[waveform].points, (WAVE_POINTS / 2) >> level, copy);
+      fprintf(fp, "  { // %d harmonics\n", (WAVE_POINTS / 2) >> level);
+      for (int point = 0; point < WAVE_POINTS; ++point)
+        fprintf(fp, "%s%d,%s", point % 16 == 0 ? "    " : " ", copy[point], point % 16 == 15 ? "\n" : "");
+      fprintf(fp, "  },\n");
+    }
+    fprintf(fp, "};\n");
+  }
+  fprintf(fp, "\n#endif // BANDLIMITED_WAVES\n");
+  if (fclose(fp) != 0) {
+    fprintf(stderr, "can't write %s\n", argv[1]);
+    return 4;
+  }
+  return 0;
+}
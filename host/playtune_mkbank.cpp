@@ -0,0 +1,186 @@
+/* playtune_mkbank.cpp
+
+    Make a sample bank (see synth_Playtune_bank.h) for synth_Playtune to play, so that it can
+    use different sounds without being rebuilt. The bank starts out with all the built-in
+    instruments and percussion instruments, their envelopes, and the patch maps. Then percussion
+    waveforms can be replaced or added from WAV files, and percussion notes mapped to them.
+
+    usage: playtune_mkbank [options] output.bank
+    options:
+      -d n file.wav  make percussion instrument n the samples in a 16-bit mono WAV file, played
+                     at its sample rate; n can be the number of the next one, to add it
+      -p note n      play percussion instrument n for MIDI percussion note "note" (0..127)
+
+    For example, to play a longer cymbal for the crash and splash cymbals (notes 49, 55, 57):
+      playtune_mkbank -d 6 cymbal.wav -p 49 6 -p 55 6 -p 57 6 venue.bank
+
+    The bank is for the sample rate and options this program was compiled with; the host build
+    makes it without BANDLIMITED_WAVES or COMPRESSED_PERCUSSION, like the Teensy default. (A bank
+    made either way plays either way: a note uses the original waveform when the band-limited
+    copy it would use isn't in the bank, or BANDLIMITED_WAVES is off.)
+
+    Copyright (C) 2026, the Playtune_synth contributors (MIT license; see LICENSE.txt)
+*/
+
+#include "synth_Playtune.h"
+
+#define MAX_DRUMS 255
+
+static struct { // the percussion instruments we will write
+  const int16_t *samples;
+  uint32_t num_samples, tone_incr;
+} drums[MAX_DRUMS];
+static int num_drums;
+static byte drum_patch_map[128];
+
+static byte *bank;            // the bank we are making
+static uint32_t bank_bytes;   // how much of it there is so far
+
+// Add some data to the end of the bank, aligned to 4 bytes, and return its offset
+
+static uint32_t add_data(const void *data, uint32_t bytes) {
+  uint32_t offset = (bank_bytes + 3) & ~3;
+  bank = (byte *) realloc(bank, offset + bytes);
+  if (!bank) {
+    fprintf(stderr, "can't allocate %u bytes\n", (unsigned)(offset + bytes));
+    exit(4);
+  }
+  memset(bank + bank_bytes, 0, offset - bank_bytes);
+  if (data) memcpy(bank + offset, data, bytes);
+  bank_bytes = offset + bytes;
+  return offset;
+}
+
+static uint32_t get32(const byte *data) {
+  return data[0] | data[1] << 8 | data[2] << 16 | (uint32_t)data[3] << 24;
+}
+
+// Read a 16-bit mono WAV file into a percussion instrument
+
+static bool read_wav(const char *filename, int drum) {
+  FILE *fp = fopen(filename, "rb");
+  if (!fp) {
+    fprintf(stderr, "can't read %s\n", filename);
+    return false;
+  }
+  byte header[12], chunk[8], format[16];
+  uint32_t sample_rate = 0;
+  bool ok = fread(header, 1, 12, fp) == 12 && memcmp(header, "RIFF", 4) == 0 && memcmp(header + 8, "WAVE", 4) == 0;
+  while (ok && fread(chunk, 1, 8, fp) == 8) {
+    uint32_t chunk_bytes = get32(chunk + 4);
+    if (memcmp(chunk, "fmt ", 4) == 0) {
+      ok = chunk_bytes >= 16 && fread(format, 1, 16, fp) == 16
+           && format[0] == 1 && format[1] == 0   // PCM
+           && format[2] == 1 && format[3] == 0   // mono
+           && format[14] == 16 && format[15] == 0; // 16 bits per sample
+      sample_rate = get32(format + 4);
+      fseek(fp, (chunk_bytes - 16 + 1) & ~1, SEEK_CUR);
+    }
+    else if (memcmp(chunk, "data", 4) == 0 && sample_rate) {
+      uint32_t num_samples = chunk_bytes / 2;
+      byte *data = (byte *) malloc(chunk_bytes);
+      int16_t *samples = (int16_t *) malloc(num_samples * sizeof(int16_t));
+      ok = data && samples && num_samples >= 2 && fread(data, 1, chunk_bytes, fp) == chunk_bytes;
+      if (ok) {
+        for (uint32_t sample = 0; sample < num_samples; ++sample)
+          samples[sample] = (int16_t)(data[2 * sample] | data[2 * sample + 1] << 8);
+        drums[drum].samples = samples;
+        drums[drum].num_samples = num_samples;
+        drums[drum].tone_incr = (uint32_t)((int64_t)sample_rate * 0x20000 / AUDIO_SAMPLE_RATE);
+        printf("percussion instrument %d: %u samples at %u Hz from %s\n", drum, (unsigned)num_samples,
+               (unsigned)sample_rate, filename);
+      }
+      free(data);
+      fclose(fp);
+      return ok;
+    }
+    else fseek(fp, (chunk_bytes + 1) & ~1, SEEK_CUR);
+  }
+  fprintf(stderr, "%s isn't a 16-bit mono WAV file\n", filename);
+  fclose(fp);
+  return false;
+}
+
+static void usage(void) {
+  fprintf(stderr, "usage: playtune_mkbank [-d n file.wav] [-p note n] output.bank\n");
+  exit(8);
+}
+
+int main(int argc, char **argv) {
+  // start with the built-in sounds
+  num_drums = playtune_num_drums(NULL);
+  for (int drum = 0; drum < num_drums; ++drum)
+    drums[drum].samples = (const int16_t *) playtune_drum(NULL, drum, &drums[drum].num_samples, &drums[drum].tone_incr);
+  for (int note = 0; note < 128; ++note)
+    drum_patch_map[note] = playtune_drum_patch(NULL, note);
+
+  int argno;
+  for (argno = 1; argno < argc - 1 && argv[argno][0] == '-'; argno += 3) {
+    if (argno + 3 >= argc) usage();
+    int number = atoi(argv[argno + 1]);
+    if (strcmp(argv[argno], "-d") == 0) {
+      if (number < 0 || number > num_drums || number >= MAX_DRUMS) usage();
+      if (!read_wav(argv[argno + 2], number)) return 4;
+      if (number == num_drums) ++num_drums;
+    }
+    else if (strcmp(argv[argno], "-p") == 0) {
+      int drum = atoi(argv[argno + 2]);
+      if (number < 0 || number > 127 || drum < 0 || drum >= num_drums) usage();
+      drum_patch_map[number] = drum;
+    }
+    else usage();
+  }
+  if (argc - argno != 1) usage();
+
+  struct playtune_bank_t header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.id, PLAYTUNE_BANK_ID, 4);
+  header.version = PLAYTUNE_BANK_VERSION;
+  header.header_bytes = sizeof(header);
+  header.sample_rate = (uint32_t)(AUDIO_SAMPLE_RATE + 0.5);
+  header.num_instruments = playtune_num_instruments(NULL);
+  header.num_drums = num_drums;
+  header.wave_mipmaps = playtune_wave_mipmaps(NULL);
+  add_data(&header, sizeof(header));
+
+  // the instruments, then their waveforms
+  header.instruments = add_data(NULL, header.num_instruments * sizeof(struct playtune_bank_instrument_t));
+  for (int instrument = 0; instrument < header.num_instruments; ++instrument) {
+    struct playtune_bank_instrument_t bank_instrument;
+    bank_instrument.envelope = *playtune_envelope(NULL, instrument);
+    bank_instrument.waveforms = add_data(NULL, 0);
+    for (int level = 0; level <= header.wave_mipmaps; ++level)
+      add_data(playtune_waveform(NULL, instrument, level), 256 * sizeof(int16_t));
+    memcpy(bank + header.instruments + instrument * sizeof(bank_instrument), &bank_instrument, sizeof(bank_instrument));
+  }
+  byte instrument_patch_map[128];
+  for (int program = 0; program < 128; ++program)
+    instrument_patch_map[program] = playtune_instrument_patch(NULL, program);
+  header.instrument_patch_map = add_data(instrument_patch_map, 128);
+
+  // the percussion instruments, then their waveforms
+  header.drums = add_data(NULL, num_drums * sizeof(struct playtune_bank_drum_t));
+  for (int drum = 0; drum < num_drums; ++drum) {
+    struct playtune_bank_drum_t bank_drum;
+    bank_drum.num_samples = drums[drum].num_samples;
+    bank_drum.tone_incr = drums[drum].tone_incr;
+    bank_drum.waveform = add_data(drums[drum].samples, drums[drum].num_samples * sizeof(int16_t));
+    memcpy(bank + header.drums + drum * sizeof(bank_drum), &bank_drum, sizeof(bank_drum));
+  }
+  header.drum_patch_map = add_data(drum_patch_map, 128);
+
+  header.total_bytes = bank_bytes;
+  memcpy(bank, &header, sizeof(header));
+  if (!playtune_check_bank(bank, bank_bytes)) { // (realloc leaves it aligned)
+    fprintf(stderr, "the bank we made is bad\n");
+    return 4;
+  }
+  FILE *fp = fopen(argv[argno], "wb");
+  if (!fp || fwrite(bank, 1, bank_bytes, fp) != bank_bytes || fclose(fp) != 0) {
+    fprintf(stderr, "can't write %s\n", argv[argno]);
+    return 4;
+  }
+  printf("%s: %d instruments with %d band-limited copies, %d percussion instruments, %u bytes\n", argv[argno],
+         header.num_instruments, header.wave_mipmaps, num_drums, (unsigned)bank_bytes);
+  return 0;
+}
@@ -0,0 +1,318 @@
+/* playtune_render.cpp
+
+    Render a Playtune bytestream to a WAV file on a host machine, as fast as possible,
+    and report how much faster than real time the synthesizer ran.
+
+    usage: playtune_render [options] score output.wav
+      score is either the name of one of the example scores (MoneyMoney, jordu,
+      UnsquareDance) or the name of a binary Playtune bytestream file.
+    options:
+      -g n   the number of tone generators, for old files without a header
+      -s n   stop after n seconds, for scores that restart forever (default 600)
+      -r n   render the score n times and report the fastest (default 1)
+      -k name  render with this kernel from playtune_simd.cpp: scalar, sse4.1, avx2,
+             avx512, or neon (default: the fastest one this processor can run)
+      -b file  play with the sounds in this sample bank, made by playtune_mkbank,
+             instead of the built-in ones
+      -e       compile the score into a list of events first, and play that
+      -j n     index the score, and start playing it n msec from the beginning
+      -t n     stream the score from its file through the ring buffer, refilling it every n blocks,
+             and report how many times it ran dry (not when STREAM_BUFFER_BYTES is 0)
+      -q n     start the score through the command queue, at sample n of the first block
+             (not when COMMAND_QUEUE_SIZE is 0)
+      -l name  play another score at the same time, as a layer on the last generators
+
+    Copyright (C) 2026, the Playtune_synth contributors (MIT license; see LICENSE.txt)
+*/
+
+#include <time.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "synth_Playtune.h"
+#include "playtune_simd.h"
+
+extern const unsigned char PROGMEM MoneyMoney_score [];
+extern const unsigned char PROGMEM jordu_score [];
+extern const unsigned char PROGMEM UnsquareDance_score [];
+
+static const struct {
+  const char *name;
+  const byte *score;
+} example_scores[] = {
+  {"MoneyMoney", MoneyMoney_score},
+  {"jordu", jordu_score},
+  {"UnsquareDance", UnsquareDance_score}
+};
+
+static AudioSynthPlaytune pt;
+static struct playtune_checkpoint_t *checkpoints; // the index for -j
+static uint32_t num_checkpoints;
+static unsigned long start_msec;
+static FILE *stream_file;       // the file for -t,
+static unsigned refill_blocks;  //   and how often to refill the buffer from it
+static int queue_offset = -1;   // the sample offset for -q
+static const byte *layer_score; // the score for -l,
+static unsigned layer_tgens;    //   and how many generators it uses
+
+#if STREAM_BUFFER_BYTES
+static int read_stream(void *context, byte *buffer, int bytes) {
+  return (int)fread(buffer, 1, bytes, (FILE *)context);
+}
+#endif
+
+static double seconds_now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static byte *read_file(const char *filename) {
+  FILE *fp = fopen(filename, "rb");
+  if (!fp) return NULL;
+  fseek(fp, 0, SEEK_END);
+  long size = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  byte *data = (byte *) malloc(size + 1);
+  if (data && fread(data, 1, size, fp) != (size_t)size) {
+    free(data);
+    data = NULL;
+  }
+  fclose(fp);
+  return data;
+}
+
+// One of the example scores, or else a score file
+
+static const byte *find_score(const char *name) {
+  for (unsigned i = 0; i < sizeof(example_scores) / sizeof(example_scores[0]); ++i)
+    if (strcmp(name, example_scores[i].name) == 0) return example_scores[i].score;
+  return read_file(name);
+}
+
+// Map a file into memory read-only, as a sample bank is meant to be used: in place
+
+static const void *map_file(const char *filename, uint32_t *size) {
+  int fd = open(filename, O_RDONLY);
+  if (fd < 0) return NULL;
+  struct stat st;
+  void *data = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && st.st_size > 0 && (uint64_t)st.st_size <= UINT32_MAX) {
+    data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    *size = (uint32_t)st.st_size;
+  }
+  close(fd);
+  return data == MAP_FAILED ? NULL : data;
+}
+
+static void put16(FILE *fp, uint16_t val) {
+  fputc(val & 0xff, fp);
+  fputc(val >> 8, fp);
+}
+static void put32(FILE *fp, uint32_t val) {
+  put16(fp, val & 0xffff);
+  put16(fp, val >> 16);
+}
+
+static bool write_wav(const char *filename, const int16_t *samples, uint32_t num_samples) {
+  FILE *fp = fopen(filename, "wb");
+  if (!fp) return false;
+  uint32_t data_bytes = num_samples * 2;
+  fputs("RIFF", fp); put32(fp, 36 + data_bytes); fputs("WAVE", fp);
+  fputs("fmt ", fp); put32(fp, 16);
+  put16(fp, 1);  // PCM
+  put16(fp, 1);  // mono
+  put32(fp, (uint32_t)(AUDIO_SAMPLE_RATE + .5)); put32(fp, (uint32_t)(AUDIO_SAMPLE_RATE + .5) * 2);
+  put16(fp, 2);  // bytes per sample frame
+  put16(fp, 16); // bits per sample
+  fputs("data", fp); put32(fp, data_bytes);
+  for (uint32_t i = 0; i < num_samples; ++i)
+    put16(fp, (uint16_t)samples[i]);
+  return fclose(fp) == 0;
+}
+
+// Play the score (or the compiled score, if events isn't NULL) to the end, or until max_blocks,
+// and return the number of blocks made.
+static uint32_t render(const byte *score, const struct playtune_event_t *events, unsigned num_tgens,
+                       int16_t *samples, uint32_t max_blocks) {
+  uint32_t blocks = 0;
+#if STREAM_BUFFER_BYTES
+  if (stream_file) {
+    rewind(stream_file);
+    pt.play(read_stream, stream_file);
+  }
+  else
+#endif
+  if (events) pt.play(events, num_tgens ? num_tgens : MAX_TGENS);
+#if COMMAND_QUEUE_SIZE
+  else if (queue_offset >= 0) pt.queuePlay(score, queue_offset);
+#endif
+  else if (num_tgens) pt.play(score, num_tgens);
+  else pt.play(score);
+  if (checkpoints && !pt.seek(start_msec, checkpoints, num_checkpoints)) {
+    fprintf(stderr, "can't seek to %lu msec\n", start_msec);
+    exit(4);
+  }
+  if (layer_score) pt.playLayer(1, layer_score, MAX_TGENS - layer_tgens, layer_tgens);
+  while ((pt.isPlaying() || pt.layerPlaying(1)) && blocks < max_blocks) {
+#if STREAM_BUFFER_BYTES
+    if (stream_file && blocks % refill_blocks == 0) pt.refill();
+#endif
+    pt.clearTransmitted();
+    pt.update();
+    const audio_block_t *block = pt.transmitted();
+    if (block) memcpy(samples + blocks * AUDIO_BLOCK_SAMPLES, block->data, sizeof(block->data));
+    else memset(samples + blocks * AUDIO_BLOCK_SAMPLES, 0, sizeof(block->data));
+    ++blocks;
+  }
+  pt.stop();
+  pt.stopLayer(1);
+  return blocks;
+}
+
+static void usage(void) {
+  fprintf(stderr, "usage: playtune_render [-g num_tgens] [-s max_seconds] [-r repeats] [-k kernel] [-b bank] [-e] [-j start_msec] [-t refill_blocks] [-q offset] [-l layer_score] score output.wav\n");
+  fprintf(stderr, "  score is a Playtune bytestream file or one of:");
+  for (unsigned i = 0; i < sizeof(example_scores) / sizeof(example_scores[0]); ++i)
+    fprintf(stderr, " %s", example_scores[i].name);
+  fprintf(stderr, "\n");
+  exit(8);
+}
+
+int main(int argc, char **argv) {
+  unsigned num_tgens = 0, max_seconds = 600, repeats = 1;
+  const char *bank_name = NULL, *layer_name = NULL;
+  bool compile = false, seek = false;
+  int argno;
+  for (argno = 1; argno < argc && argv[argno][0] == '-'; ++argno) {
+    if (strcmp(argv[argno], "-e") == 0) {
+      compile = true;
+      continue;
+    }
+    if (argno + 1 >= argc) usage();
+    int value = atoi(argv[argno + 1]);
+    switch (argv[argno][1]) {
+      case 'g': num_tgens = value; break;
+      case 's': max_seconds = value; break;
+      case 'r': repeats = value; break;
+      case 'k':
+        if (!playtune_select_kernel(argv[argno + 1])) {
+          fprintf(stderr, "this processor can't run the %s kernel\n", argv[argno + 1]);
+          return 4;
+        }
+        break;
+      case 'b': bank_name = argv[argno + 1]; break;
+      case 'j': start_msec = value; seek = true; break;
+#if STREAM_BUFFER_BYTES
+      case 't': refill_blocks = value; break;
+#endif
+#if COMMAND_QUEUE_SIZE
+      case 'q': queue_offset = value; break;
+#endif
+      case 'l': layer_name = argv[argno + 1]; break;
+      default: usage();
+    }
+    ++argno;
+  }
+  if (argc - argno != 2 || (num_tgens > MAX_TGENS) || max_seconds == 0 || repeats == 0 || (compile && seek)
+      || (refill_blocks && (compile || seek)) || (queue_offset >= 0 && (compile || seek || refill_blocks))
+      || queue_offset >= AUDIO_BLOCK_SAMPLES) usage();
+  const char *score_name = argv[argno], *wav_name = argv[argno + 1];
+
+  const byte *score = find_score(score_name);
+  if (refill_blocks) {
+    if (!(stream_file = fopen(score_name, "rb"))) {
+      fprintf(stderr, "can't read score file %s\n", score_name);
+      return 4;
+    }
+  }
+  else if (!score) {
+    fprintf(stderr, "can't read score file %s\n", score_name);
+    return 4;
+  }
+  if (layer_name) {
+    if (!(layer_score = find_score(layer_name))) {
+      fprintf(stderr, "can't read score file %s\n", layer_name);
+      return 4;
+    }
+    bool volume_present;
+    layer_tgens = MAX_TGENS;
+    playtune_score_header(layer_score, &volume_present, &layer_tgens);
+    layer_tgens = max(1, min(MAX_TGENS, (int)layer_tgens));
+  }
+
+  if (bank_name) {
+    uint32_t bank_size;
+    const void *bank = map_file(bank_name, &bank_size);
+    if (!bank) {
+      fprintf(stderr, "can't read sample bank %s\n", bank_name);
+      return 4;
+    }
+    if (!pt.useBank(bank, bank_size)) {
+      fprintf(stderr, "%s isn't a sample bank we can play\n", bank_name);
+      return 4;
+    }
+  }
+
+  struct playtune_event_t *events = NULL;
+  if (compile) {
+    unsigned header_tgens;
+    uint32_t num_events = pt.compileScore(score, NULL, 0, &header_tgens);
+    events = (struct playtune_event_t *) malloc(num_events * sizeof(struct playtune_event_t));
+    if (!events) {
+      fprintf(stderr, "can't allocate %u events\n", (unsigned)num_events);
+      return 4;
+    }
+    pt.compileScore(score, events, num_events, &header_tgens);
+    if (!num_tgens) num_tgens = header_tgens;
+    printf("%s: compiled into %u events, %u bytes\n", score_name, (unsigned)num_events,
+           (unsigned)(num_events * sizeof(struct playtune_event_t)));
+  }
+
+  if (seek) {
+    num_checkpoints = pt.indexScore(score, NULL, 0);
+    checkpoints = (struct playtune_checkpoint_t *) malloc(num_checkpoints * sizeof(struct playtune_checkpoint_t));
+    if (!checkpoints) {
+      fprintf(stderr, "can't allocate %u checkpoints\n", (unsigned)num_checkpoints);
+      return 4;
+    }
+    pt.indexScore(score, checkpoints, num_checkpoints);
+    printf("%s: indexed with %u checkpoints, %u bytes\n", score_name, (unsigned)num_checkpoints,
+           (unsigned)(num_checkpoints * sizeof(struct playtune_checkpoint_t)));
+  }
+
+  uint32_t max_blocks = (uint32_t)(max_seconds * AUDIO_SAMPLE_RATE / AUDIO_BLOCK_SAMPLES) + 1;
+  int16_t *samples = (int16_t *) malloc((size_t)max_blocks * AUDIO_BLOCK_SAMPLES * sizeof(int16_t));
+  if (!samples) {
+    fprintf(stderr, "can't allocate %u blocks\n", max_blocks);
+    return 4;
+  }
+  uint32_t blocks = 0;
+  double best_time = 0;
+  for (unsigned run = 0; run < repeats; ++run) {
+    double start_time = seconds_now();
+    blocks = render(score, events, num_tgens, samples, max_blocks);
+    double elapsed = seconds_now() - start_time;
+    if (run == 0 || elapsed < best_time) best_time = elapsed;
+  }
+
+  uint32_t num_samples = blocks * AUDIO_BLOCK_SAMPLES;
+  double audio_time = num_samples / AUDIO_SAMPLE_RATE;
+  printf("%s: %u blocks, %.2f seconds of audio rendered in %.3f seconds by the %s kernel, %.1f times real time\n",
+         score_name, blocks, audio_time, best_time, playtune_render_kernel_name,
+         best_time > 0 ? audio_time / best_time : 0);
+#if STREAM_BUFFER_BYTES
+  if (stream_file) printf("  the stream ran dry %lu times\n", pt.underruns());
+#endif
+  if (blocks >= max_blocks)
+    printf("  (stopped after %u seconds; use -s to play longer)\n", max_seconds);
+  if (!write_wav(wav_name, samples, num_samples)) {
+    fprintf(stderr, "can't write %s\n", wav_name);
+    return 4;
+  }
+  free(samples);
+  free(events);
+  free(checkpoints);
+  return 0;
+}
@@ -0,0 +1,348 @@
+/* playtune_simd.cpp
+
+    Vectorized kernels for rendering runs of samples from one synth_Playtune tone generator
+    on a host machine. See playtune_simd.h.
+
+    The scalar kernel does what synth_Playtune.cpp does on the Teensy, using the same
+    synth_Playtune_dsp.h arithmetic. The vector kernels do 4, 8 or 16 samples at once:
+
+      - the waveform phase and envelope multiplier of each lane start k increments along
+        and step by lanes*increment, which wraps around exactly as adding one increment at
+        a time does;
+      - the interpolation is done modulo 2^32 exactly as playtune_interpolate does it;
+      - each signed_multiply_32x16 becomes a 32-bit multiply and an arithmetic right shift.
+        That is exact, not just close, as long as the product fits in 32 bits, which it does
+        if the envelope multiplier and the gain are both between 0 and 1.0. They
+        always are, but a kernel checks that for the whole run first, and hands the run
+        to the scalar kernel if not.
+
+    The last few samples that don't fill a vector are done by the scalar kernel.
+
+    Copyright (C) 2026, the Playtune_synth contributors (MIT license; see LICENSE.txt)
+*/
+
+#include <string.h>
+#include <time.h>
+#include "playtune_simd.h"
+#include "synth_Playtune_dsp.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+#define HAVE_X86_KERNELS 1
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized" // false alarms from GCC's own AVX-512 headers (GCC bug 105593)
+#endif
+#endif
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define HAVE_NEON_KERNEL 1
+#endif
+
+void playtune_render_scalar(struct playtune_run_t *run, int32_t *mix, int count) {
+  const int16_t *waveform = run->waveform;
+  uint32_t tone_phase = run->tone_phase, tone_incr = run->tone_incr, index_mask = run->index_mask;
+  int index_shift = run->index_shift, scale_shift = run->index_shift - 16;
+  int32_t env_mult = run->env_mult, env_incr = run->env_incr;
+  int32_t gain_frac = run->gain_frac;
+  for (int sample = 0; sample < count; ++sample) {
+    uint32_t index1 = tone_phase >> index_shift;
+    uint32_t index2 = (index1 + 1) & index_mask;
+    uint32_t scale = (tone_phase >> scale_shift) & 0xFFFF;
+    int32_t interpolated = playtune_interpolate(waveform[index1], waveform[index2], scale);
+    tone_phase = (tone_phase + tone_incr) & 0x7fffffff;
+    // (with no envelope, env_mult is 1.0 and this gives the same result as playtune_mix)
+    mix[sample] = playtune_mix_enveloped(mix[sample], interpolated, env_mult, gain_frac);
+    env_mult += env_incr;
+  }
+  run->tone_phase = tone_phase;
+  run->env_mult = env_mult;
+}
+
+// Can a vector kernel do this run exactly with 32-bit multiplies?
+
+static bool vector_run_ok(const struct playtune_run_t *run, int count) {
+  int64_t env_last = run->env_mult + (int64_t)(count - 1) * run->env_incr;
+  return run->gain_frac >= 0 && run->gain_frac <= 0x10000
+         && run->env_mult >= 0 && run->env_mult <= 0x10000
+         && env_last >= 0 && env_last <= 0x10000;
+}
+
+// Advance the run past the samples a vector kernel did, and let the scalar kernel do the rest
+
+static void finish_run(struct playtune_run_t *run, int32_t *mix, int done, int count) {
+  run->tone_phase = (run->tone_phase + (uint32_t)done * run->tone_incr) & 0x7fffffff;
+  run->env_mult = (int32_t)((uint32_t)run->env_mult + (uint32_t)done * (uint32_t)run->env_incr);
+  playtune_render_scalar(run, mix + done, count - done);
+}
+
+#if HAVE_X86_KERNELS
+
+// SSE4.1, 4 samples at a time. There is no gather instruction, so the waveform points are
+// loaded one at a time, but all the arithmetic is done in the vector registers.
+
+__attribute__((target("sse4.1")))
+static void render_sse41(struct playtune_run_t *run, int32_t *mix, int count) {
+  if (!vector_run_ok(run, count)) {
+    playtune_render_scalar(run, mix, count);
+    return;
+  }
+  const int16_t *waveform = run->waveform;
+  const __m128i lanes = _mm_setr_epi32(0, 1, 2, 3);
+  const __m128i phase_mask = _mm_set1_epi32(0x7fffffff), fraction_mask = _mm_set1_epi32(0xFFFF);
+  const __m128i index_shift = _mm_cvtsi32_si128(run->index_shift), scale_shift = _mm_cvtsi32_si128(run->index_shift - 16);
+  const __m128i gain_frac = _mm_set1_epi32(run->gain_frac);
+  const __m128i phase_step = _mm_set1_epi32(run->tone_incr * 4), env_step = _mm_set1_epi32(run->env_incr * 4);
+  const uint32_t index_mask = run->index_mask;
+  __m128i tone_phase = _mm_and_si128(_mm_add_epi32(_mm_set1_epi32(run->tone_phase),
+                                     _mm_mullo_epi32(lanes, _mm_set1_epi32(run->tone_incr))), phase_mask);
+  __m128i env_mult = _mm_add_epi32(_mm_set1_epi32(run->env_mult), _mm_mullo_epi32(lanes, _mm_set1_epi32(run->env_incr)));
+  int sample;
+  for (sample = 0; sample + 4 <= count; sample += 4) {
+    __m128i index1 = _mm_srl_epi32(tone_phase, index_shift);
+    __m128i scale = _mm_and_si128(_mm_srl_epi32(tone_phase, scale_shift), fraction_mask);
+    uint32_t i0 = _mm_cvtsi128_si32(index1), i1 = _mm_extract_epi32(index1, 1),
+             i2 = _mm_extract_epi32(index1, 2), i3 = _mm_extract_epi32(index1, 3);
+    __m128i val1 = _mm_setr_epi32(waveform[i0], waveform[i1], waveform[i2], waveform[i3]);
+    __m128i val2 = _mm_setr_epi32(waveform[(i0 + 1) & index_mask], waveform[(i1 + 1) & index_mask],
+                                  waveform[(i2 + 1) & index_mask], waveform[(i3 + 1) & index_mask]);
+    __m128i level = _mm_add_epi32(_mm_mullo_epi32(val1, fraction_mask), _mm_mullo_epi32(_mm_sub_epi32(val2, val1), scale));
+    level = _mm_srai_epi32(level, 16);
+    level = _mm_srai_epi32(_mm_mullo_epi32(env_mult, level), 16);
+    level = _mm_srai_epi32(_mm_mullo_epi32(gain_frac, level), 16);
+    _mm_storeu_si128((__m128i *)(mix + sample), _mm_add_epi32(_mm_loadu_si128((__m128i *)(mix + sample)), level));
+    tone_phase = _mm_and_si128(_mm_add_epi32(tone_phase, phase_step), phase_mask);
+    env_mult = _mm_add_epi32(env_mult, env_step);
+  }
+  finish_run(run, mix, sample, count);
+}
+
+// AVX2, 8 samples at a time. Each lane gathers the pair of 16-bit waveform points starting at
+// its index with one 32-bit load. For an instrument's last point, whose successor wraps around
+// to the first, the lane loads the pair ending there instead and takes the first point from a
+// register. A percussion waveform is never played past its next-to-last point.
+
+__attribute__((target("avx2")))
+static void render_avx2(struct playtune_run_t *run, int32_t *mix, int count) {
+  if (!vector_run_ok(run, count)) {
+    playtune_render_scalar(run, mix, count);
+    return;
+  }
+  const int *waveform = (const int *) run->waveform;
+  const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  const __m256i phase_mask = _mm256_set1_epi32(0x7fffffff), fraction_mask = _mm256_set1_epi32(0xFFFF);
+  const __m128i index_shift = _mm_cvtsi32_si128(run->index_shift), scale_shift = _mm_cvtsi32_si128(run->index_shift - 16);
+  const __m256i last_index = _mm256_set1_epi32(run->index_mask), pair_limit = _mm256_set1_epi32(run->index_mask - 1);
+  const __m256i first_point = _mm256_set1_epi32(run->waveform[0]);
+  const __m256i gain_frac = _mm256_set1_epi32(run->gain_frac);
+  const __m256i phase_step = _mm256_set1_epi32(run->tone_incr * 8), env_step = _mm256_set1_epi32(run->env_incr * 8);
+  __m256i tone_phase = _mm256_and_si256(_mm256_add_epi32(_mm256_set1_epi32(run->tone_phase),
+                                        _mm256_mullo_epi32(lanes, _mm256_set1_epi32(run->tone_incr))), phase_mask);
+  __m256i env_mult = _mm256_add_epi32(_mm256_set1_epi32(run->env_mult),
+                                      _mm256_mullo_epi32(lanes, _mm256_set1_epi32(run->env_incr)));
+  int sample;
+  for (sample = 0; sample + 8 <= count; sample += 8) {
+    __m256i index1 = _mm256_srl_epi32(tone_phase, index_shift);
+    __m256i scale = _mm256_and_si256(_mm256_srl_epi32(tone_phase, scale_shift), fraction_mask);
+    __m256i pairs = _mm256_i32gather_epi32(waveform, _mm256_min_epu32(index1, pair_limit), 2);
+    __m256i low = _mm256_srai_epi32(_mm256_slli_epi32(pairs, 16), 16), high = _mm256_srai_epi32(pairs, 16);
+    __m256i wrap = _mm256_cmpeq_epi32(index1, last_index);
+    __m256i val1 = _mm256_blendv_epi8(low, high, wrap), val2 = _mm256_blendv_epi8(high, first_point, wrap);
+    __m256i level = _mm256_add_epi32(_mm256_mullo_epi32(val1, fraction_mask),
+                                     _mm256_mullo_epi32(_mm256_sub_epi32(val2, val1), scale));
+    level = _mm256_srai_epi32(level, 16);
+    level = _mm256_srai_epi32(_mm256_mullo_epi32(env_mult, level), 16);
+    level = _mm256_srai_epi32(_mm256_mullo_epi32(gain_frac, level), 16);
+    _mm256_storeu_si256((__m256i *)(mix + sample), _mm256_add_epi32(_mm256_loadu_si256((__m256i *)(mix + sample)), level));
+    tone_phase = _mm256_and_si256(_mm256_add_epi32(tone_phase, phase_step), phase_mask);
+    env_mult = _mm256_add_epi32(env_mult, env_step);
+  }
+  _mm256_zeroupper(); // (GCC doesn't do it for a target attribute, and the SSE code after us would pay for it)
+  finish_run(run, mix, sample, count);
+}
+
+// AVX-512, 16 samples at a time, the same way as AVX2
+
+__attribute__((target("avx512f")))
+static void render_avx512(struct playtune_run_t *run, int32_t *mix, int count) {
+  if (!vector_run_ok(run, count)) {
+    playtune_render_scalar(run, mix, count);
+    return;
+  }
+  const int *waveform = (const int *) run->waveform;
+  const __m512i lanes = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  const __m512i phase_mask = _mm512_set1_epi32(0x7fffffff), fraction_mask = _mm512_set1_epi32(0xFFFF);
+  const __m128i index_shift = _mm_cvtsi32_si128(run->index_shift), scale_shift = _mm_cvtsi32_si128(run->index_shift - 16);
+  const __m512i last_index = _mm512_set1_epi32(run->index_mask), pair_limit = _mm512_set1_epi32(run->index_mask - 1);
+  const __m512i first_point = _mm512_set1_epi32(run->waveform[0]);
+  const __m512i gain_frac = _mm512_set1_epi32(run->gain_frac);
+  const __m512i phase_step = _mm512_set1_epi32(run->tone_incr * 16), env_step = _mm512_set1_epi32(run->env_incr * 16);
+  __m512i tone_phase = _mm512_and_si512(_mm512_add_epi32(_mm512_set1_epi32(run->tone_phase),
+                                        _mm512_mullo_epi32(lanes, _mm512_set1_epi32(run->tone_incr))), phase_mask);
+  __m512i env_mult = _mm512_add_epi32(_mm512_set1_epi32(run->env_mult),
+                                      _mm512_mullo_epi32(lanes, _mm512_set1_epi32(run->env_incr)));
+  int sample;
+  for (sample = 0; sample + 16 <= count; sample += 16) {
+    __m512i index1 = _mm512_srl_epi32(tone_phase, index_shift);
+    __m512i scale = _mm512_and_si512(_mm512_srl_epi32(tone_phase, scale_shift), fraction_mask);
+    __m512i pairs = _mm512_i32gather_epi32(_mm512_min_epu32(index1, pair_limit), waveform, 2);
+    __m512i low = _mm512_srai_epi32(_mm512_slli_epi32(pairs, 16), 16), high = _mm512_srai_epi32(pairs, 16);
+    __mmask16 wrap = _mm512_cmpeq_epi32_mask(index1, last_index);
+    __m512i val1 = _mm512_mask_blend_epi32(wrap, low, high), val2 = _mm512_mask_blend_epi32(wrap, high, first_point);
+    __m512i level = _mm512_add_epi32(_mm512_mullo_epi32(val1, fraction_mask),
+                                     _mm512_mullo_epi32(_mm512_sub_epi32(val2, val1), scale));
+    level = _mm512_srai_epi32(level, 16);
+    level = _mm512_srai_epi32(_mm512_mullo_epi32(env_mult, level), 16);
+    level = _mm512_srai_epi32(_mm512_mullo_epi32(gain_frac, level), 16);
+    _mm512_storeu_si512(mix + sample, _mm512_add_epi32(_mm512_loadu_si512(mix + sample), level));
+    tone_phase = _mm512_and_si512(_mm512_add_epi32(tone_phase, phase_step), phase_mask);
+    env_mult = _mm512_add_epi32(env_mult, env_step);
+  }
+  _mm256_zeroupper();
+  finish_run(run, mix, sample, count);
+}
+
+#endif // HAVE_X86_KERNELS
+
+#if HAVE_NEON_KERNEL
+
+// NEON, 4 samples at a time, loading the waveform points one at a time as for SSE4.1
+
+static void render_neon(struct playtune_run_t *run, int32_t *mix, int count) {
+  if (!vector_run_ok(run, count)) {
+    playtune_render_scalar(run, mix, count);
+    return;
+  }
+  static const uint32_t lane_numbers[4] = {0, 1, 2, 3};
+  const int16_t *waveform = run->waveform;
+  const uint32x4_t lanes = vld1q_u32(lane_numbers);
+  const uint32x4_t phase_mask = vdupq_n_u32(0x7fffffff), fraction_mask = vdupq_n_u32(0xFFFF);
+  const int32x4_t index_shift = vdupq_n_s32(-run->index_shift), scale_shift = vdupq_n_s32(16 - run->index_shift);
+  const int32x4_t gain_frac = vdupq_n_s32(run->gain_frac);
+  const uint32x4_t phase_step = vdupq_n_u32(run->tone_incr * 4);
+  const int32x4_t env_step = vdupq_n_s32(run->env_incr * 4);
+  const uint32_t index_mask = run->index_mask;
+  uint32x4_t tone_phase = vandq_u32(vmlaq_u32(vdupq_n_u32(run->tone_phase), lanes, vdupq_n_u32(run->tone_incr)), phase_mask);
+  int32x4_t env_mult = vmlaq_s32(vdupq_n_s32(run->env_mult), vreinterpretq_s32_u32(lanes), vdupq_n_s32(run->env_incr));
+  int sample;
+  for (sample = 0; sample + 4 <= count; sample += 4) {
+    uint32_t index1[4];
+    int32_t points1[4], points2[4];
+    vst1q_u32(index1, vshlq_u32(tone_phase, index_shift));
+    int32x4_t scale = vreinterpretq_s32_u32(vandq_u32(vshlq_u32(tone_phase, scale_shift), fraction_mask));
+    for (int lane = 0; lane < 4; ++lane) {
+      points1[lane] = waveform[index1[lane]];
+      points2[lane] = waveform[(index1[lane] + 1) & index_mask];
+    }
+    int32x4_t val1 = vld1q_s32(points1), val2 = vld1q_s32(points2);
+    int32x4_t level = vmlaq_s32(vmulq_s32(val1, vreinterpretq_s32_u32(fraction_mask)), vsubq_s32(val2, val1), scale);
+    level = vshrq_n_s32(level, 16);
+    level = vshrq_n_s32(vmulq_s32(env_mult, level), 16);
+    level = vshrq_n_s32(vmulq_s32(gain_frac, level), 16);
+    vst1q_s32(mix + sample, vaddq_s32(vld1q_s32(mix + sample), level));
+    tone_phase = vandq_u32(vaddq_u32(tone_phase, phase_step), phase_mask);
+    env_mult = vaddq_s32(env_mult, env_step);
+  }
+  finish_run(run, mix, sample, count);
+}
+
+#endif // HAVE_NEON_KERNEL
+
+//------------------------------------------------------------------------------
+//  Kernel selection
+//------------------------------------------------------------------------------
+
+static const struct {
+  const char *name;
+  playtune_kernel_t *kernel;
+} kernels[] = {
+  {"scalar", playtune_render_scalar},
+#if HAVE_X86_KERNELS
+  {"sse4.1", render_sse41},
+  {"avx2", render_avx2},
+  {"avx512", render_avx512},
+#endif
+#if HAVE_NEON_KERNEL
+  {"neon", render_neon},
+#endif
+};
+static const int num_kernels = sizeof(kernels) / sizeof(kernels[0]);
+
+static bool kernel_supported(int kernel) {
+#if HAVE_X86_KERNELS
+  __builtin_cpu_init(); // (we can be called during static initialization, before the C library has done it)
+  if (kernels[kernel].kernel == render_sse41) return __builtin_cpu_supports("sse4.1");
+  if (kernels[kernel].kernel == render_avx2) return __builtin_cpu_supports("avx2");
+  if (kernels[kernel].kernel == render_avx512) return __builtin_cpu_supports("avx512f");
+#endif
+  return true; // scalar, and NEON, which every 64-bit ARM has
+}
+
+static double seconds_now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// How long a kernel takes for some runs like the ones a score makes: instrument notes over the
+// whole range, in full blocks and in the short runs between envelope changes, and percussion.
+// A wider kernel isn't faster on every processor, because gathers and wide multiplies cost more
+// on some than on others, so we time them rather than guess.
+
+static double time_kernel(playtune_kernel_t *kernel) {
+  static int16_t waveform[1024];
+  static int32_t mix[128];
+  static const int counts[] = {128, 128, 128, 37, 128, 8, 128, 91};
+  for (int point = 0; point < 1024; ++point) waveform[point] = (int16_t)(point * 2654435761u >> 16);
+  double best = 1e9;
+  for (int pass = 0; pass < 3; ++pass) {
+    double start = seconds_now();
+    for (int run_number = 0; run_number < 2000; ++run_number) {
+      bool percussion = run_number % 8 == 7;
+      struct playtune_run_t run = {
+        waveform, percussion ? 0 : (uint32_t)run_number << 20 & 0x7fffffff,
+        percussion ? 1u << 17 : 0x00100000u << (run_number % 6), percussion ? 17 : 23, percussion ? 0xffffffffu : 0xffu, 0x8000, run_number % 2 ? -16 : 0, 0x4000
+      };
+      kernel(&run, mix, counts[run_number % 8]);
+    }
+    double seconds = seconds_now() - start;
+    if (seconds < best) best = seconds;
+  }
+  return best;
+}
+
+// The fastest kernel this processor can run, found the first time we're asked
+
+static int best_kernel(void) {
+  static int best = -1;
+  if (best < 0) {
+    double best_time = 0;
+    for (int kernel = 0; kernel < num_kernels; ++kernel)
+      if (kernel_supported(kernel)) {
+        double kernel_time = time_kernel(kernels[kernel].kernel);
+        if (best < 0 || kernel_time < best_time) best = kernel, best_time = kernel_time;
+      }
+  }
+  return best;
+}
+
+playtune_kernel_t *playtune_render_kernel = kernels[best_kernel()].kernel;
+const char *playtune_render_kernel_name = kernels[best_kernel()].name;
+
+bool playtune_select_kernel(const char *name) {
+  int kernel;
+  if (strcmp(name, "auto") == 0) kernel = best_kernel();
+  else {
+    for (kernel = 0; kernel < num_kernels && strcmp(name, kernels[kernel].name) != 0; ++kernel) ;
+    if (kernel >= num_kernels || !kernel_supported(kernel)) return false;
+  }
+  playtune_render_kernel = kernels[kernel].kernel;
+  playtune_render_kernel_name = kernels[kernel].name;
+  return true;
+}
+
+int playtune_available_kernels(const char **names, int max_names) {
+  int count = 0;
+  for (int kernel = 0; kernel < num_kernels && count < max_names; ++kernel)
+    if (kernel_supported(kernel)) names[count++] = kernels[kernel].name;
+  return count;
+}
@@ -0,0 +1,50 @@
+/* playtune_simd.h
+
+    Vectorized kernels for rendering runs of samples from one synth_Playtune tone generator
+    on a host machine, for batch rendering of scores much faster than the scalar code.
+    They do 4, 8 or 16 samples at a time using SSE4.1, AVX2 or AVX-512 on x86 processors,
+    whichever is the fastest when they are timed at run time, or NEON on 64-bit ARM.
+    Every kernel's output is bit-for-bit identical to that of the scalar kernel, which does
+    exactly what the Teensy code does. playtune_bench -c checks that.
+
+    The host build compiles synth_Playtune.cpp with PLAYTUNE_HOST_SIMD defined, which makes
+    it render through playtune_render_kernel instead of its own loops.
+
+    Copyright (C) 2026, the Playtune_synth contributors (MIT license; see LICENSE.txt)
+*/
+
+#ifndef playtune_simd_h_
+#define playtune_simd_h_
+
+#include <stdint.h>
+
+// A run of samples from one tone generator, during which nothing changes but the
+// waveform phase and the envelope multiplier.
+struct playtune_run_t {
+  const int16_t *waveform; // the waveform sample array
+  uint32_t tone_phase;     // where we are in it: index in the top bits, then 16 bits of fraction
+  uint32_t tone_incr;      // the increment from one sample to the next
+  int index_shift;         // how far to shift tone_phase to get the index: 23 for instruments, 17 for percussion
+  uint32_t index_mask;     // mask for the index of the next point: 0xff to wrap around instruments' 256 points,
+  //                          0xffffffff for percussion, which never goes past the end
+  int32_t env_mult, env_incr; // envelope multiplier and increment, as fractions * 2^16 (0x10000 and 0 for none)
+  int32_t gain_frac;       // note volume times mixer attenuation, as a fraction * 2^16
+};
+
+// Add count samples of the run to mix[], and leave tone_phase and env_mult where they end up.
+typedef void playtune_kernel_t(struct playtune_run_t *run, int32_t *mix, int count);
+
+extern playtune_kernel_t *playtune_render_kernel; // the kernel to use; initially the fastest one available
+extern const char *playtune_render_kernel_name;
+
+playtune_kernel_t playtune_render_scalar;
+
+// Choose a kernel by name: scalar, sse4.1, avx2, avx512, neon, or auto for the fastest one available.
+// Return false if the name is unknown or this processor can't run that kernel.
+bool playtune_select_kernel(const char *name);
+
+// List the kernels this processor can run, for programs that want to try them all.
+// Return the number of names stored into names[], at most max_names.
+int playtune_available_kernels(const char **names, int max_names);
+
+#endif
@@ -0,0 +1,42 @@
+/* utility/dspinst.h
+
+    Portable C versions of the Teensy Audio Library's DSP instruction wrappers,
+    for building synth_Playtune on a host machine. They compute exactly what the
+    Cortex-M4 instructions do.
+
+    Copyright (C) 2026, the Playtune_synth contributors (MIT license; see LICENSE.txt)
+*/
+
+#ifndef dspinst_h_
+#define dspinst_h_
+
+#include <stdint.h>
+
+// computes ((a[31:0] * b[15:0]) >> 16), like the SMULWB instruction
+static inline int32_t signed_multiply_32x16b(int32_t a, uint32_t b) {
+  return ((int64_t)a * (int16_t)(b & 0xFFFF)) >> 16;
+}
+
+// computes ((a[31:0] * b[31:16]) >> 16), like the SMULWT instruction
+static inline int32_t signed_multiply_32x16t(int32_t a, uint32_t b) {
+  return ((int64_t)a * (int16_t)(b >> 16)) >> 16;
+}
+
+// computes (sum + ((a[31:0] * b[15:0]) >> 16)), like the SMLAWB instruction
+static inline int32_t signed_multiply_accumulate_32x16b(int32_t sum, int32_t a, uint32_t b) {
+  return sum + (int32_t)(((int64_t)a * (int16_t)(b & 0xFFFF)) >> 16);
+}
+
+// computes (sum + ((a[31:0] * b[31:16]) >> 16)), like the SMLAWT instruction
+static inline int32_t signed_multiply_accumulate_32x16t(int32_t sum, int32_t a, uint32_t b) {
+  return sum + (int32_t)(((int64_t)a * (int16_t)(b >> 16)) >> 16);
+}
+
+// computes limit((val >> rshift), 2**bits), like the SSAT instruction
+static inline int32_t signed_saturate_rshift(int32_t val, int bits, int rshift) {
+  int32_t max = ((int32_t)1 << (bits - 1)) - 1, min = -max - 1;
+  int32_t out = val >> rshift;
+  return out > max ? max : out < min ? min : out;
+}
+
+#endif
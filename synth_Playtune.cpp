@@ -125,35 +125,34 @@
 
 
 #include "Arduino.h"
-#include "synth_Playtune.h"
-#include "utility/dspinst.h"
-
-#define MIN_NOTE 21 // we only do the piano range
-#define MAX_NOTE 108
-#define NUM_NOTES (MAX_NOTE - MIN_NOTE + 1)
-
-#define INT_MAX 0x7FFFFFFF
-
-// well-tempered MIDI note frequencies, based on the 12th root of 2.
-const uint32_t freq4096 [NUM_NOTES] PROGMEM = {   // note frequencies * 4096
-  /* 21..108*/ 112640, 119338, 126434, 133952, 141918, 150356, 159297,
-  168769, 178805, 189437, 200702, 212636, 225280, 238676, 252868,
-  267905, 283835, 300713, 318594, 337539, 357610, 378874, 401403,
-  425272, 450560, 477352, 505737, 535809, 567670, 601425, 637188,
-  675077, 715219, 757749, 802807, 850544, 901120, 954703, 1011473,
-  1071618, 1135340, 1202851, 1274376, 1350154, 1430439, 1515497,
-  1605613, 1701088, 1802240, 1909407, 2022946, 2143237, 2270680,
-  2405702, 2548752, 2700309, 2860878, 3030994, 3211227, 3402176,
-  3604480, 3818814, 4045892, 4286473, 4541360, 4811404, 5097505,
-  5400618, 5721755, 6061989, 6422453, 6804352, 7208960, 7637627,
-  8091784, 8572947, 9082720, 9622807, 10195009, 10801236, 11443511,
-  12123977, 12844906, 13608704, 14417920, 15275254, 16183568,
-  17145893
+#include "synth_Playtune.h" // (which includes the member functions, in synth_Playtune_impl.h)
+#include "synth_Playtune_dsp.h"
+
+// Well-tempered MIDI note frequencies, based on the 12th root of 2, times 4096 and rounded,
+// and the increments that step through a 256-point waveform at those frequencies (2^23 per point).
+// These are all worked out at compile time for whatever the sample rate is, so starting a note
+// just looks up its increment.
+
+constexpr uint32_t note_freq4096(int note) {
+  return (uint32_t)(440.0 * 4096 * playtune_exp((note - 69) * (0.6931471805599453 /* ln(2) */ / 12)) + 0.5);
+}
+constexpr uint32_t note_tone_incr(int note, double sample_rate) {
+  return (uint32_t)((uint64_t)note_freq4096(note) * 0x80000 / (uint64_t)sample_rate);
+}
+#define TONE_INCRS_8(note) \
+  note_tone_incr(note, AUDIO_SAMPLE_RATE), note_tone_incr(note + 1, AUDIO_SAMPLE_RATE), \
+  note_tone_incr(note + 2, AUDIO_SAMPLE_RATE), note_tone_incr(note + 3, AUDIO_SAMPLE_RATE), \
+  note_tone_incr(note + 4, AUDIO_SAMPLE_RATE), note_tone_incr(note + 5, AUDIO_SAMPLE_RATE), \
+  note_tone_incr(note + 6, AUDIO_SAMPLE_RATE), note_tone_incr(note + 7, AUDIO_SAMPLE_RATE)
+const uint32_t tone_incrs [NUM_NOTES] PROGMEM = { // for notes MIN_NOTE..MAX_NOTE
+  TONE_INCRS_8(21), TONE_INCRS_8(29), TONE_INCRS_8(37), TONE_INCRS_8(45), TONE_INCRS_8(53), TONE_INCRS_8(61),
+  TONE_INCRS_8(69), TONE_INCRS_8(77), TONE_INCRS_8(85), TONE_INCRS_8(93), TONE_INCRS_8(101)
 };
 
-// 16-channel mixer levels.  The same levels currently apply to all inputs.
+// Mixer levels for up to 32 channels, as many as the bit mask of the tone generators playing can have,
+// whatever MAX_TGENS is.  The same levels currently apply to all inputs.
 
-extern const int32_t mixer_amplitude_fractions[MAX_TGENS + 1] = { //0..16 tone generators playing
+extern const int32_t mixer_amplitude_fractions[MIXER_LEVELS] = { //0..32 tone generators playing
   /* Fractional amount (times 2^16) to reduce tone generator volume based on how many tone generators we're mixing.
      We are pretty conservative, assuming that highs won't often be coincident and our clipping when it happens
      won't be too annoying. This is pretty arbitrary, and YMMV. */
@@ -162,7 +161,11 @@ extern const int32_t mixer_amplitude_fractions[MAX_TGENS + 1] = { //0..16 tone g
   //        1             2             3             4             5             6            7              8
   fract16(1.0), fract16(.60), fract16(.50), fract16(.40), fract16(.30), fract16(.25), fract16(.23), fract16(.20),
   //        9            10            11            12            13           14             15            16
-  fract16(.18), fract16(.16), fract16(.15), fract16(.14), fract16(.13), fract16(.12), fract16(.11), fract16(.10)
+  fract16(.18), fract16(.16), fract16(.15), fract16(.14), fract16(.13), fract16(.12), fract16(.11), fract16(.10),
+  // 17 to 32: the same overall level as for 16
+#define past16(n) fract16((1.6 / (n)))
+  past16(17), past16(18), past16(19), past16(20), past16(21), past16(22), past16(23), past16(24),
+  past16(25), past16(26), past16(27), past16(28), past16(29), past16(30), past16(31), past16(32)
 };
 
 //***********  REGULAR AND PERCUSSION INSTRUMENTS  ****************
@@ -188,39 +191,85 @@ extern const int16_t waveform_oboe_0002[256] PROGMEM;
 extern const int16_t waveform_piano_0013[256] PROGMEM;
 extern const int16_t waveform_violin_0003[256] PROGMEM;
 
-// (2) add an initializer for a new element in this array of structures.
+//     and to its band-limited copies in synth_Playtune_mipmaps.cpp, which you make by adding the
+//     wave table to the list in host/playtune_mipmaps.cpp and running it (see BANDLIMITED_WAVES)
+
+#if BANDLIMITED_WAVES
+extern const int16_t waveform_aguitar_0033_mipmaps[WAVE_MIPMAPS][256] PROGMEM;
+extern const int16_t waveform_altosax_0001_mipmaps[WAVE_MIPMAPS][256] PROGMEM;
+extern const int16_t waveform_birds_0011_mipmaps[WAVE_MIPMAPS][256] PROGMEM;
+extern const int16_t waveform_cello_0005_mipmaps[WAVE_MIPMAPS][256] PROGMEM;
+extern const int16_t waveform_clarinett_0001_mipmaps[WAVE_MIPMAPS][256] PROGMEM;
+extern const int16_t waveform_clavinet_0021_mipmaps[WAVE_MIPMAPS][256] PROGMEM;
+extern const int16_t waveform_dbass_0015_mipmaps[WAVE_MIPMAPS][256] PROGMEM;
+extern const int16_t waveform_ebass_0037_mipmaps[WAVE_MIPMAPS][256] PROGMEM;
+extern const int16_t waveform_eguitar_0002_mipmaps[WAVE_MIPMAPS][256] PROGMEM;
+extern const int16_t waveform_eorgan_0064_mipmaps[WAVE_MIPMAPS][256] PROGMEM;
+extern const int16_t waveform_epiano_0044_mipmaps[WAVE_MIPMAPS][256] PROGMEM;
+extern const int16_t waveform_flute_0001_mipmaps[WAVE_MIPMAPS][256] PROGMEM;
+extern const int16_t waveform_oboe_0002_mipmaps[WAVE_MIPMAPS][256] PROGMEM;
+extern const int16_t waveform_piano_0013_mipmaps[WAVE_MIPMAPS][256] PROGMEM;
+extern const int16_t waveform_violin_0003_mipmaps[WAVE_MIPMAPS][256] PROGMEM;
+#endif
+
+// (2) add an initializer for a new element in this array of structures, using the INSTRUMENT macro.
 //     It contains a pointer to the wave table, the DAHDSR envelope times in msec,
-//     and the fraction of full volume that is the "sustain" volume.
+//     the release time with EXP_ENVELOPE, and the fraction of full volume that is the "sustain" volume.
+//     An exponential release can be shorter than a linear one, because it falls off faster at first
+//     and then fades out smoothly, without a click at the end; and then the note's voice is free sooner.
+//     The macro also works out the envelope increments for the attack, decay, and release
+//     phases at compile time, so that no division is needed when a note changes phase,
+//     and the multipliers for exponential decay and release (see EXP_ENVELOPE).
+//     With BANDLIMITED_WAVES, it also points to the band-limited copies of the wave table.
 
 struct instrument_waveform_t {
   const int16_t *waveforms; // pointer to the 256-element waveform array
-  const int delay, attack, hold, decay, release;  // count of of samples for envelope each phase
-  const int32_t sustain_level;  // envelope level for sustain, as a fraction * 2^16
+  const struct playtune_envelope_t envelope; // sample counts, levels, and increments (see synth_Playtune_bank.h)
+#if BANDLIMITED_WAVES
+  const int16_t (*mipmaps)[256]; // band-limited copies of the waveform, for higher notes
+#define MIPMAPS(waveform) , waveform##_mipmaps
+#else
+#define MIPMAPS(waveform)
+#endif
 #define ms2cnt(ms) ((int32_t)(ms*AUDIO_SAMPLE_RATE/1000)) // we define the delays as # of milliseconds
 #define lv2fr(lv) ((int32_t)(lv*65536.0)) // and the level as a fraction * 2^16
+#define envincr(from, to, count) ((count) ? ((to) - (from)) / (count) : 0) // (a phase with no samples never uses it)
+// An exponential phase gets to within EXP_ENV_RESIDUE of where it's going by its end, when it jumps there.
+#define EXP_ENV_RESIDUE 0.001 // -60 dB
+#define envmult(count) ((count) ? (uint32_t)(playtune_exp(-6.907755278982137 /* ln(EXP_ENV_RESIDUE) */ / (count)) * 4294967296.0) : 0)
+#if EXP_ENVELOPE
+#define RELEASE(linear, exponential) exponential
+#else
+#define RELEASE(linear, exponential) linear
+#endif
+#define INSTRUMENT(waveform, delay, attack, hold, decay, release, exp_release, level) \
+  {waveform, {ms2cnt(delay), ms2cnt(attack), ms2cnt(hold), ms2cnt(decay), ms2cnt(RELEASE(release, exp_release)), lv2fr(level), \
+   envincr(0, 0x10000, ms2cnt(attack)), envincr(0x10000, lv2fr(level), ms2cnt(decay)), envincr(lv2fr(level), 0, ms2cnt(release)), \
+   envmult(ms2cnt(decay)), envmult(ms2cnt(exp_release))} MIPMAPS(waveform)}
 #define DF_DL 0     // defaults in msec for delay, 
 #define DF_AT 10    //   attack,
 #define DF_HL 2     //   hold,
 #define DF_DC 30    //   decay
-#define DF_RL 30    //   release
+#define DF_RL 30    //   release,
+#define DF_XR 20    //   exponential release
 #define DF_LV 0.60  // default for sustain amplitude level
 } // some audio expert should tweak the envelope for each instrument independently!
 instrument_waveforms[] = {// this order must match the enum below
-  {waveform_aguitar_0033, ms2cnt(DF_DL), ms2cnt(DF_AT), ms2cnt(DF_HL), ms2cnt(DF_DC), ms2cnt(DF_RL), lv2fr(DF_LV)},
-  {waveform_altosax_0001, ms2cnt(DF_DL), ms2cnt(DF_AT), ms2cnt(DF_HL), ms2cnt(DF_DC), ms2cnt(DF_RL), lv2fr(DF_LV)},
-  {waveform_birds_0011, ms2cnt(DF_DL), ms2cnt(DF_AT), ms2cnt(DF_HL), ms2cnt(DF_DC), ms2cnt(DF_RL), lv2fr(DF_LV)},
-  {waveform_cello_0005, ms2cnt(DF_DL), ms2cnt(DF_AT), ms2cnt(DF_HL), ms2cnt(DF_DC), ms2cnt(DF_RL), lv2fr(DF_LV)},
-  {waveform_clarinett_0001, ms2cnt(DF_DL), ms2cnt(DF_AT), ms2cnt(DF_HL), ms2cnt(DF_DC), ms2cnt(DF_RL), lv2fr(DF_LV)},
-  {waveform_clavinet_0021, ms2cnt(DF_DL), ms2cnt(DF_AT), ms2cnt(DF_HL), ms2cnt(DF_DC), ms2cnt(DF_RL), lv2fr(DF_LV)},
-  {waveform_dbass_0015, ms2cnt(DF_DL), ms2cnt(DF_AT), ms2cnt(DF_HL), ms2cnt(DF_DC), ms2cnt(DF_RL), lv2fr(DF_LV)},
-  {waveform_ebass_0037, ms2cnt(DF_DL), ms2cnt(DF_AT), ms2cnt(DF_HL), ms2cnt(DF_DC), ms2cnt(DF_RL), lv2fr(DF_LV)},
-  {waveform_eguitar_0002, ms2cnt(DF_DL), ms2cnt(DF_AT), ms2cnt(DF_HL), ms2cnt(DF_DC), ms2cnt(DF_RL), lv2fr(DF_LV)},
-  {waveform_eorgan_0064, ms2cnt(DF_DL), ms2cnt(DF_AT), ms2cnt(DF_HL), ms2cnt(DF_DC), ms2cnt(DF_RL), lv2fr(DF_LV)},
-  {waveform_epiano_0044, ms2cnt(DF_DL), ms2cnt(DF_AT), ms2cnt(DF_HL), ms2cnt(DF_DC), ms2cnt(DF_RL), lv2fr(DF_LV)},
-  {waveform_flute_0001, ms2cnt(DF_DL), ms2cnt(DF_AT), ms2cnt(DF_HL), ms2cnt(DF_DC), ms2cnt(DF_RL), lv2fr(DF_LV)},
-  {waveform_oboe_0002, ms2cnt(DF_DL), ms2cnt(DF_AT), ms2cnt(DF_HL), ms2cnt(DF_DC), ms2cnt(DF_RL), lv2fr(DF_LV)},
-  {waveform_piano_0013, ms2cnt(DF_DL), ms2cnt(DF_AT), ms2cnt(DF_HL), ms2cnt(DF_DC), ms2cnt(60), lv2fr(DF_LV)},
-  {waveform_violin_0003, ms2cnt(DF_DL), ms2cnt(DF_AT), ms2cnt(DF_HL), ms2cnt(DF_DC), ms2cnt(DF_RL), lv2fr(DF_LV)}
+  INSTRUMENT(waveform_aguitar_0033, DF_DL, DF_AT, DF_HL, DF_DC, DF_RL, DF_XR, DF_LV),
+  INSTRUMENT(waveform_altosax_0001, DF_DL, DF_AT, DF_HL, DF_DC, DF_RL, DF_XR, DF_LV),
+  INSTRUMENT(waveform_birds_0011, DF_DL, DF_AT, DF_HL, DF_DC, DF_RL, DF_XR, DF_LV),
+  INSTRUMENT(waveform_cello_0005, DF_DL, DF_AT, DF_HL, DF_DC, DF_RL, DF_XR, DF_LV),
+  INSTRUMENT(waveform_clarinett_0001, DF_DL, DF_AT, DF_HL, DF_DC, DF_RL, DF_XR, DF_LV),
+  INSTRUMENT(waveform_clavinet_0021, DF_DL, DF_AT, DF_HL, DF_DC, DF_RL, DF_XR, DF_LV),
+  INSTRUMENT(waveform_dbass_0015, DF_DL, DF_AT, DF_HL, DF_DC, DF_RL, DF_XR, DF_LV),
+  INSTRUMENT(waveform_ebass_0037, DF_DL, DF_AT, DF_HL, DF_DC, DF_RL, DF_XR, DF_LV),
+  INSTRUMENT(waveform_eguitar_0002, DF_DL, DF_AT, DF_HL, DF_DC, DF_RL, DF_XR, DF_LV),
+  INSTRUMENT(waveform_eorgan_0064, DF_DL, DF_AT, DF_HL, DF_DC, DF_RL, DF_XR, DF_LV),
+  INSTRUMENT(waveform_epiano_0044, DF_DL, DF_AT, DF_HL, DF_DC, DF_RL, DF_XR, DF_LV),
+  INSTRUMENT(waveform_flute_0001, DF_DL, DF_AT, DF_HL, DF_DC, DF_RL, DF_XR, DF_LV),
+  INSTRUMENT(waveform_oboe_0002, DF_DL, DF_AT, DF_HL, DF_DC, DF_RL, DF_XR, DF_LV),
+  INSTRUMENT(waveform_piano_0013, DF_DL, DF_AT, DF_HL, DF_DC, 60, 40, DF_LV),
+  INSTRUMENT(waveform_violin_0003, DF_DL, DF_AT, DF_HL, DF_DC, DF_RL, DF_XR, DF_LV)
 };
 
 // (3) add a symbolic index name for your regular instrument at the end of this list
@@ -229,6 +278,7 @@ enum  instrument_index_t { // instrument indexes
   I_AGUITAR, I_SAX, I_BIRDS, I_CELLO, I_CLARINET, I_CLAVINET, I_DBASS, I_EBASS,
   I_EGUITAR, I_ORGAN, I_EPIANO, I_FLUTE, I_OBOE, I_PIANO, I_VIOLIN
 };
+extern const byte playtune_default_instrument = I_PIANO; // what a score plays until it changes instruments
 
 // (4) change whatever entries in this MIDI patch map corresponding to regular instruments
 // that you want your new wave sample to play for. (I didn't create enough different
@@ -258,30 +308,57 @@ const byte instrument_patch_map[128] PROGMEM = { // map from MIDI patch numbers
 // and keep the instruments in order!
 
 // (1) add an external reference here to the wave table you put in synth_Playtune_waves.c
-
+// (With COMPRESSED_PERCUSSION, also add it to host/playtune_adpcm.cpp and run that to
+// regenerate synth_Playtune_adpcm.cpp, and add the reference to the compressed table too.)
+
+#if COMPRESSED_PERCUSSION
+extern const uint8_t waveform_base_drum_04_adpcm[] PROGMEM;
+extern const uint8_t waveform_snare_drum_1_adpcm[] PROGMEM;
+extern const uint8_t waveform_mid_high_tom_adpcm[] PROGMEM;
+extern const uint8_t waveform_cymbal_2_adpcm[] PROGMEM;
+extern const uint8_t waveform_hi_bongo_adpcm[] PROGMEM;
+extern const uint8_t waveform_steel_bell_c6_adpcm[] PROGMEM;
+#else
 extern const int16_t waveform_base_drum_04[] PROGMEM;
 extern const int16_t waveform_snare_drum_1[] PROGMEM;
 extern const int16_t waveform_mid_high_tom[] PROGMEM;
 extern const int16_t waveform_cymbal_2[] PROGMEM;
 extern const int16_t waveform_hi_bongo[] PROGMEM;
 extern const int16_t waveform_steel_bell_c6[] PROGMEM;
+#endif
 
 // (2) put the pointer to your wave table at the end of this array, before the NULL
 
+#if COMPRESSED_PERCUSSION
+const uint8_t *drum_waveforms[] = {
+  waveform_base_drum_04_adpcm, waveform_snare_drum_1_adpcm, waveform_mid_high_tom_adpcm,
+  waveform_cymbal_2_adpcm, waveform_hi_bongo_adpcm, waveform_steel_bell_c6_adpcm,
+  NULL /* stopper so we can iterate over drum indexes */
+};
+#else
 const int16_t *drum_waveforms[] = {
   waveform_base_drum_04, waveform_snare_drum_1, waveform_mid_high_tom,
   waveform_cymbal_2, waveform_hi_bongo, waveform_steel_bell_c6,
   NULL /* stopper so we can iterate over drum indexes */
 };
+#endif
 
 // (3) put the size of it at the end of a table we refer to here that is
 // actually located at the bottom of synth_Playtune_waves.c
-extern const uint16_t drum_waveform_size[];
+// (or synth_Playtune_adpcm.cpp, which playtune_adpcm copies it to)
+extern const uint32_t drum_waveform_size[];
 
-// (4) add an element to the end of this array telling what the sampling frequency is
+// (4) add an element to the end of this array telling what the sampling frequency is.
+// It becomes the increment that steps through the wave table at that rate (2^17 per point),
+// which is worked out at compile time.
 
-const uint16_t drum_waveform_frequencies[] = {
-  4000, 8000, 8000, 8000, 4000, 4000
+constexpr uint32_t drum_tone_incr(int frequency, double sample_rate) {
+  return (uint32_t)((int64_t)frequency * 0x20000 / sample_rate);
+}
+const uint32_t drum_tone_incrs[] PROGMEM = {
+  drum_tone_incr(4000, AUDIO_SAMPLE_RATE), drum_tone_incr(8000, AUDIO_SAMPLE_RATE),
+  drum_tone_incr(8000, AUDIO_SAMPLE_RATE), drum_tone_incr(8000, AUDIO_SAMPLE_RATE),
+  drum_tone_incr(4000, AUDIO_SAMPLE_RATE), drum_tone_incr(4000, AUDIO_SAMPLE_RATE)
 };
 
 // (5) add a symbolic index name for the percussion instrument at the end of this list
@@ -307,336 +384,248 @@ const byte drum_patch_map[128] PROGMEM =  { // map from MIDI percussion instrume
 };
 #endif // DO_PERCUSSION
 
-//------------------------------------------------------------------------------
-//  Random byte generator
-//
-// This is an 8-bit version of the 2003 George Marsaglia XOR pseudo-random number
-// generator. It has a full period of 255 before repeating.
-// See http://www.arklyffe.com/main/2010/08/29/xorshift-pseudorandom-number-generator/
-//------------------------------------------------------------------------------
-static byte seed = 23;
-byte random_byte(void) {
-  seed ^= (byte)(seed << 7); // The casts are silly, but are needed to keep the AVR compiler
-  seed ^= (byte)(seed >> 5); // from generating "mul 128" for "<< 7"! Shifts are faster.
-  seed ^= (byte)(seed << 3);
-  return seed;
-}
+//***********  SAMPLE BANKS  ****************
 
-//------------------------------------------------------------------------------
-// Start playing a note on a particular tone generator
-//------------------------------------------------------------------------------
+// The sounds we play come from the tables above, or from a sample bank (see synth_Playtune_bank.h)
+// where we find everything by its offset from the start.
 
-void AudioSynthPlaytune::tune_playnote (byte tgen, byte note, byte vol) {
-  struct tone_gen_t *tg;
+#define bank_data(bank, offset) ((const byte *)(bank) + (offset))
+
+int playtune_num_instruments(const struct playtune_bank_t *bank) {
+  return bank ? bank->num_instruments : sizeof(instrument_waveforms) / sizeof(instrument_waveforms[0]);
+}
 
-  if (tgen < MAX_TGENS) {
-    tg = &tone_gen[tgen];
-    if (note >= 128) { // percussion instrument
+int playtune_num_drums(const struct playtune_bank_t *bank) {
 #if DO_PERCUSSION
-      int drum_enum = pgm_read_byte(drum_patch_map + note - 128);
-      tg->waveform_array = drum_waveforms [drum_enum];
-      //compute the increment to move from one sample point on the waveform to the next
-      tg->tone_incr = (int64_t) drum_waveform_frequencies[drum_enum] * 0x20000 / AUDIO_SAMPLE_RATE;
-      tg->tone_phase = 0; // start at the beginning
-      tg->drum_ending_sample_index = drum_waveform_size[drum_enum] - 1; // remember the end of the waveform
-      tg->percussion = true;
-      // percussion notes generally seem undermodulated, so we might double the volume we get and clip
-      if (BOOST_PERCUSSION) vol = vol > 63 ? 127 : vol << 1;
-#if DO_ENVELOPE
-      tg->env_mult = 0x10000;
-      tg->env_incr = 0;
+  return bank ? bank->num_drums : sizeof(drum_waveforms) / sizeof(drum_waveforms[0]) - 1; // (not the NULL)
+#else
+  return 0;
 #endif
+}
 
-#if DBUG
-      Serial.print("tgen="); Serial.print(tgen);
-      Serial.print(" drum="); Serial.print(drum_enum);
-      Serial.print(" vol="); Serial.print(vol);
-      Serial.print(" incr="); Serial.print(tg->tone_incr);
-      Serial.print(" phase="); Serial.println(tg->tone_phase);
-#endif
-#else //!DO_PERCUSSION
-      return; // ignore percussion note
-#endif
-    }
-    else  { // regular instrument
-      if (note < MIN_NOTE) note = MIN_NOTE;
-      if (note > MAX_NOTE) note = MAX_NOTE;
-      int instrument_index = tg->instrument_index;
-      tg->waveform_array = instrument_waveforms [instrument_index].waveforms;
-#if DO_ENVELOPE
-      tg->env_mult = 0; // setup AHDSR envelope
-      tg->env_count = instrument_waveforms [instrument_index].delay; // # of samples
-      // could be zero, but that will get dealt with at the first sample time.
-      tg->env_state = ENV_DELAY;
-      tg->env_incr = 0;
+int playtune_wave_mipmaps(const struct playtune_bank_t *bank) {
+  return bank ? bank->wave_mipmaps : BANDLIMITED_WAVES ? WAVE_MIPMAPS : 0;
+}
+
+static const struct playtune_bank_instrument_t *bank_instrument(const struct playtune_bank_t *bank, int instrument) {
+  return (const struct playtune_bank_instrument_t *) bank_data(bank, bank->instruments) + instrument;
+}
+
+const struct playtune_envelope_t *playtune_envelope(const struct playtune_bank_t *bank, int instrument) {
+  if ((unsigned)instrument >= (unsigned)playtune_num_instruments(bank)) instrument = 0;
+  if (bank) return &bank_instrument(bank, instrument)->envelope;
+  return &instrument_waveforms[instrument].envelope;
+}
+
+const int16_t *playtune_waveform(const struct playtune_bank_t *bank, int instrument, int level) {
+  if ((unsigned)instrument >= (unsigned)playtune_num_instruments(bank)) instrument = 0;
+  if (level > playtune_wave_mipmaps(bank)) level = playtune_wave_mipmaps(bank); // the highest we have
+  if (bank) return (const int16_t *) bank_data(bank, bank_instrument(bank, instrument)->waveforms) + level * 256;
+#if BANDLIMITED_WAVES
+  if (level > 0) return instrument_waveforms[instrument].mipmaps[level - 1];
 #endif
-      //compute the increment to move from one sample point on the waveform to the next
-      tg->tone_incr = ((uint64_t) (pgm_read_dword(freq4096 + (note - MIN_NOTE))) * 0x80000) / (uint64_t)AUDIO_SAMPLE_RATE;
-      //start at random place in the wave cycle to minimize phase lock cancellations
-      tg->tone_phase = random_byte() << 23;
-      tg->percussion = false;
-#if DBUG
-      Serial.print("tgen="); Serial.print(tgen);
-      Serial.print(" note="); Serial.print(note);
-      Serial.print(" vol="); Serial.print(vol);
-      Serial.print(" incr="); Serial.print(tg->tone_incr);
-      Serial.print(" phase="); Serial.println(tg->tone_phase);
+  return instrument_waveforms[instrument].waveforms;
+}
+
+byte playtune_instrument_patch(const struct playtune_bank_t *bank, byte program) {
+  program &= 0x7f;
+  return bank ? bank_data(bank, bank->instrument_patch_map)[program] : pgm_read_byte(instrument_patch_map + program);
+}
+
+byte playtune_drum_patch(const struct playtune_bank_t *bank, byte note) {
+  note &= 0x7f;
+#if DO_PERCUSSION
+  if (!bank) return pgm_read_byte(drum_patch_map + note);
 #endif
-    }
-    tg->volume_frac = ((int32_t)(vol & 0x7f) + 1) << 9; // 0x10000 to 0x0200
-    //Serial.print("vol frac "); Serial.print(tg->volume_frac); Serial.print(" ampl frac "); Serial.println(amplitude_fraction);
-    // tg->level = 0;
-    tg->playing = true;  // go!
+  return bank ? bank_data(bank, bank->drum_patch_map)[note] : 0;
+}
+
+const void *playtune_drum(const struct playtune_bank_t *bank, int drum, uint32_t *num_samples, uint32_t *tone_incr) {
+  *num_samples = *tone_incr = 0;
+  if (playtune_num_drums(bank) == 0) return NULL;
+  if ((unsigned)drum >= (unsigned)playtune_num_drums(bank)) drum = 0;
+  if (bank) {
+    const struct playtune_bank_drum_t *bank_drum = (const struct playtune_bank_drum_t *) bank_data(bank, bank->drums) + drum;
+    *num_samples = bank_drum->num_samples;
+    *tone_incr = bank_drum->tone_incr;
+    return bank_data(bank, bank_drum->waveform);
   }
+#if DO_PERCUSSION
+  *num_samples = drum_waveform_size[drum];
+  *tone_incr = pgm_read_dword(drum_tone_incrs + drum);
+  return drum_waveforms[drum];
+#else
+  return NULL;
+#endif
 }
 
-//------------------------------------------------------------------------------
-// Stop playing a note on a particular tone generator
-//------------------------------------------------------------------------------
+// Are there "bytes" bytes at "offset" in the bank, and are they aligned?
 
-void AudioSynthPlaytune::tune_stopnote (byte tgen) {
-  if (tgen < MAX_TGENS) {
-    struct tone_gen_t *tg = &tone_gen[tgen];
-    if (tg->playing) {
-#if DBUG
-      Serial.print("  stop tgen "); Serial.println(tgen);
-#endif
-#if DO_ENVELOPE
-      if (!tg->percussion) {
-        tg->env_state = ENV_RELEASE; // start release phase of a normal instrument note
-        // ramp the amplitude from the sustain level down to 0
-        tg->env_count = instrument_waveforms [tg->instrument_index].release;
-        tg->env_mult = instrument_waveforms [tg->instrument_index].sustain_level;
-        tg->env_incr = -tg->env_mult / tg->env_count; // ramp down to zero
-        // when the count becomes zero, the sample update function will set tg->playing to false
-      } else
+static bool bank_has(const struct playtune_bank_t *bank, uint32_t offset, uint64_t bytes) {
+  return offset % 4 == 0 && offset <= bank->total_bytes && bytes <= bank->total_bytes - offset;
+}
+
+const struct playtune_bank_t *playtune_check_bank(const void *data, uint32_t size) {
+  const struct playtune_bank_t *bank = (const struct playtune_bank_t *) data;
+  if (!data || (uintptr_t)data % 4 != 0 || size < sizeof(struct playtune_bank_t)
+      || memcmp(bank->id, PLAYTUNE_BANK_ID, 4) != 0 || bank->version != PLAYTUNE_BANK_VERSION
+      || bank->header_bytes < sizeof(struct playtune_bank_t) || bank->total_bytes > size
+      || bank->sample_rate != (uint32_t)(AUDIO_SAMPLE_RATE + 0.5) || bank->num_instruments == 0
+      || !bank_has(bank, bank->instruments, bank->num_instruments * sizeof(struct playtune_bank_instrument_t))
+      || !bank_has(bank, bank->instrument_patch_map, 128))
+    return NULL;
+  for (int instrument = 0; instrument < bank->num_instruments; ++instrument) {
+    const struct playtune_bank_instrument_t *bank_instr = bank_instrument(bank, instrument);
+    const struct playtune_envelope_t *envelope = &bank_instr->envelope;
+    if (!bank_has(bank, bank_instr->waveforms, (uint64_t)(1 + bank->wave_mipmaps) * 256 * sizeof(int16_t))
+        || envelope->delay < 0 || envelope->attack < 0 || envelope->hold < 0 || envelope->decay < 0
+        || envelope->release < 0 || envelope->sustain_level < 0 || envelope->sustain_level > 0x10000)
+      return NULL;
+  }
+  for (int program = 0; program < 128; ++program)
+    if (bank_data(bank, bank->instrument_patch_map)[program] >= bank->num_instruments) return NULL;
+#if DO_PERCUSSION // (otherwise we ignore the drums)
+  if (bank->num_drums) {
+    if ((bank->flags & PLAYTUNE_BANK_ADPCM) != (COMPRESSED_PERCUSSION ? PLAYTUNE_BANK_ADPCM : 0)
+        || !bank_has(bank, bank->drums, bank->num_drums * sizeof(struct playtune_bank_drum_t))
+        || !bank_has(bank, bank->drum_patch_map, 128))
+      return NULL;
+    for (int drum = 0; drum < bank->num_drums; ++drum) {
+      const struct playtune_bank_drum_t *bank_drum = (const struct playtune_bank_drum_t *) bank_data(bank, bank->drums) + drum;
+#if COMPRESSED_PERCUSSION
+      uint64_t bytes = ADPCM_BYTES((uint64_t)bank_drum->num_samples);
+#else
+      uint64_t bytes = (uint64_t)bank_drum->num_samples * sizeof(int16_t);
 #endif
-        tg->playing = false;
+      if (bank_drum->num_samples < 2 || !bank_has(bank, bank_drum->waveform, bytes)
+          || bank_drum->tone_incr == 0 || bank_drum->tone_incr >= 1 << 24) // (see tune_render_percussion)
+        return NULL;
     }
+    for (int note = 0; note < 128; ++note)
+      if (bank_data(bank, bank->drum_patch_map)[note] >= bank->num_drums) return NULL;
   }
+#endif
+  return bank;
 }
 
 //------------------------------------------------------------------------------
-// Stop playing a score
+//  Random byte generator
+//
+// This is an 8-bit version of the 2003 George Marsaglia XOR pseudo-random number
+// generator. It has a full period of 255 before repeating.
+// See http://www.arklyffe.com/main/2010/08/29/xorshift-pseudorandom-number-generator/
 //------------------------------------------------------------------------------
-
-void AudioSynthPlaytune::tune_stopscore(void) {
-  int i;
-  for (i = 0; i < MAX_TGENS; ++i)
-    tune_stopnote(i);
-  tune_playing = false;
+static byte seed = 23;
+byte random_byte(void) {
+  seed ^= (byte)(seed << 7); // The casts are silly, but are needed to keep the AVR compiler
+  seed ^= (byte)(seed >> 5); // from generating "mul 128" for "<< 7"! Shifts are faster.
+  seed ^= (byte)(seed << 3);
+  return seed;
 }
 
-//------------------------------------------------------------------------------
-//    Play a score
-//------------------------------------------------------------------------------
-
-void AudioSynthPlaytune::tune_playscore (const byte * score) { // start up the score
-  if (tune_playing) stop();
-  score_start = score;
-  volume_present = ASSUME_VOLUME;
-  num_tgens_used = MAX_TGENS;
-  for (byte tgen = 0; tgen < MAX_TGENS; ++tgen) // set default instrument
-    tone_gen[tgen].instrument_index = I_PIANO;
-
-  // look for the optional file header
+const byte *playtune_score_header(const byte *score, bool *volume_present, unsigned *num_tgens) {
+  struct file_hdr_t file_header;
   memcpy_P(&file_header, score, sizeof(file_hdr_t)); // copy possible header from PROGMEM to RAM
   if (file_header.id1 == 'P' && file_header.id2 == 't') { // validate it
-    volume_present = file_header.f1 & HDR_F1_VOLUME_PRESENT;
-    num_tgens_used = max(1, min(MAX_TGENS, file_header.num_tgens));
-#if DBUG
-    Serial.print("header: volume_present="); Serial.print(volume_present);
-    Serial.print(", #tonegens="); Serial.println(num_tgens_used);
-#endif
-    score_start += file_header.hdr_length; // skip the whole header
+    *volume_present = file_header.f1 & HDR_F1_VOLUME_PRESENT;
+    *num_tgens = file_header.num_tgens;
+    score += file_header.hdr_length; // skip the whole header
   }
-  // We will attentuate amplitudes prior to combining notes based on the
-  // worst-case number of notes that might be playing simultaneously.
-  amplitude_fraction = mixer_amplitude_fractions[num_tgens_used];
-#if DBUG
-  Serial.print("amplitude fraction is "); Serial.println(amplitude_fraction);
-#endif
-  score_cursor = score_start;
-  tune_stepscore();  /* execute initial the commands and return */
-  tune_playing = true;
+  return score;
+}
+
+const byte *playtune_decode_command(const byte *cursor, bool volume_present, struct playtune_event_t *event) {
+  byte cmd = pgm_read_byte(cursor++);
+  event->time = 0;
+  event->arg = event->vol = event->reserved = 0;
+  if (cmd < 0x80) { /* wait count in msec. */
+    unsigned scorewait_msec = ((unsigned)cmd << 8) | (pgm_read_byte(cursor++));
+    // (up to 32767 msec, so this fits in 32 bits)
+    event->time = scorewait_msec * (uint32_t)(AUDIO_SAMPLE_RATE + .5) / 1000;
+    cmd = CMD_WAIT;
+  }
+  else if ((cmd & 0xf0) == CMD_PLAYNOTE) {
+    event->arg = pgm_read_byte(cursor++); // argument evaluation order is undefined in C!
+    event->vol = volume_present ? pgm_read_byte(cursor++) : 127;
+  }
+  else if ((cmd & 0xf0) == CMD_INSTRUMENT)
+    event->arg = pgm_read_byte(cursor++);
+  event->cmd = cmd;
+  return cursor;
 }
 
-void AudioSynthPlaytune::tune_stepscore (void) { //*********   continue in the score
-  byte cmd, opcode, tgen, note, vol;
-  /* Do score commands until a "wait" is found, or the score is stopped.
-    This is called initially from tune_playscore, but then is called
-    from the slow interrupt routine when waits expire.
-  */
+uint32_t playtune_compile_score(const byte *score, bool volume_present, struct playtune_event_t *events,
+                                uint32_t max_events, unsigned *num_tgens) {
+  *num_tgens = 0;
+  const byte *cursor = playtune_score_header(score, &volume_present, num_tgens);
+  uint32_t time = 0, num_events = 0;
   while (1) {
-    cmd = pgm_read_byte(score_cursor++);
-    if (cmd < 0x80) { /* wait count in msec. */
-      /* wait count is in msec. */
-      int scorewait_msec = ((unsigned)cmd << 8) | (pgm_read_byte(score_cursor++));
-      scorewait_samples = (scorewait_msec * 1000 * (uint64_t)(AUDIO_SAMPLE_RATE + .5)) / 1000000;
-#if DBUG
-      Serial.print("wait samples = "); Serial.println(scorewait_samples);
-#endif
-      break;
-    }
-    opcode = cmd & 0xf0;
-    tgen = cmd & 0x0f;
-    if (opcode == CMD_STOPNOTE) { /* stop note */
-      tune_stopnote (tgen);
-    }
-    else if (opcode == CMD_PLAYNOTE) { /* play note */
-      note = pgm_read_byte(score_cursor++); // argument evaluation order is undefined in C!
-      vol = volume_present ? pgm_read_byte(score_cursor++) : 127;
-      tune_playnote (tgen, note, vol);
-    }
-    else if (opcode == CMD_INSTRUMENT) { /* change a tone generator's instrument */
-      tone_gen[tgen].instrument_index = pgm_read_byte(instrument_patch_map + pgm_read_byte(score_cursor++));
-    }
-    else if (opcode == CMD_RESTART) { /* restart the score */
-      score_cursor = score_start;
-    }
-    else if (opcode == CMD_STOP) { /* stop playing the score */
-      stop();
-      break;
+    struct playtune_event_t event;
+    cursor = playtune_decode_command(cursor, volume_present, &event);
+    if (event.cmd == CMD_WAIT) time += event.time;
+    else {
+      event.time = time;
+      if (num_events < max_events) events[num_events] = event;
+      ++num_events;
+      if ((event.cmd & 0xf0) == CMD_STOP || (event.cmd & 0xf0) == CMD_RESTART) break;
     }
   }
+  return num_events;
 }
 
-/*************************************************************************************************
-    Public interface functions
-*************************************************************************************************/
+//------------------------------------------------------------------------------
+// Seeking. A checkpoint is everything that a score's commands up to some point leave behind:
+// where the next command is, what time it is, and the instrument and note of each generator.
+// From the last checkpoint before the time we want, we only have to follow the commands for
+// a few seconds, without playing them, to know what to play there.
+//------------------------------------------------------------------------------
 
-void AudioSynthPlaytune::tune_init(void) {
-}
-void AudioSynthPlaytune::play(const byte *score) {
-  play(score, MAX_TGENS);
-}
-void AudioSynthPlaytune::play(const byte *score, unsigned int num_tgens) {
-  num_tgens_used = num_tgens;
-  tune_playscore(score);
-}
-bool AudioSynthPlaytune::isPlaying(void) {
-  return tune_playing;
-}
-void AudioSynthPlaytune::stop(void) {
-  tune_stopscore();
-}
-// for testing...
-void AudioSynthPlaytune::tune_setinstrument(byte tgen, byte instrument_index) {
-  tone_gen[tgen].instrument_index = instrument_index;
+static void checkpoint_start(struct playtune_checkpoint_t *state) {
+  state->offset = state->time = 0;
+  memset(state->program, NO_NOTE, sizeof(state->program));
+  memset(state->note, NO_NOTE, sizeof(state->note));
+  memset(state->vol, 0, sizeof(state->vol));
 }
 
-/*************************************************************************************************
-   Our interrupt-time "update" function, where all the dirty work gets done.
-   We are called every 2.9 msec, and must generate a block of 128 2-byte samples
-   as quickly as we can.
-*************************************************************************************************/
-
-void AudioSynthPlaytune::update(void) {
-  audio_block_t *block = allocate();
-  if (block) {
-    for (int sample = 0; sample < AUDIO_BLOCK_SAMPLES; ++sample) { // for all samples
-      // we use the sample processing interval (22.666 usec) as the timer for score waits
-      if (tune_playing && scorewait_samples && --scorewait_samples == 0) {
-        tune_stepscore ();  // end of a score wait, so execute more score commands
-      }
-#if DYNAMIC_VOLUME
-      int num_tgens_playing = 0;
-#endif
-      int level = 0;
-#if DYNAMIC_VOLUME // adjust the mixer input attentuation based on how many generators were last active
-      amplitude_fraction = mixer_amplitude_fractions[num_tgens_playing_last];
-#endif
-      for (byte tgen = 0; tgen < num_tgens_used; ++tgen) { // look at each tone generator
-        int our_level = 0;
-        struct tone_gen_t *tg = &tone_gen[tgen];
-        if (tg->playing) {
-          uint32_t index1, index2, scale;
-          int32_t val1, val2;
-#if DYNAMIC_VOLUME
-          ++num_tgens_playing;
-#endif
-          if (tg->percussion) { // percussion: play the waveform once
-            // tone_phase = +iiiiiiiiiiiiiiffffffffffffffffx, i=index into waveform array, f=fraction
-            index1 = tg->tone_phase >> 17; // 14 bits of index, 0..16383 max samples
-            index2 = index1 + 1;
-            if (index2 >= tg->drum_ending_sample_index)
-              tg->playing = false; // end of percussion waveform; stop playing soon
-            scale = (tg->tone_phase >> 1 ) & 0xFFFF; // 16 bits of fractional distance between samples
-          }
-          else { // regular instrument: repeat the waveform indefinitely
-            // tone_phase = +iiiiiiiiffffffffffffffffxxxxxxx, i=index into waveform array, f=fraction
-            index1 = tg->tone_phase >> 23; // 8 bits of index, 0..255 samples
-            index2 = (index1 + 1) & 0xff;  // wrap around at the end
-            scale = (tg->tone_phase >> 7) & 0xFFFF;  // 16 bits of fractional distance between samples
-#if DO_ENVELOPE
-            while (tg->env_count == 0) { // change to a state with a non-zero count
-              switch (tg->env_state) {
-                case ENV_IDLE:
-                  tg->env_count = INT_MAX;
-                  break;
-                case ENV_DELAY:
-                  tg->env_state = ENV_ATTACK;
-                  tg->env_count = instrument_waveforms [tg->instrument_index].attack;
-                  tg->env_incr = 0x10000 / tg->env_count; // ratchet up to maximum volume
-                  break;
-                case ENV_ATTACK:
-                  tg->env_state = ENV_HOLD;
-                  tg->env_count = instrument_waveforms [tg->instrument_index].hold;
-                  tg->env_mult = 0x10000; // hold this volume
-                  tg->env_incr = 0;
-                  break;
-                case ENV_HOLD:
-                  tg->env_state = ENV_DECAY;
-                  tg->env_count = instrument_waveforms [tg->instrument_index].decay;
-                  tg->env_mult = 0x10000; // start with max volume
-                  // count down to the sustain volume level
-                  tg->env_incr = (instrument_waveforms [tg->instrument_index].sustain_level - 0x10000) / tg->env_count;
-                  break;
-                case ENV_DECAY:
-                  tg->env_state = ENV_SUSTAIN;
-                  tg->env_count = INT_MAX;
-                  tg->env_mult = instrument_waveforms [tg->instrument_index].sustain_level;
-                  tg->env_incr = 0; // maintain the sustain volume level
-                  break;
-                case ENV_SUSTAIN:
-                  tg->env_count = INT_MAX; // (shouldn't happen; just keep on keeping on)
-                  break;
-                case ENV_RELEASE:
-                  tg->env_state = ENV_IDLE;
-                  tg->playing = false; // end of release: stop playing the note
-                  break;
-              }
-            } // while state count is zero
-            --tg->env_count; // count towards the next envelope state
-#endif // DO_ENVELOPE
-          } // regular instrument
-
-          // do a linear interpolation between the samples that bracket the waveform point
-          val1 = (int16_t)pgm_read_word(tg->waveform_array + index1);
-          val1 *= 0xFFFF - scale;
-          val2 = (int16_t)pgm_read_word(tg->waveform_array + index2);
-          val2 *= scale;
-          our_level = (val1 + val2) >> 16;
-          tg->tone_phase = (tg->tone_phase + tg->tone_incr) & 0x7fffffff; // advance to the next waveform point
-#if DO_ENVELOPE
-          our_level = signed_multiply_32x16b(tg->env_mult, our_level);  // envelope amplitude attenuation
-          tg->env_mult += tg->env_incr; // adjust attentuator
-#endif
-          // Mix all the tone generators together, scaling our current waveform amplitude by the volume of this
-          // this note, attenuated by the number of tone generators that might be (or really are?) playing.
-          level += signed_multiply_32x16b(tg->volume_frac, signed_multiply_32x16b(amplitude_fraction, our_level));
+// Follow a score command, other than a wait or the end, into a checkpoint
 
-        } // tone generator is playing
-      } // next tone generator
+void playtune_checkpoint_command(struct playtune_checkpoint_t *state, const struct playtune_event_t *event) {
+  byte tgen = event->cmd & 0x0f;
+  if (tgen >= MAX_TGENS) return;
+  switch (event->cmd & 0xf0) {
+    case CMD_STOPNOTE:
+      state->note[tgen] = NO_NOTE;
+      break;
+    case CMD_PLAYNOTE:
+      state->note[tgen] = event->arg;
+      state->vol[tgen] = event->vol;
+      break;
+    case CMD_INSTRUMENT:
+      state->program[tgen] = event->arg;
+      break;
+  }
+}
 
-      block->data[sample] = level; // clips at -32768..+32767
-#if DYNAMIC_VOLUME
-      num_tgens_playing_last = num_tgens_playing; // for the next sample, remember how many generators were playing
-#endif
+uint32_t playtune_index_score(const byte *score, bool volume_present, struct playtune_checkpoint_t *checkpoints,
+                              uint32_t max_checkpoints) {
+  unsigned num_tgens;
+  const byte *start = playtune_score_header(score, &volume_present, &num_tgens), *cursor = start;
+  struct playtune_checkpoint_t state;
+  checkpoint_start(&state);
+  uint32_t num_checkpoints = 0;
+  while (1) {
+    // (a long wait can pass more than one checkpoint time, so they all go here)
+    while (state.time >= num_checkpoints * CHECKPOINT_SAMPLES) {
+      state.offset = cursor - start;
+      if (num_checkpoints < max_checkpoints) checkpoints[num_checkpoints] = state;
+      ++num_checkpoints;
     }
-    transmit(block);
-    release(block);
+    struct playtune_event_t event;
+    do { // do the commands up to the next wait
+      cursor = playtune_decode_command(cursor, volume_present, &event);
+      if ((event.cmd & 0xf0) == CMD_STOP || (event.cmd & 0xf0) == CMD_RESTART) return num_checkpoints;
+      playtune_checkpoint_command(&state, &event);
+    } while (event.cmd != CMD_WAIT || event.time == 0);
+    state.time += event.time;
   }
 }
-
-
@@ -14,14 +14,76 @@
 
 #define DBUG 0             // output console debugging messages?
 
-#define MAX_TGENS 16        // maximum simultaneous tone generators
+// The following options can also be set on the compiler command line, for example -DDO_ENVELOPE=0
+// MAX_TGENS, ASSUME_VOLUME, DO_PERCUSSION, BOOST_PERCUSSION, DO_ENVELOPE and DYNAMIC_VOLUME are
+// what AudioSynthPlaytune has; an AudioSynthPlaytuneT can have fewer voices and other features.
+
+#ifndef MAX_TGENS
+#define MAX_TGENS 16        // maximum simultaneous tone generators, up to 32
+#endif
+#if MAX_TGENS > 32
+#error "MAX_TGENS must be no more than 32, the number of bits in tgens_playing"
+#endif
+#ifndef VOICE_POOL
+#define VOICE_POOL 0        // how many tone generators the score's channels share, allocating them to notes as they
+//                          // start, up to 32; or 0 for one fixed tone generator for each channel
+#endif
+#if VOICE_POOL > 32
+#error "VOICE_POOL must be no more than 32, the number of bits in tgens_playing"
+#endif
+#ifndef MAX_SCORES
+#define MAX_SCORES 2        // how many scores can play at once: the main one, and layers over it
+#endif
+#ifndef ASSUME_VOLUME
 #define ASSUME_VOLUME 0     // assume volume information is present in bytestream files without headers?
+#endif
 
-#define DO_PERCUSSION 1     // generate code for percussion instruments?
+#ifndef DO_PERCUSSION
+#define DO_PERCUSSION 1     // generate code and tables for percussion instruments?
+#endif
+#ifndef BOOST_PERCUSSION
 #define BOOST_PERCUSSION 0  // amplify percussion instruments?
+#endif
+#ifndef COMPRESSED_PERCUSSION
+#define COMPRESSED_PERCUSSION 0 // play percussion from IMA-ADPCM compressed waveforms?
+//                          // (They take about a quarter of the flash, so 3 or 4 times as many drums fit,
+//                          // at the cost of some quantization noise; see synth_Playtune_adpcm.cpp.)
+#endif
+#ifndef DO_ENVELOPE
 #define DO_ENVELOPE 1       // generate code to do DAHDSR tone amplitude envelope?
+#endif
+#ifndef EXP_ENVELOPE
+#define EXP_ENVELOPE 0      // make the envelope's decay and release exponential curves instead of linear ramps?
+//                          // (This changes how every instrument sounds, so it is off unless asked for.
+//                          // The releases are shorter too, so voices are free sooner; see synth_Playtune.cpp.)
+#endif
+#if EXP_ENVELOPE && !DO_ENVELOPE
+#error "EXP_ENVELOPE needs DO_ENVELOPE"
+#endif
+#ifndef BANDLIMITED_WAVES
+#define BANDLIMITED_WAVES 0 // play higher notes from band-limited copies of the instrument waveforms, to avoid aliasing?
+//                          // (This changes how the higher notes of every instrument sound, so it is off unless asked
+//                          // for, and it takes about 3.5K bytes of flash per instrument; see synth_Playtune_mipmaps.cpp.)
+#endif
+#ifndef STREAM_BUFFER_BYTES
+#define STREAM_BUFFER_BYTES 512 // the ring buffer for a score streamed from a file, a power of 2, or 0 for none
+#endif
+#ifndef COMMAND_QUEUE_SIZE
+#define COMMAND_QUEUE_SIZE 16 // how many commands control code can queue for update(), a power of 2, or 0 for none
+#endif
+#ifndef CHECKPOINT_SECONDS
+#define CHECKPOINT_SECONDS 5 // how far apart the checkpoints in a score index are, for seek()
+#endif
+#define WAVE_MIPMAPS 7      // how many band-limited copies there are, with 64, 32, ... 1 harmonics
+#ifndef DYNAMIC_VOLUME
 #define DYNAMIC_VOLUME 0    // dynamically adjust volume depending on how many instruments are playing?
 //                          // (This is sometimes nice, but often sounds weird and exacerbates clipping distortion.)
+#endif
+
+#if DO_PERCUSSION && COMPRESSED_PERCUSSION
+#include "synth_Playtune_adpcm.h"
+#endif
+#include "synth_Playtune_bank.h"
 
 struct file_hdr_t {  // the optional bytestream file header
   char id1;     // 'P'
@@ -42,54 +104,258 @@ struct file_hdr_t {  // the optional bytestream file header
 #define CMD_RESTART 0xe0     /* restart the score from the beginning */
 #define CMD_STOP  0xf0       /* stop playing */
 /* if CMD < 0x80, then the other 7 bits and the next byte are a 15-bit big-endian number of msec to wait */
+#define CMD_WAIT 0x00        /* (only in a decoded event) wait: the time is the number of samples */
+
+struct playtune_event_t { // a score command decoded from the bytestream, by playtune_compile_score
+  uint32_t time;  // when to do it, as the number of samples from the start of the score
+  byte cmd;       // CMD_PLAYNOTE, etc., with the generator # in the low nibble as in the bytestream
+  byte arg;       // the note for CMD_PLAYNOTE, or the MIDI program number for CMD_INSTRUMENT
+  byte vol;       // the volume for CMD_PLAYNOTE, 127 if the bytestream has none
+  byte reserved;
+};
+
+// Decode the bytestream command at cursor into an event, and return where the next one is.
+// A wait becomes a CMD_WAIT event whose time is how many samples it lasts.
+const byte *playtune_decode_command(const byte *cursor, bool volume_present, struct playtune_event_t *event);
+
+// Look for the optional header at the start of a bytestream, and return where the commands start.
+// If there is a header, set volume_present and num_tgens from it; if not, leave them alone.
+const byte *playtune_score_header(const byte *score, bool *volume_present, unsigned *num_tgens);
+
+// Compile a bytestream into a list of events with absolute times, in one pass: the waits become
+// the times of the events after them, and the list ends with the CMD_STOP or CMD_RESTART.
+// Store up to max_events of them into events, and return how many there are, so calling it with
+// max_events 0 says how much room to get. num_tgens is set from the header, or to 0 if there is none.
+// volume_present says whether a score without a header has volumes; compileScore() in the
+// synthesizer that will play it passes its own PT_ASSUME_VOLUME.
+uint32_t playtune_compile_score(const byte *score, bool volume_present, struct playtune_event_t *events,
+                                uint32_t max_events, unsigned *num_tgens);
+
+#define NO_NOTE 0xff  // (in a checkpoint: the generator isn't playing, or hasn't had an instrument change)
+
+struct playtune_checkpoint_t { // where a score is at some time, and what it is doing there
+  uint32_t offset;      // where the next command is, as a byte offset from the end of the header
+  uint32_t time;        // the number of samples from the start of the score to there
+  byte program[MAX_TGENS]; // each generator's last MIDI program number, or NO_NOTE
+  byte note[MAX_TGENS];    // the note each generator is playing, or NO_NOTE
+  byte vol[MAX_TGENS];     //   and its volume
+};
+
+// Make an index of a bytestream for seek(): checkpoints every CHECKPOINT_SECONDS from the start,
+// each at the first command at or after that time. Store up to max_checkpoints of them into
+// checkpoints, and return how many there are. (Call it with max_checkpoints 0 to find out.)
+// volume_present is as for playtune_compile_score, and indexScore() passes it the same way.
+uint32_t playtune_index_score(const byte *score, bool volume_present, struct playtune_checkpoint_t *checkpoints,
+                              uint32_t max_checkpoints);
+
+// Where a streamed score comes from: read up to "bytes" of it into buffer, and return how many
+// were read, or 0 at the end or -1 for an error. It's called by refill(), never in the interrupt.
+typedef int (*playtune_read_t)(void *context, byte *buffer, int bytes);
+
+enum queued_cmd_t {Q_PLAY, Q_STOP, Q_NOTE_ON, Q_NOTE_OFF, Q_INSTRUMENT, Q_GAIN};
+
+struct playtune_queued_t { // a command from control code, for update() to do
+  byte cmd;        // Q_PLAY, etc.
+  byte offset;     // the sample in the block at which to do it
+  byte tgen;       // for notes and instruments: the tone generator, or for scores: the layer,
+  byte arg, vol;   //   the note or instrument index, and the volume, or the layer's first_tgen and num_tgens
+  const byte *score;  // for Q_PLAY: the bytestream
+  int32_t gain;       // for Q_GAIN: the new amplitude_fraction
+};
 
 enum env_state_t {ENV_IDLE, ENV_DELAY, ENV_ATTACK, ENV_HOLD, ENV_DECAY, ENV_SUSTAIN, ENV_RELEASE};
 
-class AudioSynthPlaytune : public AudioStream
+enum playtune_features_t { // what an AudioSynthPlaytuneT can do, or'ed together
+  PT_PERCUSSION = 0x01,       // play percussion instruments (which needs DO_PERCUSSION for their tables)
+  PT_ENVELOPE = 0x02,         // give notes their DAHDSR amplitude envelopes
+  PT_DYNAMIC_VOLUME = 0x04,   // adjust the volume depending on how many generators are playing
+  PT_BOOST_PERCUSSION = 0x08, // amplify percussion instruments
+  PT_ASSUME_VOLUME = 0x10     // assume volume information is present in bytestream files without headers
+};
+
+// the features the options above ask for
+#define PLAYTUNE_FEATURES ((DO_PERCUSSION ? PT_PERCUSSION : 0) | (DO_ENVELOPE ? PT_ENVELOPE : 0) \
+  | (DYNAMIC_VOLUME ? PT_DYNAMIC_VOLUME : 0) | (BOOST_PERCUSSION ? PT_BOOST_PERCUSSION : 0) \
+  | (ASSUME_VOLUME ? PT_ASSUME_VOLUME : 0))
+
+// The synthesizer, with MaxVoices tone generators and the "Features" that it has. Each one that
+// a program declares gets its own update(), without the code for the features it doesn't have,
+// so a lean one for sound effects can run next to one that plays music:
+//   AudioSynthPlaytuneT<4, PT_PERCUSSION> effects;
+//   AudioSynthPlaytune music; // (MAX_TGENS of them, with the features the options ask for)
+// With a VOICE_POOL, MaxVoices is the number of voices, and scores still have MAX_TGENS channels.
+
+template <int MaxVoices, unsigned Features>
+class AudioSynthPlaytuneT : public AudioStream
 {
+    enum { // (enums, so that they don't need definitions)
+      NUM_VOICES = MaxVoices,                                 // how many tone generators there are,
+      NUM_CHANNELS = VOICE_POOL ? MAX_TGENS : MaxVoices, //   and the tone generator numbers that scores play on
+      ENV_VOICES = Features & PT_ENVELOPE ? MaxVoices : 1,    // how many need the envelope's state,
+      DRUM_VOICES = Features & PT_PERCUSSION ? MaxVoices : 1  //   and percussion's
+    };
+    static_assert(MaxVoices >= 1 && MaxVoices <= 32, "MaxVoices must be 1 to 32, the number of bits in tgens_playing");
+    static_assert(NUM_CHANNELS <= MAX_TGENS, "MaxVoices must be no more than MAX_TGENS, the size of a checkpoint");
   public:
-    AudioSynthPlaytune(void) : AudioStream(0, NULL) {
+    AudioSynthPlaytuneT(void) : AudioStream(0, NULL) {
       tune_init();
     }
     virtual void update(void);
     void play(const byte *);
     void play(const byte *, unsigned int);
+    void play(const struct playtune_event_t *events, unsigned int num_tgens);
+#if STREAM_BUFFER_BYTES
+    void play(playtune_read_t reader, void *context);
+    void refill(void);
+    unsigned long underruns(void) {
+      return stream_underruns;
+    }
+#endif
+#if COMMAND_QUEUE_SIZE
+    // Safe ways for control code to do things while update() runs: each command is done at
+    // sample "offset" of the next block, in the order they were queued. Only one caller may queue
+    // commands. They return false if the queue is full.
+    bool queuePlay(const byte *score, byte offset = 0);
+    bool queueStop(byte offset = 0);
+    bool queuePlayLayer(byte layer, const byte *score, byte first_tgen, byte num_tgens, byte offset = 0);
+    bool queueStopLayer(byte layer, byte offset = 0);
+    bool queueNoteOn(byte tgen, byte note, byte vol, byte offset = 0);
+    bool queueNoteOff(byte tgen, byte offset = 0);
+    bool queueInstrument(byte tgen, byte instrument_index, byte offset = 0);
+    bool queueGain(int32_t amplitude_fraction, byte offset = 0);
+#endif
     bool isPlaying(void);
+    // Layers 1..MAX_SCORES-1 are more scores that play at the same time as the main one, each on its
+    // own tone generators: its generator 0 is first_tgen, and so on for num_tgens of them.
+    void playLayer(byte layer, const byte *score, byte first_tgen, byte num_tgens);
+    bool layerPlaying(byte layer);
+    void stopLayer(byte layer);
     void stop(void);
+    bool seek(unsigned long msec, const struct playtune_checkpoint_t *checkpoints, uint32_t num_checkpoints);
+    // playtune_compile_score and playtune_index_score, reading a score without a header the way
+    // this synthesizer will play it
+    static uint32_t compileScore(const byte *score, struct playtune_event_t *events, uint32_t max_events,
+                                 unsigned *num_tgens) {
+      return playtune_compile_score(score, Features & PT_ASSUME_VOLUME, events, max_events, num_tgens);
+    }
+    static uint32_t indexScore(const byte *score, struct playtune_checkpoint_t *checkpoints, uint32_t max_checkpoints) {
+      return playtune_index_score(score, Features & PT_ASSUME_VOLUME, checkpoints, max_checkpoints);
+    }
+    unsigned long position(void);
+    bool useBank(const void *bank, uint32_t size);
     // the following should really be private, but are public temporarily for test code
-    bool tune_playing = false;
-    byte num_tgens_used = MAX_TGENS;
+    byte num_tgens_used = NUM_CHANNELS;
     void tune_playnote (byte tgen, byte note, byte vol);
     void tune_stopnote (byte tgen);
     void tune_setinstrument(byte tgen, byte instrument_index);
+    void tune_playdrum (byte tgen, const void *waveform, uint32_t num_samples, uint32_t tone_incr, byte vol);
     int32_t amplitude_fraction = 0x10000;   // fraction of 2^16 to reduce amplitude by
   private:
     void tune_init(void);
-    void tune_stopscore (void);
-    void tune_stepscore (void);
-    void tune_playscore (const byte * score);
-    bool volume_present = ASSUME_VOLUME; // is there volume information in the bytestream?
+    struct score_t { // the state of a score that is playing: the main one, or a layer
+      bool playing;
+      bool volume_present;         // is there volume information in the bytestream?
+      byte first_tgen, num_tgens;  // the tone generators its commands play on
+      const byte *score_start;     // the start of the Playtune bytestream
+      const byte *score_cursor;    // where we are currently playing in the bytestream
+      const struct playtune_event_t *events_start; // or the start of the compiled score we're playing, if any,
+      const struct playtune_event_t *event_cursor; //   the next event to do,
+      uint32_t score_time;         //   and the time in samples that we've gotten to
+      unsigned scorewait_samples;  // how many samples to play before the next score event, if any
+    } scores[MAX_SCORES];
+    uint32_t layer_tgens = 0;      // bit mask of the tone generators that the layers playing play on,
+    uint32_t fading_tgens = 0;     //   and of those that stopped layers' notes are still fading out on
+    void tune_reservelayers (void);
+    void tune_stopscore (struct score_t *sc);
+    void tune_stepscore (struct score_t *sc);
+    void tune_stepevents (struct score_t *sc);
+    bool tune_docommand (struct score_t *sc, const struct playtune_event_t *event);
+    void tune_startscore (struct score_t *sc);
+    void tune_playscore (struct score_t *sc, const byte * score);
+    uint32_t tune_mixed_tgens (void);
+    void tune_startvoice (byte voice, byte vol);
+    void tune_startdrum (byte voice, const void *waveform, uint32_t num_samples, uint32_t tone_incr, byte vol);
+    void tune_releasevoice (byte voice);
+    uint32_t tune_channel_voices (uint32_t channels);
+#if VOICE_POOL
+    // With a voice pool, the score's tone generator numbers are channels, and each note gets one of
+    // the NUM_VOICES voices in tg when it starts. A channel's note that is released keeps
+    // its voice until it has faded out, while the channel goes on to its next note on another one.
+    byte channel_voice[NUM_CHANNELS];      // the voice playing each channel's note, if it still is
+    byte channel_instrument[NUM_CHANNELS]; //   and the channel's instrument, for its next note
+    byte voice_channel[NUM_VOICES];        // the channel each voice last played a note for,
+    uint32_t voice_started[NUM_VOICES];    //   and when it started, by voice_clock
+    uint32_t voice_clock = 0;
+    byte tune_allocvoice (byte channel);
+#endif
     int num_tgens_playing_last = 0;      // how many tone generators played at the last sample
-    const byte *score_start;             // the start of the Playtune bytestream
-    const byte *score_cursor;            // where we are currently playing in the bytestream
-    unsigned scorewait_samples = 0;      // how many samples to wait through for next score event
-    struct tone_gen_t { // the internal state of each tone generator
-      int32_t tone_phase;       // where we are playing in an instrument sample (2^16 fraction)
-      int32_t tone_incr;        // increment from one sample to another (2^16 fraction)
-      int32_t volume_frac;      // midi volume from 1..127 code (2^16 fraction)
-      uint16_t drum_ending_sample_index; // the index of the last sample for a percussion instrument
-      byte instrument_index;    // the instrument we're playing: I_PIANO, etc.
-      byte playing;             // is this channel playing?
-      byte percussion;          // is it a percussion instrument?
-#if DO_ENVELOPE
-      env_state_t env_state;      // envelope state variables:
-      int32_t env_mult, env_incr; // amplitude multiplier and increment, as fractions * 2^16
-      int env_count;              // duration count for this state, as number of samples
-#endif
-      const int16_t *waveform_array; // pointer to the waveform sample array
-      //                                with 256 points for instruments, up to 16383 for percussion
-    } tone_gen[MAX_TGENS];
-    struct file_hdr_t file_header;  // a possible file header from the Playtune bytestream
+    int32_t gain_amplitude_fraction = 0x10000; // the amplitude_fraction that the tone generators' gains include
+#if COMMAND_QUEUE_SIZE
+    // The command queue is a ring like the stream buffer: the queue...() functions add commands at
+    // queue_head, and update() takes them out at queue_tail.
+    struct playtune_queued_t queue[COMMAND_QUEUE_SIZE];
+    volatile uint32_t queue_head = 0, queue_tail = 0;
+    bool tune_queue (struct playtune_queued_t *command);
+    void tune_runqueued (const struct playtune_queued_t *command);
+#endif
+    const struct playtune_bank_t *bank = NULL; // the sample bank we play, or NULL for the built-in sounds
+#if STREAM_BUFFER_BYTES
+    // A streamed score (only the main one) goes through a ring buffer: refill() puts bytes in at stream_head outside the
+    // interrupt, and update() takes them out at stream_tail. Each only changes its own counter, so
+    // neither needs a lock. The counters run freely; head - tail is how many bytes are waiting.
+    byte stream_buffer[STREAM_BUFFER_BYTES];
+    volatile uint32_t stream_head, stream_tail;
+    playtune_read_t stream_reader = NULL; // where it comes from, if we're playing one,
+    void *stream_context;
+    volatile bool stream_ended;          //   whether the reader has no more,
+    volatile unsigned long stream_underruns = 0; // and how often update() wanted a command that hadn't come yet
+    bool tune_streamcommand (struct score_t *sc, struct playtune_event_t *event);
+#endif
+    uint32_t tgens_playing = 0;          // bit mask of the tone generators (voices) that are playing
+    uint32_t percussion_tgens = 0;       // bit mask of the ones playing percussion instruments
+    // The internal state of the tone generators, as parallel arrays indexed by tone generator, so
+    // that what rendering the samples uses is together, and the arrays of features we don't have
+    // shrink to one entry that isn't used.
+    struct tone_gens_t {
+      // for every sample
+      int32_t tone_phase[NUM_VOICES];  // where we are playing in an instrument sample (2^16 fraction)
+      int32_t tone_incr[NUM_VOICES];   // increment from one sample to another (2^16 fraction)
+      int32_t gain_frac[NUM_VOICES];   // volume times amplitude_fraction, applied to each sample (2^16 fraction)
+      const int16_t *waveform_array[NUM_VOICES]; // pointer to the waveform sample array
+      //                                            with 256 points for instruments, any number for percussion
+      int32_t env_mult[ENV_VOICES], env_incr[ENV_VOICES]; // envelope amplitude multiplier and increment, as fractions * 2^16
+      // for every run
+      int env_count[ENV_VOICES];       // duration count for this envelope state, as number of samples
+#if EXP_ENVELOPE
+      uint32_t env_decay[ENV_VOICES];  // for an exponential decay or release, the multiplier per sample (2^32 fraction), else 0
+      uint32_t env_dist[ENV_VOICES];   //   and how far env_mult is above its target (2^30 fraction)
+      int32_t env_target[ENV_VOICES];  //   and the target it approaches, sustain_level or 0 (2^16 fraction)
+#endif
+      uint32_t drum_samples_left[DRUM_VOICES]; // how many more samples to play for a percussion instrument
+      uint32_t drum_index[DRUM_VOICES];        //   and the index of its waveform point that tone_phase is relative to
+#if DO_PERCUSSION && COMPRESSED_PERCUSSION
+      const uint8_t *adpcm_waveform[DRUM_VOICES]; // for percussion instead: the compressed waveform,
+      struct adpcm_state_t adpcm[DRUM_VOICES];    //   the decoder's state after sample number adpcm_index,
+      uint32_t adpcm_index[DRUM_VOICES];
+      int16_t adpcm_val1[DRUM_VOICES], adpcm_val2[DRUM_VOICES]; //   and the samples at adpcm_index-1 and adpcm_index
+#endif
+      // for starting and stopping notes
+      byte env_state[ENV_VOICES];      // the envelope's state: ENV_IDLE, etc.
+      byte instrument_index[NUM_VOICES]; // the instrument we're playing: I_PIANO, etc.
+      byte volume[NUM_VOICES];         // the note's MIDI volume, 0..127
+    } tg;
+    void tune_update_gains (void);
+    void tune_render_voices (int32_t *mix, int count);
+    bool tune_render_instrument (byte tgen, int32_t *mix, int count);
+    bool tune_render_percussion (byte tgen, int32_t *mix, int count);
+    void tune_render_waveform (byte tgen, int32_t *mix, int count);
+    void tune_render_waveform_exp (byte tgen, int32_t *mix, int count);
+    void tune_envelope_next (byte tgen);
 };
 
+#include "synth_Playtune_impl.h"
+
+// the synthesizer as the options above make it
+typedef AudioSynthPlaytuneT<VOICE_POOL ? VOICE_POOL : MAX_TGENS, PLAYTUNE_FEATURES> AudioSynthPlaytune;
+
 #endif
@@ -0,0 +1,354 @@
+/* synth_Playtune_adpcm.cpp
+
+    IMA-ADPCM compressed percussion waveforms for synth_Playtune, an audio object
+    for the PJRC Teensy Audio Library. See synth_Playtune_adpcm.h for the format.
+
+    This file was generated by host/playtune_adpcm.cpp from synth_Playtune_waves.cpp.
+    Don't edit it; change that and run it again.
+
+    Copyright (C) 2026, the Playtune_synth contributors (MIT license; see LICENSE.txt)
+*/
+
+#include "Arduino.h"
+#include "synth_Playtune.h"
+
+#if DO_PERCUSSION && COMPRESSED_PERCUSSION
+
+extern const uint8_t waveform_base_drum_04_adpcm[] PROGMEM = { // 1474 samples
+  140, 246, 0, 0, 119, 247, 255, 255, 255, 9, 104, 34, 17, 152, 188, 202, 136, 33, 68, 20, 129, 169, 218, 155,
+  154, 0, 82, 52, 51, 16, 9, 251, 187, 187, 137, 8, 65, 115, 35, 19, 17, 136, 185, 250, 172, 187, 138, 136,
+  16, 51, 70, 52, 50, 16, 0, 136, 153, 173, 189, 189, 171, 153, 137, 24, 33, 67, 70, 52, 35, 17, 17, 0,
+  128, 169, 201, 188, 205, 220, 170, 153, 137, 136, 136, 17, 34, 67, 70, 68, 34, 17, 17, 17, 0, 0, 136, 154,
+  202, 219, 219, 204, 204, 170, 153, 153, 136, 136, 136, 16, 34, 35, 69, 84, 84, 51, 18, 16, 17, 17, 1, 0,
+  0, 152, 169, 187, 219, 189, 189, 205, 220, 187, 169, 9, 98, 156, 68, 0, 153, 152, 136, 136, 8, 16, 50, 51,
+  83, 83, 69, 69, 52, 36, 1, 1, 1, 1, 1, 1, 0, 128, 136, 185, 170, 170, 219, 204, 188, 189, 221, 219,
+  187, 187, 171, 170, 153, 153, 153, 136, 8, 8, 48, 38, 51, 51, 68, 85, 69, 52, 52, 66, 18, 17, 0, 1,
+  17, 1, 1, 0, 128, 136, 137, 203, 186, 170, 203, 204, 189, 205, 204, 188, 188, 203, 186, 203, 186, 171, 153, 154,
+  152, 136, 136, 0, 0, 81, 52, 35, 67, 69, 69, 52, 52, 52, 51, 36, 51, 51, 51, 18, 18, 18, 18, 16,
+  128, 152, 169, 169, 191, 186, 186, 204, 206, 189, 204, 187, 188, 203, 187, 172, 187, 188, 187, 172, 187, 170, 154, 9,
+  72, 138, 52, 0, 152, 8, 0, 16, 115, 52, 52, 67, 52, 68, 83, 51, 52, 51, 52, 51, 67, 35, 51, 36,
+  34, 34, 17, 128, 144, 152, 154, 234, 188, 203, 188, 203, 204, 203, 188, 203, 203, 187, 188, 187, 203, 187, 188, 187,
+  172, 170, 154, 138, 137, 136, 0, 24, 65, 70, 51, 52, 68, 67, 83, 67, 67, 51, 36, 51, 67, 50, 50, 51,
+  36, 34, 18, 17, 128, 136, 153, 170, 251, 203, 203, 203, 203, 188, 204, 203, 187, 188, 188, 187, 188, 202, 186, 203,
+  186, 187, 171, 154, 153, 137, 128, 0, 16, 113, 53, 67, 67, 67, 52, 68, 67, 67, 51, 67, 35, 67, 50, 50,
+  51, 51, 35, 34, 1, 0, 137, 169, 186, 237, 203, 11, 78, 34, 42, 0, 188, 204, 203, 188, 188, 188, 203, 187,
+  188, 187, 188, 187, 188, 203, 170, 170, 154, 137, 9, 136, 16, 16, 114, 52, 52, 52, 52, 68, 67, 52, 83, 50,
+  51, 51, 52, 51, 51, 36, 51, 50, 18, 1, 128, 136, 169, 170, 221, 203, 203, 203, 188, 188, 189, 188, 203, 172,
+  203, 186, 187, 188, 187, 203, 203, 170, 154, 153, 137, 136, 8, 0, 17, 114, 36, 52, 52, 52, 52, 53, 68, 51,
+  67, 51, 51, 36, 51, 67, 50, 35, 35, 33, 1, 128, 136, 153, 170, 221, 203, 203, 187, 189, 189, 188, 188, 188,
+  203, 203, 187, 187, 219, 186, 172, 171, 187, 170, 154, 152, 8, 8, 16, 17, 116, 52, 66, 36, 36, 52, 52, 5,
+  52, 240, 46, 0, 51, 52, 51, 36, 51, 51, 36, 51, 50, 35, 34, 1, 0, 152, 152, 154, 190, 189, 219, 187,
+  189, 204, 219, 171, 188, 172, 203, 186, 187, 203, 187, 173, 170, 171, 170, 138, 152, 8, 0, 0, 18, 101, 67, 51,
+  53, 52, 83, 67, 52, 52, 51, 36, 51, 36, 35, 51, 52, 34, 35, 17, 1, 0, 137, 169, 170, 191, 187, 204,
+  203, 203, 188, 189, 172, 172, 203, 187, 203, 186, 187, 188, 172, 186, 171, 170, 154, 128, 8, 0, 0, 20, 100, 67,
+  51, 53, 52, 68, 67, 52, 67, 51, 51, 67, 51, 51, 36, 66, 34, 34, 17, 17, 128, 136, 152, 170, 220, 203,
+  203, 172, 203, 188, 189, 188, 202, 187, 188, 203, 186, 11, 233, 250, 31, 0, 203, 203, 185, 170, 169, 169, 129, 16,
+  17, 2, 36, 84, 36, 36, 52, 67, 52, 52, 84, 50, 51, 36, 51, 67, 50, 35, 67, 34, 34, 33, 16, 0,
+  136, 153, 154, 221, 186, 188, 173, 203, 188, 204, 203, 202, 186, 187, 188, 185, 187, 172, 204, 169, 154, 154, 185, 0,
+  137, 8, 2, 97, 82, 67, 35, 115, 50, 67, 67, 83, 51, 67, 50, 67, 35, 51, 67, 65, 18, 18, 18, 24,
+  0, 136, 153, 186, 204, 203, 187, 204, 185, 205, 203, 204, 170, 172, 187, 188, 11,
+};
+
+extern const uint8_t waveform_snare_drum_1_adpcm[] PROGMEM = { // 961 samples
+  235, 248, 0, 0, 247, 119, 255, 47, 206, 7, 42, 18, 15, 27, 135, 61, 153, 147, 133, 201, 147, 76, 139, 4,
+  160, 168, 100, 13, 1, 41, 128, 8, 178, 105, 168, 26, 27, 194, 184, 171, 98, 200, 147, 8, 115, 139, 0, 166,
+  178, 5, 72, 27, 160, 148, 8, 8, 30, 152, 178, 24, 171, 76, 41, 10, 28, 182, 48, 164, 145, 193, 121, 129,
+  153, 35, 24, 172, 146, 132, 240, 128, 128, 10, 28, 168, 128, 6, 28, 161, 24, 57, 74, 32, 16, 165, 91, 163,
+  25, 201, 48, 148, 208, 77, 8, 161, 242, 24, 57, 169, 160, 24, 164, 73, 75, 161, 96, 11, 0, 180, 16, 171,
+  64, 3, 107, 250, 1, 162, 8, 25, 43, 164, 242, 1, 143, 242, 84, 0, 8, 194, 41, 41, 176, 144, 6, 58,
+  136, 76, 58, 201, 49, 177, 32, 224, 162, 56, 171, 18, 88, 154, 112, 138, 242, 130, 18, 156, 57, 136, 195, 72,
+  11, 128, 160, 181, 74, 140, 34, 242, 164, 128, 40, 168, 106, 25, 161, 224, 35, 153, 26, 40, 91, 136, 178, 161,
+  146, 160, 215, 17, 42, 209, 136, 20, 152, 76, 16, 185, 128, 146, 29, 121, 137, 129, 0, 139, 1, 152, 98, 15,
+  0, 144, 2, 201, 20, 9, 32, 204, 18, 40, 152, 136, 151, 10, 41, 185, 48, 244, 129, 16, 40, 46, 25, 136,
+  138, 35, 122, 169, 165, 42, 43, 129, 40, 15, 130, 24, 145, 170, 150, 161, 152, 122, 161, 194, 16, 41, 195, 9,
+  0, 9, 72, 0, 9, 152, 28, 49, 155, 77, 1, 183, 24, 137, 74, 154, 20, 192, 9, 163, 48, 161, 47, 177,
+  19, 201, 73, 33, 141, 136, 179, 136, 69, 12, 8, 9, 160, 8, 7, 154, 153, 133, 35, 143, 16, 26, 144, 138,
+  132, 146, 160, 52, 25, 31, 184, 165, 136, 17, 138, 89, 10, 16, 136, 243, 128, 72, 194, 137, 134, 10, 17, 12,
+  192, 2, 72, 218, 131, 32, 242, 42, 1, 41, 168, 44, 163, 3, 76, 188, 18, 131, 171, 165, 51, 155, 17, 192,
+  178, 208, 80, 138, 9, 66, 57, 12, 76, 129, 168, 26, 93, 145, 27, 56, 180, 210, 24, 90, 153, 8, 152, 33,
+  211, 67, 47, 11, 128, 163, 195, 8, 211, 74, 179, 10, 182, 250, 63, 0, 90, 177, 61, 145, 193, 18, 184, 129,
+  34, 142, 129, 10, 74, 177, 8, 161, 108, 88, 154, 65, 8, 27, 243, 0, 42, 8, 197, 24, 9, 1, 208, 3,
+  24, 10, 185, 32, 113, 217, 130, 8, 137, 57, 200, 51, 45, 40, 211, 29, 18, 176, 135, 13, 129, 8, 129, 184,
+  24, 135, 138, 24, 74, 128, 162, 72, 13, 9, 128, 129, 49, 15, 129, 152, 146, 129, 193, 9, 122, 32, 169, 164,
+  61, 137, 145, 50, 30, 160, 150, 152, 42, 1, 180, 25, 44, 42, 177, 72,
+};
+
+extern const uint8_t waveform_mid_high_tom_adpcm[] PROGMEM = { // 2818 samples
+  60, 8, 0, 0, 119, 119, 119, 119, 39, 140, 177, 15, 176, 32, 188, 121, 26, 145, 135, 8, 0, 33, 16, 12,
+  194, 160, 25, 249, 73, 140, 144, 179, 0, 112, 8, 147, 144, 134, 137, 2, 152, 42, 187, 121, 171, 27, 29, 147,
+  41, 25, 131, 23, 128, 5, 41, 136, 41, 31, 153, 152, 13, 8, 192, 128, 9, 161, 71, 56, 145, 10, 131, 107,
+  160, 193, 184, 177, 170, 25, 75, 140, 123, 41, 1, 53, 250, 4, 0, 129, 153, 1, 168, 59, 27, 223, 129, 129,
+  43, 161, 6, 90, 16, 26, 153, 133, 145, 8, 177, 57, 139, 157, 159, 17, 10, 153, 133, 2, 18, 193, 39, 28,
+  1, 136, 129, 200, 169, 50, 175, 194, 8, 58, 92, 8, 235, 232, 83, 0, 152, 34, 145, 179, 6, 129, 26, 0,
+  141, 31, 177, 164, 208, 2, 11, 105, 152, 8, 32, 149, 129, 130, 168, 88, 139, 164, 157, 48, 11, 208, 8, 32,
+  30, 180, 144, 81, 162, 65, 24, 9, 128, 155, 42, 249, 25, 225, 1, 200, 16, 0, 128, 7, 8, 90, 136, 130,
+  57, 144, 24, 158, 144, 16, 155, 248, 8, 42, 33, 200, 22, 136, 2, 40, 18, 74, 248, 16, 8, 192, 153, 156,
+  9, 9, 163, 110, 1, 11, 19, 19, 42, 48, 43, 2, 178, 243, 249, 24, 13, 177, 27, 145, 59, 171, 39, 32,
+  0, 243, 97, 136, 24, 128, 11, 129, 176, 250, 34, 159, 40, 129, 25, 184, 41, 23, 24, 2, 130, 59, 26, 5,
+  64, 93, 76, 0, 144, 184, 244, 10, 168, 9, 43, 128, 58, 108, 149, 16, 40, 3, 1, 90, 27, 240, 168, 165,
+  0, 217, 24, 26, 91, 139, 83, 11, 18, 154, 36, 210, 2, 58, 48, 155, 176, 241, 224, 1, 178, 12, 144, 42,
+  56, 123, 176, 83, 9, 32, 32, 8, 0, 145, 204, 180, 251, 65, 141, 0, 136, 8, 0, 9, 164, 114, 9, 152,
+  6, 25, 25, 43, 8, 176, 43, 154, 157, 160, 220, 3, 21, 156, 136, 7, 24, 8, 136, 19, 41, 194, 90, 201,
+  1, 0, 184, 251, 26, 129, 2, 27, 146, 167, 65, 1, 1, 163, 62, 136, 137, 17, 233, 185, 80, 141, 160, 40,
+  162, 185, 129, 7, 43, 66, 3, 225, 65, 138, 17, 9, 245, 63, 76, 0, 147, 8, 173, 136, 143, 176, 40, 148,
+  9, 176, 84, 9, 133, 41, 9, 162, 83, 201, 163, 128, 45, 203, 129, 58, 160, 159, 1, 180, 64, 57, 152, 34,
+  160, 38, 58, 24, 248, 18, 153, 143, 195, 16, 9, 156, 19, 142, 0, 131, 153, 37, 32, 209, 17, 30, 146, 8,
+  161, 0, 152, 58, 171, 143, 147, 155, 33, 57, 199, 193, 1, 18, 32, 122, 130, 25, 144, 1, 192, 25, 2, 175,
+  186, 210, 16, 49, 219, 145, 96, 1, 8, 144, 16, 84, 25, 27, 0, 27, 207, 0, 18, 184, 249, 41, 178, 42,
+  167, 9, 51, 45, 1, 8, 24, 209, 2, 45, 34, 248, 129, 43, 144, 24, 201, 131, 28, 212, 136, 40, 1, 6,
+  231, 251, 82, 0, 42, 131, 72, 43, 128, 91, 152, 40, 170, 208, 177, 90, 200, 129, 194, 57, 233, 49, 89, 177,
+  2, 107, 160, 49, 178, 176, 107, 153, 75, 202, 64, 10, 192, 16, 145, 216, 41, 10, 55, 136, 16, 136, 64, 241,
+  128, 42, 164, 16, 176, 196, 16, 10, 232, 41, 176, 89, 211, 9, 32, 17, 243, 25, 48, 16, 136, 1, 8, 251,
+  146, 154, 179, 60, 144, 176, 47, 137, 167, 162, 32, 76, 27, 130, 80, 27, 162, 48, 148, 27, 241, 33, 157, 9,
+  178, 1, 41, 1, 202, 46, 0, 135, 137, 163, 0, 60, 149, 26, 146, 28, 130, 0, 185, 45, 9, 169, 17, 240,
+  129, 24, 160, 121, 17, 171, 99, 194, 144, 178, 33, 2, 99, 23, 71, 0, 122, 184, 19, 201, 149, 11, 44, 24,
+  25, 155, 112, 177, 72, 218, 2, 48, 168, 106, 33, 216, 131, 8, 176, 57, 232, 145, 128, 88, 138, 192, 42, 138,
+  144, 66, 16, 25, 65, 42, 7, 57, 136, 193, 151, 11, 130, 137, 168, 90, 161, 169, 248, 72, 13, 145, 24, 129,
+  49, 139, 5, 163, 51, 193, 15, 147, 177, 131, 63, 161, 153, 168, 163, 47, 17, 200, 25, 154, 37, 140, 56, 138,
+  50, 0, 88, 65, 216, 178, 106, 178, 154, 131, 105, 154, 185, 134, 13, 128, 145, 64, 139, 133, 145, 136, 130, 67,
+  24, 138, 137, 81, 209, 46, 153, 161, 169, 35, 208, 146, 129, 142, 4, 8, 34, 141, 32, 129, 200, 18, 248, 10,
+  38, 18, 74, 0, 3, 171, 167, 24, 91, 128, 171, 129, 160, 73, 192, 43, 128, 122, 129, 9, 40, 166, 8, 1,
+  72, 155, 132, 41, 186, 135, 176, 144, 40, 30, 57, 225, 58, 9, 27, 164, 147, 192, 49, 233, 52, 154, 67, 193,
+  25, 155, 23, 155, 145, 16, 155, 160, 121, 152, 25, 161, 46, 162, 36, 217, 72, 155, 56, 180, 57, 17, 34, 187,
+  23, 2, 217, 59, 24, 160, 175, 17, 160, 40, 16, 138, 241, 90, 178, 56, 160, 24, 51, 138, 40, 20, 143, 49,
+  145, 161, 154, 227, 44, 193, 20, 44, 234, 24, 136, 130, 25, 152, 211, 19, 196, 120, 137, 152, 17, 9, 5, 60,
+  136, 161, 1, 187, 130, 186, 159, 128, 7, 11, 2, 11, 190, 233, 66, 0, 83, 140, 8, 20, 144, 41, 7, 169,
+  88, 170, 18, 146, 41, 171, 33, 41, 253, 1, 11, 136, 148, 32, 10, 234, 153, 84, 169, 8, 136, 51, 11, 35,
+  15, 5, 193, 33, 171, 50, 10, 77, 162, 104, 218, 9, 129, 169, 162, 52, 155, 146, 106, 147, 16, 170, 151, 90,
+  130, 144, 169, 9, 23, 140, 0, 13, 1, 136, 57, 144, 138, 164, 200, 48, 136, 24, 159, 163, 57, 149, 83, 128,
+  41, 161, 143, 136, 67, 202, 25, 49, 200, 170, 35, 184, 168, 140, 33, 116, 184, 41, 129, 137, 9, 166, 25, 97,
+  136, 39, 154, 8, 9, 193, 8, 8, 161, 15, 3, 1, 172, 128, 173, 153, 106, 68, 185, 136, 146, 10, 35, 1,
+  85, 5, 60, 0, 66, 171, 84, 185, 148, 76, 129, 177, 186, 42, 132, 4, 140, 248, 1, 0, 40, 1, 12, 129,
+  218, 82, 168, 171, 18, 120, 19, 176, 24, 216, 8, 48, 161, 37, 235, 26, 34, 152, 137, 203, 1, 97, 241, 26,
+  2, 152, 19, 170, 200, 89, 5, 154, 32, 20, 185, 203, 48, 114, 161, 187, 56, 147, 140, 130, 157, 162, 48, 17,
+  157, 0, 139, 135, 156, 67, 50, 176, 156, 48, 20, 128, 12, 11, 168, 10, 71, 162, 189, 16, 185, 128, 8, 60,
+  131, 32, 1, 114, 242, 170, 80, 146, 16, 128, 25, 69, 155, 34, 185, 170, 17, 216, 26, 19, 249, 152, 44, 4,
+  155, 192, 60, 19, 168, 25, 17, 147, 104, 168, 8, 0, 189, 8, 50, 0, 102, 184, 136, 48, 161, 170, 193, 99,
+  224, 41, 162, 154, 8, 155, 20, 129, 156, 89, 145, 153, 185, 60, 39, 152, 1, 18, 41, 17, 71, 186, 28, 130,
+  18, 33, 191, 130, 172, 32, 160, 200, 44, 36, 146, 188, 172, 52, 184, 140, 1, 24, 35, 52, 209, 45, 7, 25,
+  18, 170, 34, 158, 24, 185, 65, 130, 10, 19, 169, 146, 223, 154, 41, 5, 9, 16, 66, 208, 56, 2, 185, 155,
+  83, 194, 11, 35, 146, 34, 13, 177, 175, 16, 5, 172, 138, 24, 133, 136, 170, 50, 161, 154, 99, 161, 114, 208,
+  11, 35, 32, 160, 72, 178, 156, 3, 8, 1, 116, 163, 141, 160, 57, 160, 155, 235, 43, 37, 169, 153, 137, 9,
+  213, 255, 47, 0, 146, 175, 67, 133, 11, 21, 9, 18, 161, 205, 56, 50, 1, 168, 56, 135, 156, 48, 145, 175,
+  153, 16, 137, 16, 0, 19, 175, 33, 130, 17, 146, 206, 41, 36, 192, 43, 19, 129, 59, 23, 137, 137, 131, 175,
+  136, 64, 3, 218, 9, 0, 82, 211, 156, 128, 9, 34, 160, 25, 19, 152, 235, 72, 36, 130, 202, 42, 84, 18,
+  176, 158, 0, 137, 16, 36, 232, 138, 33, 154, 202, 82, 161, 137, 17, 130, 156, 138, 145, 58, 38, 146, 140, 202,
+  80, 68, 17, 2, 136, 218, 174, 66, 161, 156, 137, 16, 128, 144, 138, 69, 129, 186, 48, 200, 173, 33, 51, 2,
+  35, 141, 192, 175, 80, 1, 9, 130, 66, 99, 130, 12, 69, 16, 52, 0, 11,
+};
+
+extern const uint8_t waveform_cymbal_2_adpcm[] PROGMEM = { // 4818 samples
+  199, 245, 0, 0, 119, 247, 255, 119, 244, 142, 53, 128, 191, 0, 37, 137, 170, 11, 34, 50, 37, 154, 251, 9,
+  0, 49, 144, 57, 186, 122, 3, 233, 160, 41, 113, 170, 128, 23, 168, 140, 17, 147, 128, 11, 172, 66, 17, 176,
+  170, 2, 55, 174, 57, 0, 161, 8, 58, 18, 114, 161, 187, 235, 128, 1, 39, 74, 136, 219, 136, 17, 113, 137,
+  2, 171, 144, 42, 40, 178, 148, 144, 34, 240, 200, 168, 99, 3, 59, 137, 219, 76, 10, 120, 129, 144, 176, 139,
+  40, 123, 180, 56, 160, 162, 57, 154, 248, 136, 130, 54, 160, 208, 168, 144, 56, 1, 83, 32, 186, 169, 175, 33,
+  58, 66, 179, 16, 154, 143, 168, 8, 84, 40, 154, 4, 227, 13, 79, 0, 232, 146, 8, 128, 130, 81, 208, 129,
+  184, 52, 138, 200, 1, 128, 153, 125, 25, 146, 0, 74, 139, 30, 145, 33, 14, 3, 128, 56, 45, 13, 152, 16,
+  130, 73, 24, 196, 41, 202, 40, 137, 180, 4, 169, 22, 168, 200, 1, 28, 163, 53, 200, 209, 145, 130, 75, 9,
+  162, 42, 17, 94, 9, 152, 138, 104, 40, 169, 64, 10, 241, 8, 24, 3, 91, 184, 168, 162, 35, 90, 250, 20,
+  168, 129, 140, 32, 166, 1, 170, 145, 9, 163, 114, 139, 1, 96, 172, 64, 45, 16, 59, 10, 128, 78, 91, 26,
+  152, 146, 58, 60, 75, 176, 166, 144, 26, 195, 131, 166, 137, 137, 177, 7, 153, 33, 185, 180, 147, 9, 64, 10,
+  166, 238, 77, 0, 228, 147, 25, 145, 10, 196, 16, 40, 193, 1, 11, 57, 163, 198, 42, 8, 9, 195, 183, 48,
+  10, 60, 160, 178, 120, 185, 2, 208, 148, 34, 186, 227, 128, 32, 89, 137, 129, 28, 43, 128, 152, 165, 34, 24,
+  131, 223, 16, 75, 50, 45, 60, 139, 56, 192, 121, 138, 146, 129, 196, 56, 139, 152, 163, 164, 113, 140, 130, 9,
+  144, 88, 29, 179, 16, 28, 17, 11, 181, 88, 30, 0, 25, 161, 32, 44, 226, 16, 160, 88, 138, 195, 130, 42,
+  24, 139, 198, 17, 60, 8, 177, 211, 1, 76, 8, 144, 144, 17, 12, 163, 227, 32, 43, 184, 167, 145, 3, 12,
+  194, 164, 42, 73, 153, 165, 178, 0, 169, 56, 145, 9, 250, 6, 68, 0, 125, 9, 144, 10, 40, 47, 176, 132,
+  48, 140, 163, 184, 20, 31, 40, 24, 43, 161, 11, 25, 121, 41, 26, 160, 161, 125, 137, 146, 192, 180, 3, 27,
+  196, 161, 198, 32, 153, 180, 17, 153, 48, 12, 180, 80, 29, 41, 10, 178, 49, 46, 144, 73, 200, 3, 45, 144,
+  41, 144, 129, 8, 230, 33, 170, 180, 145, 163, 65, 138, 177, 178, 244, 34, 29, 161, 147, 161, 161, 92, 137, 147,
+  8, 195, 43, 136, 2, 77, 200, 66, 185, 133, 138, 152, 2, 137, 135, 41, 184, 162, 208, 34, 61, 0, 75, 169,
+  132, 43, 8, 57, 159, 19, 107, 136, 177, 152, 40, 123, 177, 212, 147, 58, 153, 56, 240, 147, 73, 153, 165, 9,
+  191, 255, 78, 0, 8, 59, 225, 181, 89, 137, 1, 192, 164, 90, 11, 162, 162, 148, 73, 12, 178, 40, 128, 122,
+  154, 180, 17, 10, 56, 12, 197, 32, 27, 129, 137, 212, 2, 168, 197, 17, 184, 18, 168, 162, 34, 140, 2, 13,
+  196, 2, 25, 128, 138, 195, 32, 105, 139, 49, 156, 35, 15, 8, 57, 227, 180, 2, 139, 178, 245, 18, 59, 25,
+  208, 181, 146, 57, 138, 195, 211, 3, 43, 8, 193, 146, 56, 47, 144, 178, 3, 76, 28, 194, 1, 136, 57, 8,
+  136, 40, 152, 48, 143, 1, 62, 227, 147, 9, 129, 78, 184, 165, 0, 57, 77, 168, 179, 16, 42, 107, 170, 149,
+  24, 25, 57, 13, 146, 91, 137, 129, 128, 1, 78, 10, 24, 202, 79, 0, 164, 146, 130, 76, 200, 181, 0, 145,
+  24, 161, 180, 32, 12, 56, 202, 150, 16, 59, 42, 139, 164, 123, 59, 136, 40, 26, 61, 27, 162, 163, 130, 11,
+  179, 246, 147, 8, 42, 243, 197, 147, 25, 26, 228, 180, 130, 74, 44, 152, 179, 146, 56, 61, 169, 148, 25, 41,
+  144, 242, 131, 76, 9, 160, 180, 162, 89, 138, 179, 179, 146, 73, 185, 183, 146, 56, 61, 184, 198, 130, 41, 75,
+  152, 177, 147, 74, 92, 10, 128, 178, 48, 77, 28, 136, 161, 19, 91, 11, 24, 169, 166, 56, 28, 24, 26, 178,
+  1, 152, 65, 63, 154, 145, 129, 82, 79, 154, 179, 129, 146, 74, 186, 182, 148, 0, 57, 140, 212, 146, 16, 11,
+  27, 21, 77, 0, 27, 194, 162, 129, 59, 91, 168, 148, 178, 74, 42, 9, 227, 195, 32, 170, 150, 129, 226, 146,
+  144, 163, 24, 217, 167, 146, 179, 123, 44, 136, 194, 164, 32, 62, 137, 161, 179, 32, 91, 26, 9, 144, 176, 148,
+  16, 24, 168, 183, 162, 136, 24, 153, 167, 3, 75, 12, 177, 196, 18, 94, 43, 160, 2, 42, 78, 27, 136, 1,
+  144, 33, 46, 136, 8, 169, 150, 8, 195, 49, 30, 144, 8, 194, 2, 61, 160, 2, 210, 129, 44, 136, 33, 169,
+  51, 63, 201, 148, 42, 74, 75, 225, 163, 57, 26, 136, 211, 130, 42, 152, 149, 152, 179, 42, 209, 164, 164, 162,
+  56, 248, 164, 24, 9, 40, 225, 164, 40, 10, 16, 0, 188, 235, 70, 0, 182, 1, 43, 129, 168, 199, 48, 61,
+  137, 145, 161, 104, 45, 176, 164, 129, 40, 77, 168, 162, 129, 24, 75, 139, 167, 32, 59, 44, 11, 180, 121, 26,
+  41, 43, 160, 32, 186, 5, 60, 193, 33, 171, 167, 24, 144, 121, 27, 177, 17, 138, 81, 47, 144, 40, 153, 146,
+  74, 168, 18, 12, 146, 25, 243, 148, 26, 178, 16, 226, 164, 8, 177, 2, 192, 149, 25, 144, 145, 8, 161, 123,
+  176, 165, 162, 73, 45, 152, 146, 0, 56, 59, 216, 178, 177, 4, 152, 215, 164, 162, 24, 144, 227, 146, 128, 128,
+  227, 180, 2, 137, 32, 186, 164, 179, 1, 121, 12, 180, 24, 144, 72, 45, 144, 57, 169, 135, 76, 10, 107, 10,
+  247, 241, 80, 0, 0, 25, 161, 56, 62, 137, 136, 211, 33, 26, 24, 153, 195, 16, 60, 42, 136, 215, 2, 26,
+  41, 11, 243, 132, 58, 58, 46, 153, 164, 0, 40, 92, 138, 211, 146, 24, 41, 10, 211, 2, 26, 152, 196, 211,
+  147, 41, 209, 147, 161, 146, 8, 242, 181, 56, 153, 130, 193, 164, 89, 138, 145, 161, 228, 34, 45, 8, 136, 128,
+  0, 43, 227, 1, 136, 57, 184, 150, 57, 28, 24, 137, 128, 64, 63, 152, 160, 167, 57, 76, 10, 145, 16, 109,
+  27, 144, 0, 58, 91, 153, 180, 17, 44, 42, 153, 212, 163, 64, 76, 27, 176, 181, 162, 1, 58, 27, 179, 198,
+  164, 40, 45, 153, 17, 178, 34, 44, 10, 75, 139, 5, 135, 241, 71, 0, 128, 1, 91, 11, 165, 73, 137, 75,
+  170, 198, 131, 24, 41, 202, 199, 130, 41, 25, 176, 166, 16, 44, 152, 145, 163, 104, 60, 11, 178, 1, 73, 60,
+  10, 41, 91, 43, 176, 35, 63, 60, 185, 183, 130, 74, 26, 152, 196, 2, 153, 129, 136, 211, 148, 24, 128, 10,
+  226, 179, 130, 32, 76, 153, 194, 0, 40, 108, 10, 195, 1, 42, 43, 9, 24, 76, 160, 179, 49, 45, 241, 196,
+  1, 25, 58, 152, 181, 130, 25, 78, 138, 195, 131, 75, 91, 11, 146, 40, 59, 11, 74, 78, 58, 27, 129, 76,
+  43, 9, 145, 162, 130, 47, 152, 1, 180, 17, 138, 171, 215, 165, 17, 137, 177, 211, 130, 0, 144, 18, 217, 3,
+  21, 247, 67, 0, 8, 77, 136, 0, 146, 75, 42, 208, 129, 168, 120, 9, 17, 9, 141, 181, 24, 210, 130, 32,
+  168, 2, 250, 148, 57, 154, 178, 148, 150, 41, 138, 128, 28, 193, 35, 25, 32, 26, 140, 25, 30, 128, 124, 9,
+  162, 165, 146, 28, 11, 160, 6, 32, 26, 224, 179, 178, 144, 72, 25, 145, 166, 9, 8, 153, 167, 8, 74, 137,
+  131, 41, 27, 78, 152, 161, 164, 153, 81, 43, 1, 233, 16, 25, 194, 183, 146, 42, 160, 180, 164, 40, 61, 137,
+  33, 241, 145, 40, 138, 35, 200, 147, 41, 15, 211, 129, 3, 74, 10, 27, 27, 210, 4, 25, 160, 0, 49, 63,
+  11, 192, 122, 136, 57, 177, 211, 164, 25, 41, 29, 2, 244, 254, 65, 0, 184, 183, 40, 27, 145, 80, 168, 162,
+  56, 14, 41, 209, 132, 25, 56, 154, 58, 59, 31, 128, 179, 151, 0, 153, 192, 128, 33, 106, 128, 56, 251, 179,
+  57, 243, 3, 10, 162, 8, 184, 82, 47, 160, 1, 128, 16, 79, 153, 1, 152, 129, 108, 138, 1, 145, 146, 75,
+  13, 129, 24, 211, 146, 211, 16, 144, 10, 163, 74, 32, 29, 146, 169, 33, 62, 168, 147, 3, 73, 60, 143, 209,
+  2, 3, 42, 160, 171, 161, 162, 6, 58, 130, 241, 197, 1, 44, 42, 25, 166, 145, 56, 15, 8, 161, 34, 25,
+  91, 29, 168, 34, 12, 130, 56, 45, 0, 60, 208, 8, 161, 1, 64, 145, 178, 172, 165, 26, 129, 19, 242, 4,
+  233, 248, 66, 0, 145, 184, 2, 10, 167, 33, 59, 203, 197, 163, 17, 75, 136, 209, 194, 50, 62, 26, 153, 162,
+  18, 124, 137, 160, 160, 148, 105, 137, 145, 25, 225, 19, 26, 168, 43, 210, 134, 0, 136, 59, 172, 150, 130, 24,
+  60, 27, 160, 130, 57, 73, 46, 176, 146, 24, 228, 32, 12, 164, 2, 170, 147, 90, 168, 164, 168, 2, 74, 179,
+  227, 58, 43, 123, 160, 33, 13, 74, 58, 137, 148, 43, 209, 41, 57, 161, 132, 216, 161, 131, 123, 153, 195, 130,
+  137, 112, 27, 193, 130, 10, 130, 106, 9, 137, 8, 129, 104, 12, 128, 176, 149, 1, 42, 12, 137, 167, 2, 137,
+  26, 9, 181, 198, 32, 137, 24, 41, 226, 129, 25, 0, 116, 244, 60, 0, 72, 209, 130, 27, 161, 131, 74, 128,
+  184, 196, 129, 10, 112, 74, 144, 60, 140, 16, 124, 9, 144, 9, 148, 73, 11, 139, 164, 164, 5, 12, 161, 161,
+  3, 76, 186, 165, 146, 147, 40, 14, 181, 129, 44, 25, 90, 129, 8, 75, 28, 59, 138, 106, 24, 16, 40, 15,
+  136, 168, 34, 124, 9, 160, 146, 177, 16, 192, 228, 163, 33, 129, 224, 162, 153, 35, 91, 193, 161, 1, 129, 152,
+  153, 88, 75, 226, 164, 128, 106, 9, 153, 227, 17, 57, 10, 144, 177, 5, 44, 74, 28, 8, 40, 27, 179, 34,
+  63, 170, 210, 181, 48, 76, 9, 211, 178, 129, 76, 9, 162, 179, 162, 88, 27, 168, 245, 130, 73, 42, 9, 8,
+  75, 242, 69, 0, 179, 57, 62, 152, 162, 182, 18, 11, 138, 128, 146, 150, 57, 193, 56, 186, 145, 213, 130, 73,
+  26, 179, 1, 187, 121, 29, 161, 148, 16, 32, 31, 192, 162, 1, 24, 57, 161, 148, 42, 12, 46, 136, 64, 144,
+  16, 26, 46, 57, 46, 152, 145, 49, 124, 43, 168, 177, 146, 105, 9, 178, 180, 196, 0, 26, 210, 131, 194, 17,
+  46, 160, 147, 146, 136, 43, 139, 52, 41, 164, 155, 136, 95, 28, 129, 17, 144, 124, 12, 144, 1, 1, 91, 11,
+  178, 17, 129, 62, 140, 148, 56, 192, 40, 138, 181, 64, 155, 17, 26, 197, 17, 155, 148, 128, 8, 40, 46, 179,
+  17, 171, 48, 155, 151, 24, 153, 114, 63, 137, 152, 2, 217, 238, 65, 0, 1, 121, 26, 152, 210, 162, 32, 41,
+  74, 243, 161, 161, 1, 48, 171, 183, 146, 177, 16, 45, 179, 150, 144, 41, 46, 8, 128, 0, 56, 61, 169, 0,
+  10, 114, 45, 144, 152, 56, 136, 105, 138, 8, 163, 56, 45, 139, 8, 230, 132, 25, 9, 25, 225, 147, 56, 10,
+  178, 244, 162, 40, 73, 26, 177, 16, 154, 146, 90, 25, 106, 26, 194, 1, 12, 123, 10, 1, 194, 1, 73, 31,
+  145, 160, 164, 0, 57, 200, 130, 177, 131, 91, 153, 162, 24, 25, 41, 133, 185, 64, 12, 105, 169, 124, 42, 9,
+  33, 156, 32, 61, 24, 193, 41, 176, 17, 194, 167, 136, 0, 11, 164, 48, 75, 200, 18, 216, 2, 61, 226, 1,
+  154, 252, 66, 0, 58, 10, 90, 201, 148, 128, 0, 128, 241, 164, 0, 8, 8, 193, 149, 9, 128, 57, 154, 132,
+  42, 128, 74, 45, 168, 49, 136, 57, 143, 122, 10, 163, 129, 25, 154, 129, 183, 130, 61, 9, 129, 130, 45, 194,
+  169, 165, 33, 123, 152, 24, 185, 1, 123, 168, 164, 130, 59, 25, 160, 178, 243, 24, 177, 167, 2, 192, 32, 60,
+  13, 163, 195, 131, 91, 11, 196, 145, 2, 45, 74, 160, 146, 128, 62, 138, 196, 18, 0, 43, 169, 209, 4, 26,
+  195, 146, 25, 92, 137, 144, 166, 74, 42, 154, 165, 178, 121, 59, 27, 179, 128, 24, 139, 145, 167, 16, 145, 193,
+  130, 28, 137, 196, 164, 3, 26, 40, 171, 208, 2, 12, 247, 250, 58, 0, 26, 164, 211, 32, 31, 152, 1, 73,
+  129, 25, 217, 194, 73, 145, 80, 44, 137, 145, 168, 112, 28, 128, 144, 179, 35, 46, 10, 25, 241, 148, 24, 128,
+  58, 154, 195, 164, 16, 73, 14, 197, 162, 1, 58, 27, 195, 16, 40, 139, 145, 245, 2, 26, 24, 24, 200, 20,
+  30, 144, 145, 145, 179, 56, 208, 51, 15, 161, 128, 16, 121, 28, 161, 16, 41, 60, 62, 168, 129, 2, 60, 90,
+  154, 16, 170, 120, 9, 0, 8, 169, 165, 145, 194, 49, 141, 132, 59, 176, 182, 145, 129, 75, 10, 180, 16, 128,
+  92, 43, 243, 147, 136, 58, 61, 9, 130, 129, 152, 77, 155, 19, 168, 151, 72, 30, 160, 162, 164, 1, 42, 8,
+  247, 243, 61, 0, 0, 226, 19, 26, 200, 146, 160, 134, 25, 211, 0, 153, 2, 77, 176, 81, 11, 144, 40, 138,
+  120, 10, 145, 152, 162, 112, 29, 161, 161, 166, 48, 46, 168, 146, 194, 35, 31, 161, 129, 8, 0, 61, 152, 17,
+  152, 18, 47, 176, 32, 59, 184, 122, 160, 66, 156, 195, 33, 11, 17, 61, 241, 2, 9, 130, 43, 200, 129, 8,
+  148, 73, 208, 3, 156, 182, 129, 16, 9, 9, 215, 17, 9, 58, 10, 242, 131, 41, 75, 42, 184, 148, 59, 91,
+  43, 176, 166, 40, 137, 17, 46, 192, 3, 138, 148, 58, 0,
+};
+
+extern const uint8_t waveform_hi_bongo_adpcm[] PROGMEM = { // 422 samples
+  15, 1, 0, 0, 247, 255, 255, 111, 124, 71, 128, 235, 138, 137, 32, 67, 35, 129, 188, 171, 186, 64, 68, 19,
+  152, 187, 190, 137, 67, 51, 1, 152, 235, 203, 136, 65, 68, 19, 169, 219, 203, 9, 67, 51, 18, 152, 205, 187,
+  8, 65, 83, 19, 161, 189, 187, 10, 66, 53, 2, 184, 203, 156, 25, 66, 52, 1, 200, 188, 171, 57, 84, 51,
+  130, 218, 203, 154, 40, 83, 51, 130, 200, 189, 155, 24, 68, 36, 130, 218, 186, 137, 40, 67, 36, 129, 187, 219,
+  170, 56, 84, 34, 128, 218, 171, 10, 65, 83, 2, 160, 187, 189, 138, 66, 68, 18, 144, 219, 187, 9, 65, 67,
+  18, 160, 188, 171, 137, 66, 52, 19, 184, 220, 186, 8, 141, 226, 65, 0, 67, 52, 129, 186, 189, 154, 32, 53,
+  35, 129, 218, 203, 170, 32, 84, 35, 145, 202, 188, 154, 49, 53, 34, 128, 218, 187, 138, 48, 53, 20, 144, 203,
+  172, 9, 66, 51, 3, 184, 205, 171, 24, 66, 52, 3, 200, 219, 155, 25, 67, 52, 1, 185, 204, 154, 24, 67,
+  20, 2, 185, 204, 154, 24, 83, 35, 130, 218, 203, 137, 33, 36, 19, 144, 203, 203, 138, 49, 84, 34, 161, 204,
+  171, 9, 2,
+};
+
+extern const uint8_t waveform_steel_bell_c6_adpcm[] PROGMEM = { // 4019 samples
+  95, 229, 0, 0, 119, 255, 127, 95, 247, 214, 19, 139, 107, 136, 178, 161, 120, 138, 177, 3, 72, 142, 164, 129,
+  42, 61, 211, 161, 49, 77, 186, 130, 166, 58, 11, 131, 208, 122, 137, 195, 128, 121, 155, 178, 165, 34, 47, 8,
+  243, 130, 107, 136, 200, 3, 74, 170, 146, 151, 42, 44, 145, 243, 48, 91, 138, 208, 20, 27, 43, 161, 167, 43,
+  56, 208, 162, 121, 9, 186, 167, 33, 46, 59, 196, 145, 74, 57, 217, 130, 48, 139, 185, 7, 25, 45, 145, 197,
+  8, 105, 138, 209, 3, 16, 14, 129, 146, 136, 107, 161, 176, 88, 74, 201, 163, 19, 45, 12, 147, 211, 40, 57,
+  184, 192, 67, 27, 185, 149, 19, 15, 8, 180, 145, 11, 41, 58, 83, 0, 10, 248, 130, 64, 12, 136, 148, 8,
+  44, 129, 227, 16, 74, 153, 192, 4, 57, 13, 145, 181, 25, 90, 136, 193, 32, 24, 170, 162, 21, 28, 10, 181,
+  179, 91, 57, 224, 162, 49, 27, 155, 150, 1, 28, 24, 211, 128, 106, 9, 209, 2, 40, 29, 152, 166, 128, 75,
+  9, 210, 0, 48, 154, 193, 35, 59, 15, 179, 148, 42, 77, 176, 178, 18, 89, 171, 146, 132, 43, 11, 151, 144,
+  74, 42, 242, 129, 64, 28, 168, 147, 130, 62, 25, 194, 161, 105, 137, 160, 2, 72, 141, 145, 148, 24, 61, 144,
+  210, 1, 90, 153, 144, 132, 25, 139, 2, 195, 91, 42, 194, 193, 96, 26, 153, 179, 133, 44, 26, 162, 178, 10,
+  128, 8, 79, 0, 40, 234, 146, 96, 138, 152, 149, 24, 45, 8, 212, 129, 73, 9, 200, 3, 24, 11, 144, 151,
+  26, 58, 177, 197, 56, 74, 155, 211, 19, 26, 45, 161, 163, 43, 121, 168, 161, 48, 41, 220, 149, 17, 44, 10,
+  181, 161, 72, 42, 208, 129, 33, 28, 153, 133, 8, 44, 144, 196, 0, 105, 153, 177, 131, 56, 15, 129, 179, 128,
+  91, 144, 176, 33, 105, 186, 162, 5, 44, 27, 164, 195, 57, 75, 192, 194, 50, 43, 171, 148, 3, 31, 24, 195,
+  161, 123, 25, 184, 147, 65, 13, 136, 164, 0, 43, 1, 242, 0, 73, 137, 184, 5, 41, 12, 128, 165, 25, 74,
+  136, 241, 17, 24, 138, 161, 5, 11, 43, 164, 179, 12, 176, 245, 80, 0, 72, 217, 162, 49, 42, 142, 148, 129,
+  27, 74, 178, 160, 80, 25, 249, 2, 32, 12, 152, 150, 136, 75, 8, 194, 128, 65, 139, 168, 4, 0, 14, 130,
+  162, 27, 123, 161, 193, 33, 57, 173, 147, 149, 25, 44, 146, 192, 56, 73, 208, 144, 51, 13, 153, 132, 146, 46,
+  24, 177, 193, 96, 9, 153, 146, 34, 142, 0, 148, 136, 60, 129, 224, 1, 88, 138, 168, 133, 25, 28, 1, 195,
+  25, 74, 160, 208, 66, 9, 170, 163, 134, 27, 58, 195, 211, 57, 56, 187, 163, 115, 139, 11, 150, 0, 44, 40,
+  243, 128, 56, 9, 217, 4, 0, 28, 9, 148, 137, 73, 128, 225, 40, 56, 155, 177, 22, 10, 46, 145, 162, 9,
+  51, 230, 78, 0, 121, 168, 160, 18, 40, 157, 131, 147, 12, 58, 166, 168, 88, 41, 232, 129, 18, 27, 154, 134,
+  160, 59, 16, 211, 152, 112, 153, 176, 3, 34, 143, 129, 179, 136, 108, 128, 168, 1, 72, 186, 128, 6, 26, 12,
+  131, 226, 57, 57, 176, 208, 51, 27, 140, 130, 151, 27, 40, 177, 193, 105, 0, 201, 130, 49, 141, 25, 149, 144,
+  43, 48, 241, 8, 64, 137, 170, 5, 8, 12, 1, 165, 10, 90, 136, 225, 17, 32, 140, 144, 4, 138, 75, 146,
+  194, 26, 65, 217, 145, 50, 26, 143, 131, 145, 43, 106, 194, 152, 48, 41, 234, 18, 17, 13, 137, 133, 168, 90,
+  0, 225, 128, 49, 139, 168, 5, 144, 29, 1, 162, 10, 171, 226, 74, 0, 121, 160, 168, 33, 48, 158, 1, 148,
+  10, 44, 132, 200, 32, 56, 217, 136, 36, 11, 154, 5, 178, 31, 32, 177, 176, 112, 136, 154, 130, 35, 158, 32,
+  162, 168, 76, 18, 233, 1, 48, 186, 153, 23, 9, 28, 32, 226, 25, 56, 144, 201, 66, 136, 140, 130, 5, 13,
+  57, 161, 209, 73, 32, 202, 146, 34, 154, 29, 133, 144, 27, 64, 225, 8, 48, 9, 234, 19, 128, 28, 25, 151,
+  153, 56, 8, 208, 40, 50, 142, 144, 19, 138, 46, 130, 194, 9, 104, 184, 144, 19, 16, 159, 2, 162, 26, 74,
+  165, 185, 80, 41, 217, 1, 19, 13, 10, 132, 177, 76, 16, 176, 169, 114, 153, 152, 3, 2, 143, 1, 179, 8,
+  19, 230, 74, 0, 106, 145, 201, 18, 72, 155, 8, 135, 10, 27, 3, 225, 40, 56, 169, 217, 52, 10, 12, 130,
+  148, 13, 56, 161, 209, 72, 0, 171, 130, 67, 156, 42, 151, 152, 42, 64, 224, 0, 32, 137, 171, 7, 8, 27,
+  24, 181, 138, 80, 136, 208, 33, 16, 142, 145, 4, 153, 75, 145, 177, 25, 113, 185, 145, 34, 26, 143, 132, 145,
+  27, 73, 194, 168, 81, 25, 201, 17, 2, 14, 8, 132, 184, 90, 0, 192, 8, 82, 155, 152, 4, 128, 31, 1,
+  178, 137, 121, 160, 152, 18, 56, 173, 1, 148, 10, 59, 133, 224, 40, 56, 185, 152, 23, 138, 138, 3, 195, 45,
+  32, 193, 176, 112, 136, 169, 131, 34, 143, 24, 164, 8, 149, 234, 77, 0, 58, 17, 249, 1, 32, 153, 138, 7,
+  137, 27, 17, 212, 25, 72, 137, 200, 50, 8, 13, 145, 133, 139, 73, 161, 177, 73, 33, 204, 146, 51, 12, 29,
+  148, 144, 43, 88, 209, 8, 48, 9, 219, 20, 128, 28, 8, 165, 153, 105, 8, 192, 16, 33, 141, 128, 3, 152,
+  47, 146, 177, 25, 120, 168, 152, 34, 41, 158, 3, 179, 27, 91, 163, 233, 49, 24, 232, 0, 19, 13, 9, 132,
+  160, 61, 16, 192, 144, 113, 153, 137, 131, 1, 15, 1, 178, 136, 90, 145, 216, 18, 56, 187, 128, 135, 26, 43,
+  3, 241, 41, 56, 169, 184, 54, 154, 139, 132, 148, 30, 56, 193, 177, 88, 24, 171, 131, 50, 142, 42, 149, 9,
+  180, 236, 74, 0, 58, 32, 240, 24, 48, 154, 185, 23, 137, 28, 1, 180, 10, 80, 152, 200, 49, 16, 142, 129,
+  132, 139, 91, 146, 193, 41, 80, 202, 129, 34, 10, 141, 133, 144, 43, 56, 212, 152, 65, 26, 217, 18, 2, 14,
+  8, 148, 168, 90, 0, 192, 0, 80, 155, 144, 4, 8, 30, 1, 193, 8, 105, 160, 168, 19, 57, 173, 18, 148,
+  28, 42, 147, 232, 72, 40, 201, 145, 20, 139, 10, 133, 178, 45, 32, 192, 144, 112, 152, 169, 132, 17, 141, 16,
+  180, 136, 74, 16, 233, 17, 32, 170, 168, 7, 137, 42, 1, 212, 42, 72, 153, 192, 66, 9, 140, 130, 148, 11,
+  89, 161, 176, 73, 33, 251, 130, 18, 139, 11, 135, 0, 167, 241, 74, 0, 42, 72, 241, 128, 33, 10, 185, 20,
+  128, 29, 128, 149, 138, 105, 152, 193, 1, 49, 157, 129, 131, 137, 46, 130, 177, 25, 120, 184, 152, 51, 42, 143,
+  2, 162, 44, 58, 180, 200, 65, 25, 201, 1, 20, 141, 8, 148, 160, 76, 16, 192, 144, 97, 138, 153, 132, 1,
+  14, 1, 178, 136, 89, 145, 201, 34, 57, 172, 129, 135, 10, 42, 130, 241, 40, 32, 185, 176, 53, 139, 12, 132,
+  163, 30, 56, 209, 161, 88, 8, 186, 132, 17, 12, 41, 165, 152, 58, 48, 248, 24, 49, 155, 201, 7, 136, 43,
+  0, 196, 137, 80, 152, 192, 49, 0, 142, 129, 3, 139, 91, 179, 176, 57, 112, 201, 129, 18, 10, 141, 133, 1,
+  146, 240, 73, 0, 42, 40, 227, 152, 65, 9, 201, 18, 2, 15, 0, 163, 168, 122, 128, 184, 0, 66, 171, 128,
+  133, 136, 30, 2, 193, 24, 106, 176, 168, 20, 41, 156, 2, 164, 28, 41, 148, 216, 48, 24, 201, 145, 37, 140,
+  9, 148, 161, 45, 33, 208, 144, 80, 152, 154, 4, 16, 141, 32, 195, 9, 90, 129, 232, 17, 40, 170, 144, 7,
+  138, 42, 130, 227, 42, 49, 185, 208, 82, 137, 139, 132, 147, 13, 73, 194, 144, 56, 32, 220, 2, 33, 155, 26,
+  135, 168, 58, 32, 243, 9, 65, 138, 201, 20, 144, 28, 1, 163, 156, 96, 160, 193, 17, 33, 158, 129, 132, 137,
+  60, 147, 200, 40, 104, 185, 128, 35, 27, 158, 20, 1, 246, 244, 70, 0, 43, 40, 196, 184, 97, 9, 184, 130,
+  5, 141, 0, 147, 176, 92, 129, 184, 0, 113, 154, 152, 133, 8, 12, 18, 210, 8, 73, 144, 201, 35, 24, 172,
+  1, 135, 11, 41, 130, 241, 57, 16, 185, 161, 53, 155, 27, 149, 162, 29, 49, 225, 144, 72, 128, 187, 21, 16,
+  141, 24, 165, 137, 73, 16, 248, 16, 16, 153, 152, 21, 153, 44, 129, 180, 27, 112, 168, 176, 34, 16, 143, 130,
+  130, 139, 90, 179, 168, 72, 48, 250, 0, 18, 11, 139, 7, 168, 75, 40, 210, 137, 66, 138, 185, 51, 130, 143,
+  1, 164, 169, 123, 145, 176, 17, 65, 157, 128, 132, 136, 28, 3, 208, 41, 72, 176, 169, 37, 26, 157, 3, 4,
+  92, 251, 69, 0, 28, 40, 162, 232, 64, 8, 169, 129, 36, 142, 8, 148, 144, 60, 17, 232, 129, 88, 137, 138,
+  132, 24, 13, 32, 195, 9, 57, 145, 248, 33, 16, 171, 161, 7, 138, 58, 146, 243, 41, 48, 186, 160, 68, 137,
+  141, 132, 129, 13, 48, 210, 144, 56, 40, 204, 19, 1, 12, 10, 135, 153, 57, 16, 241, 8, 49, 139, 184, 22,
+  152, 29, 1, 162, 138, 120, 160, 176, 33, 33, 159, 2, 130, 11, 45, 149, 168, 56, 89, 201, 128, 19, 27, 155,
+  6, 177, 44, 16, 195, 169, 113, 136, 185, 18, 35, 159, 1, 163, 168, 93, 129, 184, 1, 80, 186, 136, 6, 9,
+  12, 3, 226, 41, 57, 144, 217, 51, 9, 156, 1, 7, 73, 254, 72, 0, 138, 40, 162, 192, 89, 16, 186, 146,
+  83, 140, 10, 133, 144, 27, 65, 224, 128, 48, 136, 203, 5, 0, 12, 24, 166, 137, 73, 8, 208, 32, 32, 155,
+  168, 7, 153, 58, 130, 194, 27, 112, 184, 160, 66, 8, 142, 131, 129, 11, 106, 178, 168, 72, 56, 235, 17, 18,
+  12, 154, 135, 152, 74, 24, 193, 152, 82, 138, 169, 20, 145, 14, 1, 162, 137, 122, 161, 168, 17, 64, 172, 1,
+  149, 9, 29, 3, 200, 40, 72, 184, 169, 38, 138, 154, 4, 179, 30, 40, 162, 200, 96, 8, 170, 130, 51, 143,
+  24, 163, 160, 61, 18, 248, 16, 56, 169, 154, 7, 8, 12, 17, 194, 9, 72, 128, 217, 49, 0, 156, 145, 7,
+  146, 255, 71, 0, 138, 41, 162, 210, 57, 64, 186, 161, 67, 138, 14, 132, 145, 11, 64, 226, 136, 48, 24, 219,
+  19, 129, 13, 8, 150, 168, 56, 0, 224, 24, 50, 156, 152, 20, 152, 31, 130, 162, 138, 120, 168, 160, 34, 32,
+  159, 2, 146, 138, 74, 148, 201, 48, 57, 248, 0, 19, 12, 138, 4, 193, 75, 16, 193, 168, 97, 152, 153, 3,
+  2, 143, 16, 179, 152, 123, 129, 201, 17, 48, 171, 25, 135, 137, 27, 19, 242, 41, 56, 184, 216, 67, 9, 155,
+  131, 150, 12, 56, 161, 209, 72, 0, 202, 130, 66, 155, 43, 151, 144, 44, 48, 224, 0, 32, 137, 202, 21, 8,
+  12, 16, 180, 138, 88, 128, 224, 32, 16, 155, 161, 7, 31, 253, 69, 0, 137, 59, 146, 193, 25, 81, 185, 144,
+  50, 9, 159, 4, 145, 27, 74, 196, 168, 65, 41, 202, 17, 3, 14, 9, 133, 168, 74, 0, 192, 136, 98, 154,
+  152, 3, 129, 15, 2, 178, 153, 121, 144, 169, 34, 48, 189, 17, 149, 10, 44, 132, 208, 40, 56, 200, 152, 37,
+  139, 138, 19, 179, 15, 33, 194, 184, 120, 128, 170, 3, 34, 143, 24, 163, 160, 91, 17, 233, 16, 48, 170, 169,
+  23, 137, 11, 18, 197, 26, 88, 152, 200,
+};
+
+extern const uint32_t drum_waveform_size[] = { // number of samples in each
+  1474, 961, 2818, 4818, 422, 4019
+};
+
+#endif // DO_PERCUSSION && COMPRESSED_PERCUSSION
@@ -0,0 +1,78 @@
+/* synth_Playtune_adpcm.h
+
+    The IMA-ADPCM format that synth_Playtune uses for compressed percussion waveforms
+    when COMPRESSED_PERCUSSION is on, and the decoder for it. The compressed tables in
+    synth_Playtune_adpcm.cpp are made from the ones in synth_Playtune_waves.cpp by
+    host/playtune_adpcm.cpp, which uses this same decoder to choose the codes.
+
+    Each 16-bit sample becomes a 4-bit code, so a waveform takes about a quarter of the space.
+    The samples are in blocks of ADPCM_BLOCK_SAMPLES, each of which starts with a 4-byte header
+    that holds its first sample exactly and the decoder's step index there, followed by the codes
+    for the rest of the block's samples, two to a byte, low nibble first. A block can be decoded
+    without the ones before it, and errors can't accumulate past the end of one.
+
+    Copyright (C) 2026, the Playtune_synth contributors (MIT license; see LICENSE.txt)
+*/
+
+#ifndef synth_Playtune_adpcm_h_
+#define synth_Playtune_adpcm_h_
+
+#define ADPCM_BLOCK_SAMPLES 256  // samples per block: one in the header, and 255 codes
+#define ADPCM_HEADER_BYTES 4     // first sample (little-endian), step index, unused
+#define ADPCM_BLOCK_BYTES (ADPCM_HEADER_BYTES + ADPCM_BLOCK_SAMPLES / 2) // (the last nibble is unused)
+// the size of a waveform of n samples, whose last block has only as many codes as it needs
+#define ADPCM_BYTES(n) ((n) / ADPCM_BLOCK_SAMPLES * ADPCM_BLOCK_BYTES \
+  + ((n) % ADPCM_BLOCK_SAMPLES ? ADPCM_HEADER_BYTES + (n) % ADPCM_BLOCK_SAMPLES / 2 : 0))
+
+static const int16_t adpcm_step_sizes[89] PROGMEM = {
+  7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+  50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+  337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+  2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+  15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+static const int8_t adpcm_step_changes[8] PROGMEM = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+struct adpcm_state_t { // where a decoder is
+  int32_t predictor;  // the last sample
+  int32_t step_index; // index into adpcm_step_sizes for the next one
+};
+
+// Start decoding a block, and return its first sample
+
+static inline int16_t adpcm_start_block(struct adpcm_state_t *state, const uint8_t *block) {
+  state->predictor = (int16_t)(pgm_read_byte(block) | pgm_read_byte(block + 1) << 8);
+  state->step_index = pgm_read_byte(block + 2);
+  return state->predictor;
+}
+
+// Decode one 4-bit code into the next sample
+
+static inline int16_t adpcm_decode(struct adpcm_state_t *state, uint8_t code) {
+  int32_t step = (int16_t)pgm_read_word(adpcm_step_sizes + state->step_index);
+  int32_t difference = step >> 3;
+  if (code & 4) difference += step;
+  if (code & 2) difference += step >> 1;
+  if (code & 1) difference += step >> 2;
+  int32_t predictor = code & 8 ? state->predictor - difference : state->predictor + difference;
+  if (predictor > 32767) predictor = 32767;
+  else if (predictor < -32768) predictor = -32768;
+  state->predictor = predictor;
+  int32_t step_index = state->step_index + (int8_t)pgm_read_byte(adpcm_step_changes + (code & 7));
+  state->step_index = step_index < 0 ? 0 : step_index > 88 ? 88 : step_index;
+  return predictor;
+}
+
+// Decode sample number "index" of a compressed waveform, given the decoder state after the one
+// before it. This is how a waveform is played: one sample after another, as the phase advances.
+
+static inline int16_t adpcm_next_sample(struct adpcm_state_t *state, const uint8_t *waveform, uint32_t index) {
+  const uint8_t *block = waveform + (index / ADPCM_BLOCK_SAMPLES) * ADPCM_BLOCK_BYTES;
+  uint32_t code_number = index % ADPCM_BLOCK_SAMPLES;
+  if (code_number == 0) return adpcm_start_block(state, block);
+  --code_number;
+  uint8_t codes = pgm_read_byte(block + ADPCM_HEADER_BYTES + code_number / 2);
+  return adpcm_decode(state, code_number & 1 ? codes >> 4 : codes & 0x0f);
+}
+
+#endif
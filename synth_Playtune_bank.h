@@ -0,0 +1,80 @@
+/* synth_Playtune_bank.h
+
+    The format of a sample bank: one block of data that holds all the sounds synth_Playtune
+    plays, so that they can be changed without rebuilding the program. It has the instrument
+    waveforms and their band-limited copies, the instruments' envelopes, the percussion
+    waveforms, and the two patch maps that say which instrument or drum to play for
+    a MIDI program change or percussion note.
+
+    A bank is played from wherever it is, without copying any of it: useBank() just checks it
+    and points at it. It can be a const array in flash, in RAM after being read from an SD card,
+    or memory-mapped from a file on a host. It must be aligned to 4 bytes.
+
+    A bank starts with a playtune_bank_t header. Everything else in it is found by its offset
+    from the start of the bank, and is aligned to 4 bytes. All numbers are little-endian.
+    The envelope counts and drum increments are in samples, so a bank only plays at the sample
+    rate it was made for. host/playtune_mkbank.cpp makes a bank from the built-in sounds,
+    with any of the percussion waveforms replaced by ones from WAV files.
+
+    Copyright (C) 2026, the Playtune_synth contributors (MIT license; see LICENSE.txt)
+*/
+
+#ifndef synth_Playtune_bank_h_
+#define synth_Playtune_bank_h_
+
+#define PLAYTUNE_BANK_ID "PTbk"
+#define PLAYTUNE_BANK_VERSION 1
+#define PLAYTUNE_BANK_ADPCM 0x01 // flag: the percussion waveforms are IMA-ADPCM compressed (see synth_Playtune_adpcm.h)
+
+struct playtune_envelope_t { // an instrument's DAHDSR envelope
+  int32_t delay, attack, hold, decay, release;  // count of samples for each phase
+  int32_t sustain_level;  // envelope level for sustain, as a fraction * 2^16
+  int32_t attack_incr, decay_incr, release_incr; // envelope increment per sample for those phases
+  uint32_t decay_mult, release_mult; // or multiplier per sample for exponential ones, a fraction * 2^32
+};
+
+struct playtune_bank_t { // the header at the start of a bank
+  char id[4];               // PLAYTUNE_BANK_ID, without a terminating zero
+  uint16_t version;         // PLAYTUNE_BANK_VERSION
+  uint16_t header_bytes;    // the size of this header
+  uint32_t total_bytes;     // the size of the whole bank
+  uint32_t sample_rate;     // the sample rate it was made for, in Hz, rounded
+  uint8_t num_instruments;  // how many regular instruments there are, at least 1
+  uint8_t num_drums;        //   and percussion instruments, maybe 0
+  uint8_t wave_mipmaps;     // how many band-limited copies of each instrument waveform there are
+  uint8_t flags;            // PLAYTUNE_BANK_ADPCM
+  uint32_t instruments;     // offset of num_instruments playtune_bank_instrument_t
+  uint32_t drums;           // offset of num_drums playtune_bank_drum_t
+  uint32_t instrument_patch_map; // offset of 128 instrument numbers for MIDI program numbers 0..127
+  uint32_t drum_patch_map;  // offset of 128 drum numbers for MIDI percussion notes 0..127
+};
+
+struct playtune_bank_instrument_t {
+  struct playtune_envelope_t envelope;
+  uint32_t waveforms; // offset of 1 + wave_mipmaps waveforms of 256 int16_t points:
+  //                     the original one, and then copies with only 64, 32, ... harmonics
+};
+
+struct playtune_bank_drum_t {
+  uint32_t waveform;    // offset of the samples, int16_t or IMA-ADPCM blocks
+  uint32_t num_samples; // how many samples there are, at least 2
+  uint32_t tone_incr;   // the increment that plays them at their sampling rate (2^17 per sample)
+};
+
+// The sounds in a bank, or the built-in ones if bank is NULL: what synth_Playtune plays,
+// and what host/playtune_mkbank.cpp writes into a bank. An instrument or drum number
+// that is out of range gets the first one.
+
+int playtune_num_instruments(const struct playtune_bank_t *bank);
+int playtune_num_drums(const struct playtune_bank_t *bank);
+int playtune_wave_mipmaps(const struct playtune_bank_t *bank);
+const struct playtune_envelope_t *playtune_envelope(const struct playtune_bank_t *bank, int instrument);
+const int16_t *playtune_waveform(const struct playtune_bank_t *bank, int instrument, int level); // (0 is the original)
+byte playtune_instrument_patch(const struct playtune_bank_t *bank, byte program);
+byte playtune_drum_patch(const struct playtune_bank_t *bank, byte note);
+const void *playtune_drum(const struct playtune_bank_t *bank, int drum, uint32_t *num_samples, uint32_t *tone_incr);
+
+// Check that size bytes at data are a bank that we can play, and return it, or NULL if not.
+const struct playtune_bank_t *playtune_check_bank(const void *data, uint32_t size);
+
+#endif
@@ -0,0 +1,73 @@
+/* synth_Playtune_dsp.h
+
+    The arithmetic for one sample of one tone generator in synth_Playtune, an audio object
+    for the PJRC Teensy Audio Library, written in terms of the Cortex-M4/M7 DSP instructions
+    that the Audio Library's utility/dspinst.h makes available. On other processors those
+    functions are portable C that computes exactly the same results.
+
+    These give results identical to the straightforward formulas below, but with fewer
+    instructions. playtune_bench -c checks that.
+
+      our_level = (val1 * (0xFFFF - scale) + val2 * scale) >> 16   // interpolate
+      our_level = signed_multiply_32x16b(env_mult, our_level)       // envelope
+      mix += signed_multiply_32x16b(gain_frac, our_level)           // volume and mixer attenuation
+
+    The note's volume and the mixer's amplitude fraction only change at note-on time or when
+    the number of tone generators changes, so they are combined then into one gain by
+    playtune_gain, instead of being applied to every sample one after the other.
+
+    An exponential envelope phase keeps env_mult's distance from the level it is approaching,
+    and shrinks it each sample with playtune_decay, which is a single UMULL.
+
+    Copyright (C) 2026, the Playtune_synth contributors (MIT license; see LICENSE.txt)
+*/
+
+#ifndef synth_Playtune_dsp_h_
+#define synth_Playtune_dsp_h_
+
+#include "utility/dspinst.h"
+
+// Linearly interpolate between two waveform points, 0 <= scale <= 0xFFFF.
+// The result is in the top 16 bits, which the next step can use directly with
+// a "t" (top halfword) instruction instead of shifting it down first.
+// Since val1*(0xFFFF-scale) + val2*scale == val1*0xFFFF + (val2-val1)*scale, only one
+// multiply-accumulate (MLA) is needed. The terms can overflow, but the sum can't, so we
+// do the arithmetic unsigned to get the correct wrap-around result.
+static inline int32_t playtune_interpolate(int32_t val1, int32_t val2, uint32_t scale) {
+  return (int32_t)((uint32_t)val1 * 0xFFFF + (uint32_t)(val2 - val1) * scale);
+}
+
+// Combine a note's volume and the mixer's amplitude fraction, both 0..1.0 as fractions
+// * 2^16, into one gain, rounded once instead of twice.
+static inline int32_t playtune_gain(int32_t volume_frac, int32_t amplitude_fraction) {
+  return (int32_t)(((int64_t)volume_frac * amplitude_fraction + 0x8000) >> 16);
+}
+
+// Shrink an exponential envelope's distance from its target by a multiplier that is a fraction * 2^32.
+static inline uint32_t playtune_decay(uint32_t distance, uint32_t multiplier) {
+  return (uint32_t)(((uint64_t)distance * multiplier) >> 32);
+}
+
+// e^x, for working out the decay multipliers and note frequencies at compile time. It's the
+// Taylor series for -1 <= x <= 0, e^(x/2) squared for anything less, and 1/e^-x for x > 0.
+constexpr double playtune_exp_series(double x, double term, int n) {
+  return n >= 25 ? term : term + playtune_exp_series(x, term * x / (n + 1), n + 1);
+}
+constexpr double playtune_square(double y) {
+  return y * y;
+}
+constexpr double playtune_exp(double x) {
+  return x > 0 ? 1 / playtune_exp(-x) : x < -1 ? playtune_square(playtune_exp(x / 2)) : playtune_exp_series(x, 1.0, 0);
+}
+
+// Add an interpolated sample to the mix, attenuated by the envelope and the gain: SMULWT, SMLAWB.
+static inline int32_t playtune_mix_enveloped(int32_t mix, int32_t interpolated, int32_t env_mult, int32_t gain_frac) {
+  return signed_multiply_accumulate_32x16b(mix, gain_frac, signed_multiply_32x16t(env_mult, interpolated));
+}
+
+// Add an interpolated sample to the mix, attenuated by the gain: SMLAWT.
+static inline int32_t playtune_mix(int32_t mix, int32_t interpolated, int32_t gain_frac) {
+  return signed_multiply_accumulate_32x16t(mix, gain_frac, interpolated);
+}
+
+#endif
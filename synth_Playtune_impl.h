@@ -0,0 +1,1120 @@
+/* synth_Playtune_impl.h
+
+    The member functions of AudioSynthPlaytuneT, the synth_Playtune audio object for the PJRC
+    Teensy Audio Library. They are templates, so that each instance that a program declares has
+    its own update() for its number of voices and its features, with the code for the features it
+    doesn't have left out altogether, as the #if's used to do. They are included at the end of
+    synth_Playtune.h; the tables and the functions that aren't members are in synth_Playtune.cpp.
+    See there for more information.
+
+    Copyright (C) 2016, Len Shustek; 2026, the Playtune_synth contributors (MIT license; see LICENSE.txt)
+*/
+
+#ifndef synth_Playtune_impl_h_
+#define synth_Playtune_impl_h_
+
+#include <limits.h>
+#include "utility/dspinst.h"
+#include "synth_Playtune_dsp.h"
+#ifdef PLAYTUNE_HOST_SIMD
+#include "playtune_simd.h" // vectorized kernels, for rendering on a host machine
+#endif
+
+#define MIN_NOTE 21 // we only do the piano range
+#define MAX_NOTE 108
+#define NUM_NOTES (MAX_NOTE - MIN_NOTE + 1)
+
+#define CHECKPOINT_SAMPLES ((uint32_t)(CHECKPOINT_SECONDS * AUDIO_SAMPLE_RATE + .5))
+
+// (in synth_Playtune.cpp)
+extern const uint32_t tone_incrs[NUM_NOTES]; // waveform increments for notes MIN_NOTE..MAX_NOTE
+#define MIXER_LEVELS (32 + 1) // (so any number of tone generators that are playing can look up its level)
+extern const int32_t mixer_amplitude_fractions[MIXER_LEVELS];
+extern const byte playtune_default_instrument; // I_PIANO
+byte random_byte(void);
+void playtune_checkpoint_command(struct playtune_checkpoint_t *state, const struct playtune_event_t *event);
+
+// a note's MIDI volume 0..127 as a fraction, 0x0200 to 0x10000
+static inline int32_t playtune_volume_frac(byte vol) {
+  return ((int32_t)vol + 1) << 9;
+}
+
+//------------------------------------------------------------------------------
+// Start playing a note on a particular tone generator
+// (With a voice pool, tgen is a channel, and the note gets a voice of its own.)
+//------------------------------------------------------------------------------
+
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::tune_playnote (byte tgen, byte note, byte vol) {
+  if (tgen < NUM_CHANNELS) {
+#if VOICE_POOL
+    if (note >= 128 && (!(Features & PT_PERCUSSION) || playtune_num_drums(bank) == 0)) return;
+    if (!(tune_mixed_tgens() & ((uint32_t)1 << tgen))) return; // (it wouldn't be heard)
+    tgen = tune_allocvoice(tgen);
+#endif
+    if (note >= 128) { // percussion instrument
+      if (!(Features & PT_PERCUSSION) || playtune_num_drums(bank) == 0) return; // (without it, we ignore percussion notes)
+      int drum_enum = playtune_drum_patch(bank, note - 128);
+#if DBUG
+      Serial.print("tgen="); Serial.print(tgen);
+      Serial.print(" drum="); Serial.print(drum_enum);
+      Serial.print(" vol="); Serial.println(vol);
+#endif
+      uint32_t num_samples, tone_incr;
+      const void *waveform = playtune_drum(bank, drum_enum, &num_samples, &tone_incr);
+      tune_startdrum(tgen, waveform, num_samples, tone_incr, vol);
+      return;
+    }
+    else  { // regular instrument
+      if (note < MIN_NOTE) note = MIN_NOTE;
+      if (note > MAX_NOTE) note = MAX_NOTE;
+      int instrument_index = tg.instrument_index[tgen];
+      if (Features & PT_ENVELOPE) {
+        tg.env_mult[tgen] = 0; // setup AHDSR envelope
+        tg.env_count[tgen] = playtune_envelope(bank, instrument_index)->delay; // # of samples
+        // could be zero, but that will get dealt with at the first sample time.
+        tg.env_state[tgen] = ENV_DELAY;
+        tg.env_incr[tgen] = 0;
+#if EXP_ENVELOPE
+        tg.env_decay[tgen] = 0;
+#endif
+      }
+      //compute the increment to move from one sample point on the waveform to the next
+      tg.tone_incr[tgen] = pgm_read_dword(tone_incrs + (note - MIN_NOTE));
+      int level = 0; // the original waveform
+#if BANDLIMITED_WAVES
+      // If we step through more than one point of the waveform per sample, use the band-limited copy
+      // that is made for stepping through up to 2^level points, whose harmonics all stay below the
+      // Nyquist frequency. tone_incr is the step in points * 2^23.
+      // (If there aren't that many copies, playtune_waveform gives us the last one.)
+      level = tg.tone_incr[tgen] > 1 ? 32 - __builtin_clz(tg.tone_incr[tgen] - 1) - 23 : 0; // log2(step), rounded up
+      if (level < 0) level = 0;
+#endif
+      tg.waveform_array[tgen] = playtune_waveform(bank, instrument_index, level);
+      //start at random place in the wave cycle to minimize phase lock cancellations
+      tg.tone_phase[tgen] = random_byte() << 23;
+      percussion_tgens &= ~((uint32_t)1 << tgen);
+#if DBUG
+      Serial.print("tgen="); Serial.print(tgen);
+      Serial.print(" note="); Serial.print(note);
+      Serial.print(" vol="); Serial.print(vol);
+      Serial.print(" incr="); Serial.print(tg.tone_incr[tgen]);
+      Serial.print(" phase="); Serial.println(tg.tone_phase[tgen]);
+#endif
+    }
+    tune_startvoice(tgen, vol);
+  }
+}
+
+// Start a percussion note on a tone generator: play num_samples points of the waveform once,
+// stepping through them by tone_incr (2^17 per point). The waveform is num_samples int16_t
+// samples, or with COMPRESSED_PERCUSSION the ADPCM blocks of that many.
+
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::tune_playdrum (byte tgen, const void *waveform, uint32_t num_samples, uint32_t tone_incr, byte vol) {
+  if ((Features & PT_PERCUSSION) && tgen < NUM_CHANNELS && num_samples >= 2) {
+#if VOICE_POOL
+    tgen = tune_allocvoice(tgen);
+#endif
+    tune_startdrum(tgen, waveform, num_samples, tone_incr, vol);
+  }
+}
+
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::tune_startdrum (byte tgen, const void *waveform, uint32_t num_samples, uint32_t tone_incr, byte vol) {
+  if (num_samples >= 2) {
+#if DO_PERCUSSION && COMPRESSED_PERCUSSION
+    // start decoding the compressed waveform: we keep the two samples we interpolate between
+    tg.adpcm_waveform[tgen] = (const uint8_t *) waveform;
+    tg.adpcm_val1[tgen] = adpcm_next_sample(&tg.adpcm[tgen], tg.adpcm_waveform[tgen], 0);
+    tg.adpcm_val2[tgen] = adpcm_next_sample(&tg.adpcm[tgen], tg.adpcm_waveform[tgen], 1);
+    tg.adpcm_index[tgen] = 1;
+#else
+    tg.waveform_array[tgen] = (const int16_t *) waveform;
+#endif
+    tg.tone_incr[tgen] = tone_incr; // the increment to move from one sample point on the waveform to the next
+    tg.tone_phase[tgen] = 0; // start at the beginning
+    tg.drum_index[tgen] = 0;
+    // Figure out how many samples we will play: all those whose phase is before the last point
+    // of the waveform, so that there is a point after it to interpolate towards.
+    uint64_t end_phase = (uint64_t)(num_samples - 1) << 17;
+    tg.drum_samples_left[tgen] = (uint32_t)((end_phase + tone_incr - 1) / tone_incr);
+    percussion_tgens |= (uint32_t)1 << tgen;
+    // percussion notes generally seem undermodulated, so we might double the volume we get and clip
+    if (Features & PT_BOOST_PERCUSSION) vol = vol > 63 ? 127 : vol << 1;
+    if (Features & PT_ENVELOPE) {
+      tg.env_mult[tgen] = 0x10000;
+      tg.env_incr[tgen] = 0;
+    }
+#if DBUG
+    Serial.print("tgen="); Serial.print(tgen);
+    Serial.print(" samples="); Serial.print(num_samples);
+    Serial.print(" incr="); Serial.println(tg.tone_incr[tgen]);
+#endif
+    tune_startvoice(tgen, vol);
+  }
+}
+
+// Set the volume of a tone generator whose note has been set up, and start it playing
+
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::tune_startvoice (byte tgen, byte vol) {
+  tg.volume[tgen] = vol & 0x7f;
+  tg.gain_frac[tgen] = playtune_gain(playtune_volume_frac(tg.volume[tgen]), gain_amplitude_fraction);
+  //Serial.print("vol "); Serial.print(tg.volume[tgen]); Serial.print(" ampl frac "); Serial.println(amplitude_fraction);
+  tgens_playing |= (uint32_t)1 << tgen;  // go!
+}
+
+#if VOICE_POOL
+//------------------------------------------------------------------------------
+// Find a voice for a new note on a channel. The channel's last note is released to fade out
+// on its own voice, or left to finish if it's percussion. If every voice is busy, we take the
+// quietest one that is finishing that way, or if there are none, the one that started first.
+//------------------------------------------------------------------------------
+
+#define NO_VOICE 0xff
+
+template <int MaxVoices, unsigned Features>
+byte AudioSynthPlaytuneT<MaxVoices, Features>::tune_allocvoice (byte channel) {
+  byte voice = channel_voice[channel];
+  if (voice != NO_VOICE && voice_channel[voice] == channel) {
+    channel_voice[channel] = NO_VOICE;
+    if (!(percussion_tgens & ((uint32_t)1 << voice))) tune_releasevoice(voice);
+  }
+  uint32_t idle = ~tgens_playing & (0xffffffff >> (32 - NUM_VOICES));
+  if (idle) voice = __builtin_ctz(idle);
+  else {
+    int64_t quietest = INT64_MAX;
+    uint32_t oldest = 0;
+    byte oldest_voice = 0;
+    voice = NO_VOICE;
+    for (byte v = 0; v < NUM_VOICES; ++v) {
+      if (channel_voice[voice_channel[v]] != v) { // it's finishing
+        int64_t level = Features & PT_ENVELOPE ? (int64_t)tg.env_mult[v] * tg.gain_frac[v] : tg.gain_frac[v];
+        if (level < quietest) {
+          quietest = level;
+          voice = v;
+        }
+      }
+      else if (voice_clock - voice_started[v] >= oldest) {
+        oldest = voice_clock - voice_started[v];
+        oldest_voice = v;
+      }
+    }
+    if (voice == NO_VOICE) voice = oldest_voice;
+  }
+  tgens_playing &= ~((uint32_t)1 << voice); // (cut off whatever it was playing)
+  voice_channel[voice] = channel;
+  channel_voice[channel] = voice;
+  voice_started[voice] = ++voice_clock;
+  tg.instrument_index[voice] = channel_instrument[channel];
+  return voice;
+}
+#endif
+
+// The voices that are playing notes for some channels, or fading them out
+
+template <int MaxVoices, unsigned Features>
+uint32_t AudioSynthPlaytuneT<MaxVoices, Features>::tune_channel_voices (uint32_t channels) {
+#if VOICE_POOL
+  uint32_t voices = 0;
+  for (uint32_t tgens = tgens_playing; tgens; tgens &= tgens - 1) {
+    byte voice = __builtin_ctz(tgens);
+    if (channels & ((uint32_t)1 << voice_channel[voice])) voices |= (uint32_t)1 << voice;
+  }
+  return voices;
+#else
+  return channels;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Stop playing a note on a particular tone generator
+//------------------------------------------------------------------------------
+
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::tune_stopnote (byte tgen) {
+  if (tgen < NUM_CHANNELS) {
+#if VOICE_POOL
+    byte voice = channel_voice[tgen];
+    if (voice == NO_VOICE || voice_channel[voice] != tgen) return; // (its voice has been taken)
+    channel_voice[tgen] = NO_VOICE;
+    tgen = voice;
+#endif
+    tune_releasevoice(tgen);
+  }
+}
+
+// Start the release of a voice's note, or stop it now if it's percussion or has no envelope
+
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::tune_releasevoice (byte tgen) {
+  if (tgens_playing & ((uint32_t)1 << tgen)) {
+#if DBUG
+    Serial.print("  stop tgen "); Serial.println(tgen);
+#endif
+    if ((Features & PT_ENVELOPE) && !(percussion_tgens & ((uint32_t)1 << tgen))) {
+      const struct playtune_envelope_t *envelope = playtune_envelope(bank, tg.instrument_index[tgen]);
+      tg.env_state[tgen] = ENV_RELEASE; // start release phase of a normal instrument note
+      // ramp the amplitude from the sustain level down to 0
+      tg.env_count[tgen] = envelope->release;
+      tg.env_mult[tgen] = envelope->sustain_level;
+#if EXP_ENVELOPE // decay exponentially towards zero
+      tg.env_incr[tgen] = 0;
+      tg.env_target[tgen] = 0;
+      tg.env_dist[tgen] = (uint32_t)tg.env_mult[tgen] << 14;
+      tg.env_decay[tgen] = envelope->release_mult;
+#else
+      tg.env_incr[tgen] = envelope->release_incr; // ramp down to zero
+#endif
+      // when the count becomes zero, the sample update function will stop the generator
+    } else
+      tgens_playing &= ~((uint32_t)1 << tgen);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Stop playing a score
+//------------------------------------------------------------------------------
+
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::tune_stopscore(struct score_t *sc) {
+  if (sc == scores) { // the main score stops all its generators, as it always has
+    for (byte tgen = 0; tgen < NUM_CHANNELS; ++tgen)
+      if (!(layer_tgens & ((uint32_t)1 << tgen))) tune_stopnote(tgen);
+  }
+  else for (byte tgen = 0; tgen < sc->num_tgens; ++tgen)
+      tune_stopnote(sc->first_tgen + tgen);
+  sc->playing = false;
+  if (sc != scores) tune_reservelayers(); // (the main score can have its generators back)
+}
+
+//------------------------------------------------------------------------------
+//    Play a score
+//------------------------------------------------------------------------------
+
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::tune_playscore (struct score_t *sc, const byte * score) { // start up the score
+  if (sc->playing) tune_stopscore(sc);
+  sc->volume_present = Features & PT_ASSUME_VOLUME;
+  unsigned num_tgens = NUM_CHANNELS;
+  sc->score_start = playtune_score_header(score, &sc->volume_present, &num_tgens);
+  if (sc == scores) num_tgens_used = max(1, min((int)NUM_CHANNELS, (int)num_tgens)); // (a layer has its own)
+#if DBUG
+  Serial.print("volume_present="); Serial.print(sc->volume_present);
+  Serial.print(", #tonegens="); Serial.println(num_tgens_used);
+#endif
+  sc->score_cursor = sc->score_start;
+  sc->events_start = NULL;
+#if STREAM_BUFFER_BYTES
+  if (sc == scores) stream_reader = NULL;
+#endif
+  sc->score_time = 0;
+  tune_startscore(sc);
+}
+
+// Start playing a compiled score
+
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::play(const struct playtune_event_t *events, unsigned int num_tgens) {
+  struct score_t *sc = scores;
+  if (sc->playing) stop();
+  num_tgens_used = max(1, min((int)NUM_CHANNELS, (int)num_tgens));
+  sc->events_start = sc->event_cursor = events;
+#if STREAM_BUFFER_BYTES
+  stream_reader = NULL;
+#endif
+  sc->score_time = 0;
+  tune_startscore(sc);
+}
+
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::tune_startscore (struct score_t *sc) {
+  if (sc == scores) { // the main score can use any generator that a layer doesn't
+    sc->first_tgen = 0;
+    sc->num_tgens = NUM_CHANNELS;
+  }
+  for (byte tgen = 0; tgen < sc->num_tgens; ++tgen) // set default instrument
+    if (sc != scores || !(layer_tgens & ((uint32_t)1 << tgen)))
+      tune_setinstrument(sc->first_tgen + tgen, playtune_default_instrument);
+  // We will attentuate amplitudes prior to combining notes based on the
+  // worst-case number of notes that might be playing simultaneously.
+  amplitude_fraction = mixer_amplitude_fractions[__builtin_popcount(tune_mixed_tgens())]; // (the table has all 0..32)
+#if DBUG
+  Serial.print("amplitude fraction is "); Serial.println(amplitude_fraction);
+#endif
+  sc->scorewait_samples = 0;
+  sc->playing = true; // (before its first commands, which might stop it)
+  if (sc->events_start) tune_stepevents(sc);
+  else tune_stepscore(sc);  /* execute initial the commands and return */
+}
+
+// The tone generators we mix: the ones the main score uses, the ones the layers that are playing
+// use, and the ones of layers that have stopped until their last notes have faded out
+
+template <int MaxVoices, unsigned Features>
+uint32_t AudioSynthPlaytuneT<MaxVoices, Features>::tune_mixed_tgens (void) {
+  uint32_t tgens = num_tgens_used < 32 ? ((uint32_t)1 << num_tgens_used) - 1 : 0xffffffff;
+  uint32_t mask = 0xffffffff >> (32 - NUM_CHANNELS);
+#if !VOICE_POOL // (a pool's voices play until they have faded out anyway)
+  if (fading_tgens & ~tgens_playing) { // some have finished fading, so the mixer can attenuate less
+    fading_tgens &= tgens_playing;
+    amplitude_fraction = mixer_amplitude_fractions[__builtin_popcount((tgens | fading_tgens | layer_tgens) & mask)];
+  }
+  tgens |= fading_tgens;
+#endif
+  return (tgens | layer_tgens) & mask;
+}
+
+// Work out which generators the layers that are playing have reserved, after one starts or stops
+
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::tune_reservelayers (void) {
+  uint32_t tgens = 0;
+  for (struct score_t *sc = scores + 1; sc < scores + MAX_SCORES; ++sc)
+    if (sc->playing) tgens |= (0xffffffff >> (32 - sc->num_tgens)) << sc->first_tgen;
+  fading_tgens |= layer_tgens & ~tgens;
+  layer_tgens = tgens;
+  amplitude_fraction = mixer_amplitude_fractions[__builtin_popcount(tune_mixed_tgens())];
+}
+
+//------------------------------------------------------------------------------
+// Play a layer: another score at the same time as the main one, on other generators
+//------------------------------------------------------------------------------
+
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::playLayer(byte layer, const byte *score, byte first_tgen, byte num_tgens) {
+  if (layer == 0 || layer >= MAX_SCORES || first_tgen >= NUM_CHANNELS || num_tgens == 0) return;
+  struct score_t *sc = &scores[layer];
+  if (sc->playing) tune_stopscore(sc);
+  sc->first_tgen = first_tgen;
+  sc->num_tgens = min(num_tgens, NUM_CHANNELS - first_tgen);
+  layer_tgens |= (0xffffffff >> (32 - sc->num_tgens)) << first_tgen; // (reserved until it stops)
+  tune_playscore(sc, score);
+}
+template <int MaxVoices, unsigned Features>
+bool AudioSynthPlaytuneT<MaxVoices, Features>::layerPlaying(byte layer) {
+  return layer < MAX_SCORES && scores[layer].playing;
+}
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::stopLayer(byte layer) {
+  if (layer < MAX_SCORES) tune_stopscore(&scores[layer]);
+}
+
+// Jump to msec from the start of the bytestream score that's playing, using its index.
+// The notes that would be playing there start again; percussion notes that started before then don't.
+// Past the end, a score that restarts goes around again, and one that stops stops.
+
+template <int MaxVoices, unsigned Features>
+bool AudioSynthPlaytuneT<MaxVoices, Features>::seek(unsigned long msec, const struct playtune_checkpoint_t *checkpoints, uint32_t num_checkpoints) {
+  struct score_t *sc = scores;
+  if (!sc->playing || sc->events_start || num_checkpoints == 0) return false;
+#if STREAM_BUFFER_BYTES
+  if (stream_reader) return false;
+#endif
+  uint32_t target = (uint64_t)msec * (uint32_t)(AUDIO_SAMPLE_RATE + .5) / 1000;
+  struct playtune_checkpoint_t state;
+  const byte *cursor;
+  while (1) { // once for each time around a score that restarts
+    uint32_t checkpoint = min(target / CHECKPOINT_SAMPLES, num_checkpoints - 1);
+    while (checkpoint > 0 && checkpoints[checkpoint].time > target) --checkpoint;
+    state = checkpoints[checkpoint];
+    cursor = sc->score_start + state.offset;
+    bool restart = false;
+    while (state.time < target && !restart) { // follow the commands before target
+      struct playtune_event_t event;
+      cursor = playtune_decode_command(cursor, sc->volume_present, &event);
+      if ((event.cmd & 0xf0) == CMD_STOP) {
+        stop();
+        return true;
+      }
+      if ((event.cmd & 0xf0) == CMD_RESTART) restart = true;
+      else if (event.cmd == CMD_WAIT) state.time += event.time;
+      else playtune_checkpoint_command(&state, &event);
+    }
+    if (!restart) break;
+    if (state.time == 0) return false; // (a score with no waits at all)
+    target %= state.time; // go around again
+  }
+  AudioNoInterrupts(); // (update() might be in the middle of the score)
+  tgens_playing &= tune_channel_voices(layer_tgens); // stop even the notes that are still fading out, but not the layers'
+  for (byte tgen = 0; tgen < NUM_CHANNELS; ++tgen) {
+    if (layer_tgens & ((uint32_t)1 << tgen)) continue;
+    tune_setinstrument(tgen, state.program[tgen] == NO_NOTE ? playtune_default_instrument : playtune_instrument_patch(bank, state.program[tgen]));
+    if (state.note[tgen] < 128) tune_playnote(tgen, state.note[tgen], state.vol[tgen]);
+  }
+  sc->score_cursor = cursor;
+  sc->score_time = state.time;
+  sc->scorewait_samples = state.time - target;
+  if (!sc->scorewait_samples) tune_stepscore(sc); // do the commands right at target for real, percussion and all
+  AudioInterrupts();
+  return true;
+}
+
+// How far into the score we are, in msec, which seek() can come back to
+
+template <int MaxVoices, unsigned Features>
+unsigned long AudioSynthPlaytuneT<MaxVoices, Features>::position(void) {
+  if (!scores[0].playing) return 0;
+  AudioNoInterrupts();
+  uint32_t samples = scores[0].score_time - scores[0].scorewait_samples;
+  AudioInterrupts();
+  return (uint64_t)samples * 1000 / (uint32_t)(AUDIO_SAMPLE_RATE + .5);
+}
+
+// Do a score command, other than a wait. Return false if it stopped the score.
+
+template <int MaxVoices, unsigned Features>
+bool AudioSynthPlaytuneT<MaxVoices, Features>::tune_docommand (struct score_t *sc, const struct playtune_event_t *event) {
+  byte tgen = sc->first_tgen + (event->cmd & 0x0f);
+  if ((event->cmd & 0x0f) >= sc->num_tgens || (sc == scores && (layer_tgens & ((uint32_t)1 << tgen))))
+    tgen = NUM_CHANNELS; // (not one of ours, so the note commands ignore it)
+  switch (event->cmd & 0xf0) {
+    case CMD_STOPNOTE: /* stop note */
+      tune_stopnote (tgen);
+      break;
+    case CMD_PLAYNOTE: /* play note */
+      tune_playnote (tgen, event->arg, event->vol);
+      break;
+    case CMD_INSTRUMENT: /* change a tone generator's instrument */
+      if (tgen < NUM_CHANNELS) tune_setinstrument(tgen, playtune_instrument_patch(bank, event->arg));
+      break;
+    case CMD_STOP: /* stop playing the score */
+      tune_stopscore(sc);
+      return false;
+  }
+  return true;
+}
+
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::tune_stepscore (struct score_t *sc) { //*********   continue in the score
+  /* Do score commands until a "wait" is found, or the score is stopped.
+    This is called initially from tune_playscore, but then is called
+    from the slow interrupt routine when waits expire.
+  */
+  while (1) {
+    struct playtune_event_t event;
+#if STREAM_BUFFER_BYTES
+    if (sc == scores && stream_reader) {
+      if (!tune_streamcommand(sc, &event)) {
+        if (stream_ended) { // the file ended without a stop command
+          stop();
+          break;
+        }
+        ++stream_underruns; // refill() isn't keeping up, so let the score fall behind a block
+        sc->scorewait_samples = AUDIO_BLOCK_SAMPLES;
+        sc->score_time += AUDIO_BLOCK_SAMPLES;
+        break;
+      }
+      if ((event.cmd & 0xf0) == CMD_RESTART) { // (we can't go back in a stream)
+        stop();
+        break;
+      }
+    }
+    else
+#endif
+      sc->score_cursor = playtune_decode_command(sc->score_cursor, sc->volume_present, &event);
+    if (event.cmd == CMD_WAIT) {
+      sc->scorewait_samples = event.time;
+      sc->score_time += event.time; // (when the wait will end)
+#if DBUG
+      Serial.print("wait samples = "); Serial.println(sc->scorewait_samples);
+#endif
+      if (sc->scorewait_samples) break; // (a zero wait just goes on to the next command)
+    }
+    else if ((event.cmd & 0xf0) == CMD_RESTART) { /* restart the score */
+      sc->score_cursor = sc->score_start;
+      sc->score_time = 0;
+    }
+    else if (!tune_docommand(sc, &event)) break;
+  }
+}
+
+#if STREAM_BUFFER_BYTES
+//------------------------------------------------------------------------------
+// Streaming a score from a file, so that it can be any length. update() takes
+// the commands from a ring buffer that refill() keeps full from the reader.
+//------------------------------------------------------------------------------
+
+#define STREAM_MASK (STREAM_BUFFER_BYTES - 1)
+#if STREAM_BUFFER_BYTES & STREAM_MASK
+#error STREAM_BUFFER_BYTES must be a power of 2
+#endif
+
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::play(playtune_read_t reader, void *context) {
+  struct score_t *sc = scores;
+  if (sc->playing) stop();
+  stream_reader = NULL; // (so that update() doesn't look at the buffer while we fill it)
+  stream_head = stream_tail = 0;
+  stream_ended = false;
+  stream_underruns = 0;
+  stream_context = context;
+  stream_reader = reader;
+  // Skip the header, if there is one. A reader can return fewer bytes than we ask for, like one
+  // reading from a serial port, so keep refilling until we have all of it or the stream ends.
+  while (stream_head < sizeof(struct file_hdr_t) && !stream_ended) refill();
+  struct file_hdr_t file_header;
+  memset(&file_header, 0, sizeof(file_header));
+  memcpy(&file_header, stream_buffer, min(stream_head, sizeof(file_header)));
+  sc->volume_present = Features & PT_ASSUME_VOLUME;
+  unsigned num_tgens = NUM_CHANNELS;
+  uint32_t header_bytes = playtune_score_header((const byte *)&file_header, &sc->volume_present, &num_tgens) - (const byte *)&file_header;
+  if (header_bytes > STREAM_BUFFER_BYTES) { // (we would never have room for it all)
+    stream_reader = NULL;
+    return;
+  }
+  while (stream_head < header_bytes && !stream_ended) refill();
+  if (stream_head < header_bytes) { // the stream ended in the middle of the header
+    stream_reader = NULL;
+    return;
+  }
+  stream_tail = header_bytes;
+  refill(); // (and as much of the score as there is room for)
+  num_tgens_used = max(1, min((int)NUM_CHANNELS, (int)num_tgens));
+  sc->events_start = NULL;
+  sc->score_time = 0;
+  tune_startscore(sc);
+}
+
+// Fill the ring buffer from the reader as far as we can. Call this often from loop():
+// the buffer has to hold enough of the score to last until the next time.
+
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::refill(void) {
+  while (stream_reader && !stream_ended) {
+    uint32_t head = stream_head, room = STREAM_BUFFER_BYTES - (head - stream_tail);
+    if (room == 0) break;
+    uint32_t bytes = min(room, STREAM_BUFFER_BYTES - (head & STREAM_MASK)); // (up to the wraparound)
+    int got = stream_reader(stream_context, stream_buffer + (head & STREAM_MASK), bytes);
+    if (got <= 0) stream_ended = true;
+    else {
+      __sync_synchronize(); // (the bytes have to be there before update() sees the new head)
+      stream_head = head + got;
+      if ((uint32_t)got < bytes) break; // nothing more for now
+    }
+  }
+}
+
+// Take the next command out of the ring buffer, or return false if all of it hasn't come yet
+
+template <int MaxVoices, unsigned Features>
+bool AudioSynthPlaytuneT<MaxVoices, Features>::tune_streamcommand(struct score_t *sc, struct playtune_event_t *event) {
+  uint32_t tail = stream_tail, waiting = stream_head - tail;
+  __sync_synchronize();
+  byte command[3]; // (the longest there is)
+  for (uint32_t i = 0; i < sizeof(command); ++i)
+    command[i] = i < waiting ? stream_buffer[(tail + i) & STREAM_MASK] : 0;
+  uint32_t bytes = playtune_decode_command(command, sc->volume_present, event) - command;
+  if (waiting < bytes) return false;
+  __sync_synchronize(); // (we're done with the bytes before refill() can reuse them)
+  stream_tail = tail + bytes;
+  return true;
+}
+#endif
+
+// The same for a compiled score: do the events whose time has come, and then wait for the next one.
+// All we do to get to the next event is to move a pointer.
+
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::tune_stepevents (struct score_t *sc) {
+  while (1) {
+    const struct playtune_event_t *event = sc->event_cursor;
+    if (event->time != sc->score_time) { // it's later
+      sc->scorewait_samples = event->time - sc->score_time;
+      sc->score_time = event->time;
+      break;
+    }
+    ++sc->event_cursor;
+    if ((event->cmd & 0xf0) == CMD_RESTART) { /* restart the score */
+      sc->event_cursor = sc->events_start;
+      sc->score_time = 0;
+    }
+    else if (!tune_docommand(sc, event)) break;
+  }
+}
+
+/*************************************************************************************************
+    Public interface functions
+*************************************************************************************************/
+
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::tune_init(void) {
+  memset(scores, 0, sizeof(scores)); // nothing is playing
+#if VOICE_POOL
+  memset(channel_voice, NO_VOICE, sizeof(channel_voice));
+  memset(channel_instrument, playtune_default_instrument, sizeof(channel_instrument));
+  memset(voice_channel, 0, sizeof(voice_channel));
+#endif
+}
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::play(const byte *score) {
+  play(score, NUM_CHANNELS);
+}
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::play(const byte *score, unsigned int num_tgens) {
+  num_tgens_used = num_tgens;
+  tune_playscore(scores, score);
+}
+template <int MaxVoices, unsigned Features>
+bool AudioSynthPlaytuneT<MaxVoices, Features>::isPlaying(void) {
+#if COMMAND_QUEUE_SIZE
+  for (uint32_t command = queue_tail; command != queue_head; ++command)
+    if (queue[command % COMMAND_QUEUE_SIZE].cmd == Q_PLAY && queue[command % COMMAND_QUEUE_SIZE].tgen == 0)
+      return true; // (it will be soon)
+#endif
+  return scores[0].playing;
+}
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::stop(void) {
+  tune_stopscore(scores);
+}
+
+#if COMMAND_QUEUE_SIZE
+//------------------------------------------------------------------------------
+// The command queue, for control code to play things without racing update().
+// The queue...() functions only change queue_head, and update() only changes
+// queue_tail, so nobody has to turn off interrupts.
+//------------------------------------------------------------------------------
+
+#if COMMAND_QUEUE_SIZE & (COMMAND_QUEUE_SIZE - 1)
+#error COMMAND_QUEUE_SIZE must be a power of 2
+#endif
+
+template <int MaxVoices, unsigned Features>
+bool AudioSynthPlaytuneT<MaxVoices, Features>::tune_queue (struct playtune_queued_t *command) {
+  uint32_t head = queue_head;
+  if (head - queue_tail >= COMMAND_QUEUE_SIZE) return false; // it's full
+  if (command->offset >= AUDIO_BLOCK_SAMPLES) command->offset = AUDIO_BLOCK_SAMPLES - 1;
+  queue[head % COMMAND_QUEUE_SIZE] = *command;
+  __sync_synchronize(); // (the command has to be there before update() sees the new head)
+  queue_head = head + 1;
+  return true;
+}
+
+template <int MaxVoices, unsigned Features>
+bool AudioSynthPlaytuneT<MaxVoices, Features>::queuePlay(const byte *score, byte offset) {
+  struct playtune_queued_t command = {Q_PLAY, offset, 0, 0, 0, score, 0};
+  return tune_queue(&command);
+}
+template <int MaxVoices, unsigned Features>
+bool AudioSynthPlaytuneT<MaxVoices, Features>::queueStop(byte offset) {
+  struct playtune_queued_t command = {Q_STOP, offset, 0, 0, 0, NULL, 0};
+  return tune_queue(&command);
+}
+template <int MaxVoices, unsigned Features>
+bool AudioSynthPlaytuneT<MaxVoices, Features>::queuePlayLayer(byte layer, const byte *score, byte first_tgen, byte num_tgens, byte offset) {
+  struct playtune_queued_t command = {Q_PLAY, offset, layer, first_tgen, num_tgens, score, 0};
+  return layer != 0 && tune_queue(&command);
+}
+template <int MaxVoices, unsigned Features>
+bool AudioSynthPlaytuneT<MaxVoices, Features>::queueStopLayer(byte layer, byte offset) {
+  struct playtune_queued_t command = {Q_STOP, offset, layer, 0, 0, NULL, 0};
+  return tune_queue(&command);
+}
+template <int MaxVoices, unsigned Features>
+bool AudioSynthPlaytuneT<MaxVoices, Features>::queueNoteOn(byte tgen, byte note, byte vol, byte offset) {
+  struct playtune_queued_t command = {Q_NOTE_ON, offset, tgen, note, vol, NULL, 0};
+  return tune_queue(&command);
+}
+template <int MaxVoices, unsigned Features>
+bool AudioSynthPlaytuneT<MaxVoices, Features>::queueNoteOff(byte tgen, byte offset) {
+  struct playtune_queued_t command = {Q_NOTE_OFF, offset, tgen, 0, 0, NULL, 0};
+  return tune_queue(&command);
+}
+template <int MaxVoices, unsigned Features>
+bool AudioSynthPlaytuneT<MaxVoices, Features>::queueInstrument(byte tgen, byte instrument_index, byte offset) {
+  struct playtune_queued_t command = {Q_INSTRUMENT, offset, tgen, instrument_index, 0, NULL, 0};
+  return tune_queue(&command);
+}
+template <int MaxVoices, unsigned Features>
+bool AudioSynthPlaytuneT<MaxVoices, Features>::queueGain(int32_t amplitude_fraction, byte offset) {
+  struct playtune_queued_t command = {Q_GAIN, offset, 0, 0, 0, NULL, amplitude_fraction};
+  return tune_queue(&command);
+}
+
+// Do a queued command, in update()
+
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::tune_runqueued (const struct playtune_queued_t *command) {
+  switch (command->cmd) {
+    case Q_PLAY:
+      if (command->tgen) playLayer(command->tgen, command->score, command->arg, command->vol);
+      else tune_playscore(scores, command->score);
+      break;
+    case Q_STOP:
+      stopLayer(command->tgen);
+      break;
+    case Q_NOTE_ON:
+      tune_playnote(command->tgen, command->arg, command->vol);
+      break;
+    case Q_NOTE_OFF:
+      tune_stopnote(command->tgen);
+      break;
+    case Q_INSTRUMENT:
+      if (command->tgen < NUM_CHANNELS) tune_setinstrument(command->tgen, command->arg);
+      break;
+    case Q_GAIN:
+      amplitude_fraction = command->gain;
+      break;
+  }
+}
+#endif
+
+//------------------------------------------------------------------------------
+// Change to the sounds in a sample bank, or back to the built-in ones if data is NULL.
+// This stops everything that's playing. We don't copy the bank, so it has to stay
+// where it is until we change to another one.
+//------------------------------------------------------------------------------
+
+template <int MaxVoices, unsigned Features>
+bool AudioSynthPlaytuneT<MaxVoices, Features>::useBank(const void *data, uint32_t size) {
+  const struct playtune_bank_t *new_bank = NULL;
+  if (data && !(new_bank = playtune_check_bank(data, size))) return false;
+  stop();
+  AudioNoInterrupts(); // (update() might be looking at the old sounds)
+  tgens_playing = 0; // stop even the notes that are still fading out
+  bank = new_bank;
+  AudioInterrupts();
+  return true;
+}
+
+// for testing...
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::tune_setinstrument(byte tgen, byte instrument_index) {
+#if VOICE_POOL
+  channel_instrument[tgen] = instrument_index; // (for the next note that starts)
+#else
+  tg.instrument_index[tgen] = instrument_index;
+#endif
+}
+
+/*************************************************************************************************
+   Our interrupt-time "update" function, where all the dirty work gets done.
+   We are called every 2.9 msec, and must generate a block of 128 2-byte samples
+   as quickly as we can.
+
+   The block is divided into runs of samples that end exactly where the next score event happens.
+   Each playing tone generator renders a whole run at once into a 32-bit mix buffer, so that
+   its phase, increment, waveform pointer and envelope stay in registers for the whole run
+   instead of being reloaded and retested for every sample. A generator's run is further split
+   where its envelope changes state or its percussion sample ends, so the loop that renders
+   the samples in between has no tests at all.
+*************************************************************************************************/
+
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::update(void) {
+  audio_block_t *block = allocate();
+  if (block) {
+    int32_t mix[AUDIO_BLOCK_SAMPLES];
+    memset(mix, 0, sizeof(mix));
+    int sample = 0;
+#if COMMAND_QUEUE_SIZE
+    uint32_t queue_end = queue_head; // (commands queued after this wait for the next block)
+    __sync_synchronize();
+#endif
+    while (sample < AUDIO_BLOCK_SAMPLES) {
+      int count = AUDIO_BLOCK_SAMPLES - sample;
+#if COMMAND_QUEUE_SIZE
+      while (queue_tail != queue_end) { // do the queued commands whose time has come
+        const struct playtune_queued_t *command = &queue[queue_tail % COMMAND_QUEUE_SIZE];
+        if (command->offset > sample) {
+          count = min(count, command->offset - sample); // render up to the next one
+          break;
+        }
+        tune_runqueued(command);
+        __sync_synchronize(); // (we're done with it before the queue...() functions can reuse it)
+        queue_tail = queue_tail + 1;
+      }
+#endif
+      uint32_t waiting = 0; // the scores that have events pending (no wait means none are)
+      for (int score = 0; score < MAX_SCORES; ++score) {
+        struct score_t *sc = &scores[score];
+        if (sc->playing && sc->scorewait_samples) {
+          waiting |= 1 << score;
+          if (sc->scorewait_samples < (unsigned)count)
+            count = sc->scorewait_samples; // render up to the next score event
+        }
+      }
+      tune_render_voices(mix + sample, count); // (all the scores' generators together)
+      sample += count;
+      for (int score = 0; waiting; ++score, waiting >>= 1) {
+        struct score_t *sc = &scores[score];
+        if ((waiting & 1) && (sc->scorewait_samples -= count) == 0) // end of a score wait, so execute more score commands
+          sc->events_start ? tune_stepevents(sc) : tune_stepscore(sc);
+      }
+    }
+    for (int sample = 0; sample < AUDIO_BLOCK_SAMPLES; ++sample)
+      block->data[sample] = mix[sample]; // clips at -32768..+32767
+    transmit(block);
+    release(block);
+  }
+}
+
+// Mix a run of samples from all the tone generators that are playing.
+// We only visit the generators whose bits are set in tgens_playing, so idle ones cost nothing.
+
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::tune_render_voices (int32_t *mix, int count) {
+  uint32_t tgens = tgens_playing;
+#if !VOICE_POOL // (a pool's voices only play for the channels in use)
+  tgens &= tune_mixed_tgens(); // only mix the ones in use
+#endif
+  if (Features & PT_DYNAMIC_VOLUME) { // adjust the mixer input attentuation based on how many generators were last active
+    amplitude_fraction = mixer_amplitude_fractions[num_tgens_playing_last];
+    num_tgens_playing_last = __builtin_popcount(tgens); // for the next run, remember how many are playing now
+  }
+  if (amplitude_fraction != gain_amplitude_fraction)
+    tune_update_gains(); // the number of generators changed, or someone set amplitude_fraction
+  while (tgens) { // look at each tone generator that is playing
+    byte tgen = __builtin_ctz(tgens);
+    tgens &= tgens - 1;
+    bool still_playing = (Features & PT_PERCUSSION) && (percussion_tgens & ((uint32_t)1 << tgen)) ? tune_render_percussion(tgen, mix, count) : tune_render_instrument(tgen, mix, count);
+    if (!still_playing) tgens_playing &= ~((uint32_t)1 << tgen);
+  }
+}
+
+// Recompute the playing tone generators' gains for a new amplitude_fraction.
+// (The others get theirs when they start their next note.)
+
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::tune_update_gains (void) {
+  gain_amplitude_fraction = amplitude_fraction;
+  for (uint32_t tgens = tgens_playing; tgens; tgens &= tgens - 1) {
+    byte tgen = __builtin_ctz(tgens);
+    tg.gain_frac[tgen] = playtune_gain(playtune_volume_frac(tg.volume[tgen]), gain_amplitude_fraction);
+  }
+}
+
+// Render a run of a regular instrument, which repeats its waveform indefinitely.
+// Return false if the note has ended.
+//
+// The envelope is handled a segment at a time, not a sample at a time: we work out how many
+// of the samples stay in the current DAHDSR state, render them with the envelope as a linear
+// ramp from where it is now, and then advance the envelope past all of them at once.
+// A segment that is silent, like the delay, just moves the waveform phase along.
+// An exponential segment can't be advanced all at once, so it is rendered by a loop that
+// carries its distance from the target from one sample to the next.
+
+template <int MaxVoices, unsigned Features>
+bool AudioSynthPlaytuneT<MaxVoices, Features>::tune_render_instrument (byte tgen, int32_t *mix, int count) {
+  if (!(Features & PT_ENVELOPE)) {
+    tune_render_waveform(tgen, mix, count);
+    return true;
+  }
+  while (count > 0) {
+    if (tg.env_count[tgen] == 0) { // change to a state with a non-zero count
+      tune_envelope_next(tgen);
+      if (tg.env_state[tgen] == ENV_IDLE) { // end of release: play one last sample, then stop
+        tune_render_waveform(tgen, mix, 1);
+        return false;
+      }
+    }
+    int run = tg.env_count[tgen] < count ? tg.env_count[tgen] : count; // render up to the next envelope state change
+    if (tg.env_mult[tgen] == 0 && tg.env_incr[tgen] == 0) // silent
+      tg.tone_phase[tgen] = ((uint32_t)tg.tone_phase[tgen] + (uint32_t)run * tg.tone_incr[tgen]) & 0x7fffffff;
+#if EXP_ENVELOPE
+    else if (tg.env_decay[tgen]) tune_render_waveform_exp(tgen, mix, run); // (which also advances env_mult)
+#endif
+    else tune_render_waveform(tgen, mix, run);
+    tg.env_mult[tgen] += run * tg.env_incr[tgen]; // advance the envelope to the end of the run
+    tg.env_count[tgen] -= run; // count towards the next envelope state
+    mix += run;
+    count -= run;
+  }
+  return true;
+}
+
+// Render a run of a percussion instrument, which plays its waveform once.
+// Return false if the waveform has ended.
+
+template <int MaxVoices, unsigned Features>
+bool AudioSynthPlaytuneT<MaxVoices, Features>::tune_render_percussion (byte tgen, int32_t *mix, int count) {
+  if ((uint32_t)count > tg.drum_samples_left[tgen])
+    count = tg.drum_samples_left[tgen]; // end of percussion waveform; stop after this run
+  tg.drum_samples_left[tgen] -= count;
+  // tone_phase holds only the fraction and the low bits of the index of where we are in the waveform,
+  // which is relative to drum_index, so the waveform can be any length. We move the whole points into
+  // drum_index at the start of each run, and a run is too short to overflow tone_phase again
+  // (for any drum sampled at less than 128 times the output rate).
+  tg.drum_index[tgen] += (uint32_t)tg.tone_phase[tgen] >> 17;
+  tg.tone_phase[tgen] &= 0x1ffff;
+#if DO_PERCUSSION && COMPRESSED_PERCUSSION
+  // Decode the waveform as the phase advances, which only ever goes forward, a sample at a time.
+  // We keep the decoded samples on either side of the phase to interpolate between.
+  const uint8_t *waveform = tg.adpcm_waveform[tgen];
+  struct adpcm_state_t adpcm = tg.adpcm[tgen];
+  uint32_t adpcm_index = tg.adpcm_index[tgen], drum_index = tg.drum_index[tgen];
+  int16_t val1 = tg.adpcm_val1[tgen], val2 = tg.adpcm_val2[tgen];
+  uint32_t tone_phase = tg.tone_phase[tgen], tone_incr = tg.tone_incr[tgen];
+  int32_t gain_frac = tg.gain_frac[tgen];
+  for (int sample = 0; sample < count; ++sample) {
+    uint32_t index1 = drum_index + (tone_phase >> 17); // (see below)
+    while (adpcm_index <= index1) { // catch up, decoding any samples we skip over
+      val1 = val2;
+      val2 = adpcm_next_sample(&adpcm, waveform, ++adpcm_index);
+    }
+    uint32_t scale = (tone_phase >> 1 ) & 0xFFFF;
+    int32_t interpolated = playtune_interpolate(val1, val2, scale);
+    tone_phase = (tone_phase + tone_incr) & 0x7fffffff;
+    mix[sample] = playtune_mix(mix[sample], interpolated, gain_frac);
+  }
+  tg.tone_phase[tgen] = tone_phase;
+  tg.adpcm[tgen] = adpcm;
+  tg.adpcm_index[tgen] = adpcm_index;
+  tg.adpcm_val1[tgen] = val1;
+  tg.adpcm_val2[tgen] = val2;
+#elif defined(PLAYTUNE_HOST_SIMD)
+  struct playtune_run_t run = {
+    tg.waveform_array[tgen] + tg.drum_index[tgen], (uint32_t)tg.tone_phase[tgen], (uint32_t)tg.tone_incr[tgen], 17, 0xffffffff,
+    0x10000, 0, tg.gain_frac[tgen]
+  };
+  playtune_render_kernel(&run, mix, count);
+  tg.tone_phase[tgen] = run.tone_phase;
+#else
+  const int16_t *waveform = tg.waveform_array[tgen] + tg.drum_index[tgen];
+  uint32_t tone_phase = tg.tone_phase[tgen], tone_incr = tg.tone_incr[tgen];
+  int32_t gain_frac = tg.gain_frac[tgen];
+  // (The envelope multiplier is always 1.0 for percussion, so we don't bother with it.)
+  for (int sample = 0; sample < count; ++sample) {
+    // tone_phase = +iiiiiiiiiiiiiiffffffffffffffffx, i=index into waveform array, f=fraction
+    uint32_t index1 = tone_phase >> 17; // index from drum_index
+    uint32_t index2 = index1 + 1;
+    uint32_t scale = (tone_phase >> 1 ) & 0xFFFF; // 16 bits of fractional distance between samples
+    int32_t interpolated = playtune_interpolate((int16_t)pgm_read_word(waveform + index1),
+                           (int16_t)pgm_read_word(waveform + index2), scale);
+    tone_phase = (tone_phase + tone_incr) & 0x7fffffff; // advance to the next waveform point
+    mix[sample] = playtune_mix(mix[sample], interpolated, gain_frac);
+  }
+  tg.tone_phase[tgen] = tone_phase;
+#endif
+  return tg.drum_samples_left[tgen] != 0;
+}
+
+// Interpolate an instrument's repeating waveform at a phase
+
+static inline int32_t instrument_interpolate(const int16_t *waveform, uint32_t tone_phase) {
+  // tone_phase = +iiiiiiiiffffffffffffffffxxxxxxx, i=index into waveform array, f=fraction
+  uint32_t index1 = tone_phase >> 23; // 8 bits of index, 0..255 samples
+  uint32_t index2 = (index1 + 1) & 0xff;  // wrap around at the end
+  uint32_t scale = (tone_phase >> 7) & 0xFFFF;  // 16 bits of fractional distance between samples
+  // do a linear interpolation between the samples that bracket the waveform point
+  return playtune_interpolate((int16_t)pgm_read_word(waveform + index1),
+                              (int16_t)pgm_read_word(waveform + index2), scale);
+}
+
+// Render a run of an instrument's repeating waveform, during which nothing changes but the phase and
+// the envelope multiplier. The envelope is a linear ramp, env_mult + sample * env_incr, which the
+// caller advances past the run afterwards.
+
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::tune_render_waveform (byte tgen, int32_t *mix, int count) {
+#ifdef PLAYTUNE_HOST_SIMD
+  struct playtune_run_t run = {
+    tg.waveform_array[tgen], (uint32_t)tg.tone_phase[tgen], (uint32_t)tg.tone_incr[tgen], 23, 0xff,
+    Features & PT_ENVELOPE ? tg.env_mult[tgen] : 0x10000, // (no envelope is the same as a constant 1.0)
+    Features & PT_ENVELOPE ? tg.env_incr[tgen] : 0,
+    tg.gain_frac[tgen]
+  };
+  playtune_render_kernel(&run, mix, count);
+  tg.tone_phase[tgen] = run.tone_phase;
+#else
+  const int16_t *waveform = tg.waveform_array[tgen];
+  uint32_t tone_phase = tg.tone_phase[tgen], tone_incr = tg.tone_incr[tgen];
+  int32_t gain_frac = tg.gain_frac[tgen];
+  int32_t env_mult = 0, env_incr = 0; // (not used without the envelope)
+  if (Features & PT_ENVELOPE) {
+    env_mult = tg.env_mult[tgen];
+    env_incr = tg.env_incr[tgen];
+  }
+  for (int sample = 0; sample < count; ++sample) {
+    int32_t interpolated = instrument_interpolate(waveform, tone_phase);
+    tone_phase = (tone_phase + tone_incr) & 0x7fffffff; // advance to the next waveform point
+    // Mix all the tone generators together, scaling our current waveform amplitude by the envelope and
+    // the volume of this note, attenuated by the number of tone generators that might be (or really are?) playing.
+    if (Features & PT_ENVELOPE)
+      mix[sample] = playtune_mix_enveloped(mix[sample], interpolated, env_mult + sample * env_incr, gain_frac);
+    else mix[sample] = playtune_mix(mix[sample], interpolated, gain_frac);
+  }
+  tg.tone_phase[tgen] = tone_phase;
+#endif // PLAYTUNE_HOST_SIMD
+}
+
+#if EXP_ENVELOPE
+// Render a run of an instrument's repeating waveform during an exponential decay or release,
+// where env_mult = env_target + env_dist, and env_dist shrinks by the factor env_decay every sample.
+// (This is as cheap per sample as the linear ramp on the Cortex-M4: one UMULL instead of one MLA.)
+
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::tune_render_waveform_exp (byte tgen, int32_t *mix, int count) {
+  const int16_t *waveform = tg.waveform_array[tgen];
+  uint32_t tone_phase = tg.tone_phase[tgen], tone_incr = tg.tone_incr[tgen];
+  int32_t gain_frac = tg.gain_frac[tgen], env_target = tg.env_target[tgen];
+  uint32_t env_dist = tg.env_dist[tgen], env_decay = tg.env_decay[tgen];
+  for (int sample = 0; sample < count; ++sample) {
+    int32_t interpolated = instrument_interpolate(waveform, tone_phase);
+    tone_phase = (tone_phase + tone_incr) & 0x7fffffff; // advance to the next waveform point
+    mix[sample] = playtune_mix_enveloped(mix[sample], interpolated, env_target + (int32_t)(env_dist >> 14), gain_frac);
+    env_dist = playtune_decay(env_dist, env_decay);
+  }
+  tg.tone_phase[tgen] = tone_phase;
+  tg.env_dist[tgen] = env_dist;
+  tg.env_mult[tgen] = env_target + (int32_t)(env_dist >> 14);
+}
+#endif
+
+// Move a tone generator's DAHDSR envelope to the next state that has a non-zero duration
+
+template <int MaxVoices, unsigned Features>
+void AudioSynthPlaytuneT<MaxVoices, Features>::tune_envelope_next (byte tgen) {
+  const struct playtune_envelope_t *envelope = playtune_envelope(bank, tg.instrument_index[tgen]);
+  while (tg.env_count[tgen] == 0) { // change to a state with a non-zero count
+    switch (tg.env_state[tgen]) {
+      case ENV_IDLE:
+        tg.env_count[tgen] = INT_MAX;
+        break;
+      case ENV_DELAY:
+        tg.env_state[tgen] = ENV_ATTACK;
+        tg.env_count[tgen] = envelope->attack;
+        tg.env_incr[tgen] = envelope->attack_incr; // ratchet up to maximum volume
+        break;
+      case ENV_ATTACK:
+        tg.env_state[tgen] = ENV_HOLD;
+        tg.env_count[tgen] = envelope->hold;
+        tg.env_mult[tgen] = 0x10000; // hold this volume
+        tg.env_incr[tgen] = 0;
+        break;
+      case ENV_HOLD:
+        tg.env_state[tgen] = ENV_DECAY;
+        tg.env_count[tgen] = envelope->decay;
+        tg.env_mult[tgen] = 0x10000; // start with max volume
+#if EXP_ENVELOPE // decay exponentially towards the sustain volume level
+        tg.env_incr[tgen] = 0;
+        tg.env_target[tgen] = envelope->sustain_level;
+        tg.env_dist[tgen] = (uint32_t)(0x10000 - tg.env_target[tgen]) << 14;
+        tg.env_decay[tgen] = envelope->decay_mult;
+#else
+        // count down to the sustain volume level
+        tg.env_incr[tgen] = envelope->decay_incr;
+#endif
+        break;
+      case ENV_DECAY:
+        tg.env_state[tgen] = ENV_SUSTAIN;
+        tg.env_count[tgen] = INT_MAX;
+        tg.env_mult[tgen] = envelope->sustain_level;
+        tg.env_incr[tgen] = 0; // maintain the sustain volume level
+#if EXP_ENVELOPE
+        tg.env_decay[tgen] = 0;
+#endif
+        break;
+      case ENV_SUSTAIN:
+        tg.env_count[tgen] = INT_MAX; // (shouldn't happen; just keep on keeping on)
+        break;
+      case ENV_RELEASE:
+        tg.env_state[tgen] = ENV_IDLE; // end of release: the caller will stop playing the note
+        break;
+    }
+  } // while state count is zero
+}
+
+#endif
@@ -0,0 +1,1953 @@
+/* synth_Playtune_mipmaps.cpp
+
+    Band-limited copies of the instrument waveforms for synth_Playtune, an audio object
+    for the PJRC Teensy Audio Library, for playing high notes without aliasing.
+    Copy L of each waveform has only its harmonics up to 128 / 2^L.
+
+    This file was generated by host/playtune_mipmaps.cpp from synth_Playtune_waves.cpp.
+    Don't edit it; change that and run it again.
+
+    Copyright (C) 2026, the Playtune_synth contributors (MIT license; see LICENSE.txt)
+*/
+
+#include "Arduino.h"
+#include "synth_Playtune.h"
+
+#if BANDLIMITED_WAVES
+
+extern const int16_t waveform_aguitar_0033_mipmaps[WAVE_MIPMAPS][256] PROGMEM = {
+  { // 64 harmonics
+    205, 2220, 4239, 6311, 8411, 10472, 12465, 14408, 16294, 18083, 19744, 21278, 22681, 23930, 25016, 25944,
+    26709, 27279, 27644, 27821, 27815, 27605, 27177, 26546, 25721, 24688, 23444, 22018, 20433, 18681, 16752, 14669,
+    12468, 10154, 7723, 5200, 2632, 47, -2550, -5141, -7690, -10175, -12591, -14921, -17128, -19187, -21103, -22887,
+    -24526, -26002, -27314, -28473, -29476, -30323, -31026, -31611, -32085, -32433, -32646, -32740, -32739, -32648, -32443, -32104,
+    -31633, -31043, -30334, -29483, -28472, -27311, -26015, -24582, -22995, -21258, -19405, -17467, -15448, -13341, -11162, -8949,
+    -6743, -4560, -2409, -311, 1707, 3629, 5447, 7156, 8746, 10214, 11573, 12834, 13993, 15053, 16031, 16947,
+    17810, 18621, 19389, 20127, 20840, 21523, 22186, 22836, 23458, 24018, 24499, 24912, 25257, 25502, 25623, 25623,
+    25510, 25257, 24841, 24275, 23585, 22764, 21774, 20618, 19342, 17989, 16570, 15089, 13572, 12042, 10509, 8986,
+    7504, 6083, 4715, 3397, 2154, 1012, -33, -1003, -1902, -2721, -3469, -4170, -4837, -5462, -6036, -6574,
+    -7099, -7622, -8137, -8634, -9116, -9600, -10095, -10588, -11050, -11471, -11865, -12240, -12571, -12829, -13014, -13143,
+    -13211, -13199, -13100, -12928, -12688, -12370, -11968, -11488, -10941, -10333, -9680, -8998, -8286, -7532, -6739, -5934,
+    -5133, -4333, -3521, -2701, -1882, -1061, -234, 594, 1420, 2247, 3080, 3922, 4769, 5623, 6475, 7320,
+    8159, 9000, 9838, 10650, 11417, 12139, 12812, 13421, 13954, 14407, 14774, 15041, 15194, 15238, 15170, 14972,
+    14633, 14164, 13576, 12860, 12005, 11027, 9953, 8783, 7502, 6116, 4656, 3145, 1587, -16, -1648, -3287,
+    -4920, -6529, -8100, -9621, -11081, -12460, -13743, -14928, -16009, -16966, -17778, -18448, -18989, -19396, -19648, -19743,
+    -19689, -19480, -19105, -18570, -17894, -17077, -16108, -14994, -13754, -12389, -10885, -9258, -7546, -5751, -3844, -1834,
+  },
+  { // 32 harmonics
+    166, 2208, 4268, 6336, 8402, 10450, 12463, 14419, 16298, 18078, 19743, 21280, 22679, 23929, 25022, 25949,
+    26701, 27269, 27647, 27831, 27816, 27599, 27178, 26550, 25716, 24680, 23448, 22029, 20433, 18670, 16748, 14679,
+    12473, 10145, 7715, 5206, 2641, 46, -2555, -5141, -7690, -10181, -12595, -14912, -17114, -19186, -21116, -22897,
+    -24524, -25995, -27309, -28468, -29472, -30328, -31041, -31621, -32075, -32412, -32637, -32752, -32757, -32651, -32431, -32094,
+    -31635, -31051, -30334, -29477, -28474, -27322, -26019, -24570, -22981, -21261, -19422, -17476, -15439, -13327, -11159, -8959,
+    -6750, -4557, -2404, -310, 1706, 3628, 5447, 7154, 8744, 10218, 11579, 12832, 13986, 15050, 16036, 16953,
+    17810, 18618, 19387, 20124, 20836, 21528, 22197, 22839, 23446, 24005, 24503, 24926, 25261, 25496, 25621, 25626,
+    25503, 25245, 24845, 24296, 23597, 22747, 21750, 20616, 19360, 18004, 16570, 15082, 13564, 12034, 10507, 8998,
+    7518, 6081, 4701, 3390, 2160, 1017, -37, -1006, -1896, -2716, -3475, -4180, -4836, -5451, -6030, -6580,
+    -7108, -7622, -8127, -8626, -9122, -9614, -10099, -10575, -11036, -11474, -11881, -12246, -12563, -12822, -13018, -13147,
+    -13206, -13193, -13104, -12937, -12691, -12364, -11961, -11484, -10942, -10341, -9692, -9000, -8273, -7518, -6741, -5947,
+    -5142, -4330, -3515, -2698, -1880, -1060, -237, 588, 1417, 2250, 3086, 3926, 4770, 5617, 6467, 7318,
+    8167, 9009, 9837, 10642, 11414, 12141, 12814, 13422, 13956, 14408, 14771, 15036, 15197, 15243, 15169, 14968,
+    14635, 14170, 13574, 12850, 12004, 11038, 9960, 8775, 7491, 6117, 4666, 3150, 1583, -22, -1650, -3286,
+    -4917, -6527, -8100, -9623, -11080, -12459, -13747, -14933, -16005, -16956, -17775, -18457, -18998, -19394, -19642, -19741,
+    -19687, -19476, -19107, -18581, -17900, -17070, -16099, -14992, -13753, -12386, -10893, -9278, -7550, -5723, -3816, -1847,
+  },
+  { // 16 harmonics
+    140, 2193, 4270, 6354, 8429, 10476, 12479, 14422, 16288, 18060, 19724, 21266, 22672, 23930, 25028, 25958,
+    26710, 27278, 27654, 27834, 27815, 27593, 27168, 26540, 25709, 24679, 23455, 22041, 20445, 18677, 16748, 14671,
+    12460, 10133, 7709, 5206, 2648, 56, -2546, -5135, -7688, -10183, -12599, -14916, -17118, -19190, -21121, -22903,
+    -24528, -25996, -27305, -28459, -29462, -30318, -31036, -31621, -32081, -32421, -32646, -32759, -32761, -32653, -32431, -32093,
+    -31634, -31047, -30326, -29468, -28465, -27316, -26020, -24577, -22992, -21274, -19432, -17480, -15436, -13319, -11149, -8950,
+    -6745, -4556, -2405, -314, 1701, 3624, 5444, 7152, 8744, 10220, 11581, 12835, 13987, 15050, 16032, 16947,
+    17805, 18616, 19390, 20132, 20848, 21539, 22204, 22839, 23436, 23988, 24484, 24909, 25252, 25499, 25635, 25648,
+    25528, 25265, 24855, 24293, 23580, 22721, 21722, 20595, 19353, 18012, 16591, 15109, 13588, 12047, 10506, 8984,
+    7499, 6063, 4691, 3391, 2169, 1029, -28, -1003, -1900, -2725, -3483, -4184, -4835, -5444, -6020, -6571,
+    -7103, -7621, -8131, -8634, -9132, -9624, -10108, -10580, -11035, -11467, -11869, -12233, -12551, -12815, -13019, -13156,
+    -13220, -13207, -13114, -12941, -12688, -12357, -11951, -11476, -10936, -10340, -9692, -9002, -8276, -7521, -6744, -5950,
+    -5145, -4332, -3515, -2696, -1876, -1055, -233, 590, 1416, 2246, 3081, 3921, 4767, 5617, 6471, 7325,
+    8174, 9014, 9838, 10638, 11406, 12132, 12806, 13418, 13958, 14416, 14781, 15047, 15203, 15244, 15164, 14959,
+    14626, 14163, 13571, 12852, 12007, 11042, 9963, 8776, 7492, 6118, 4668, 3152, 1584, -22, -1651, -3289,
+    -4920, -6530, -8103, -9624, -11080, -12458, -13744, -14929, -16001, -16952, -17773, -18459, -19002, -19400, -19647, -19743,
+    -19684, -19470, -19102, -18579, -17905, -17080, -16110, -14999, -13750, -12372, -10872, -9258, -7540, -5728, -3836, -1875,
+  },
+  { // 8 harmonics
+    -126, 1797, 3757, 5742, 7737, 9729, 11701, 13637, 15520, 17331, 19054, 20668, 22157, 23502, 24688, 25699,
+    26520, 27140, 27550, 27740, 27707, 27447, 26961, 26251, 25323, 24186, 22850, 21327, 19633, 17783, 15796, 13690,
+    11485, 9201, 6856, 4471, 2065, -345, -2742, -5109, -7434, -9702, -11903, -14026, -16062, -18005, -19847, -21582,
+    -23207, -24716, -26107, -27375, -28517, -29531, -30414, -31161, -31770, -32238, -32562, -32739, -32767, -32644, -32368, -31939,
+    -31357, -30625, -29745, -28720, -27557, -26262, -24844, -23313, -21679, -19954, -18151, -16285, -14369, -12417, -10444, -8465,
+    -6492, -4538, -2616, -736, 1094, 2865, 4571, 6208, 7772, 9261, 10675, 12014, 13280, 14474, 15599, 16658,
+    17653, 18587, 19460, 20274, 21029, 21724, 22359, 22928, 23431, 23861, 24213, 24484, 24665, 24752, 24740, 24622,
+    24396, 24058, 23605, 23038, 22357, 21566, 20668, 19670, 18580, 17408, 16163, 14859, 13507, 12121, 10715, 9303,
+    7897, 6512, 5157, 3845, 2584, 1382, 244, -824, -1822, -2747, -3601, -4387, -5107, -5768, -6373, -6930,
+    -7444, -7922, -8369, -8791, -9192, -9575, -9942, -10296, -10635, -10958, -11263, -11546, -11802, -12027, -12215, -12360,
+    -12457, -12498, -12480, -12398, -12248, -12028, -11736, -11371, -10935, -10430, -9860, -9228, -8539, -7801, -7019, -6201,
+    -5353, -4482, -3595, -2699, -1800, -901, -8, 876, 1748, 2607, 3451, 4279, 5091, 5886, 6665, 7428,
+    8173, 8900, 9606, 10289, 10945, 11570, 12157, 12701, 13193, 13626, 13990, 14277, 14476, 14580, 14578, 14464,
+    14229, 13869, 13378, 12755, 11999, 11111, 10096, 8958, 7707, 6351, 4903, 3377, 1787, 151, -1515, -3192,
+    -4863, -6510, -8114, -9659, -11128, -12508, -13784, -14944, -15979, -16880, -17640, -18254, -18719, -19033, -19195, -19206,
+    -19067, -18783, -18355, -17788, -17087, -16256, -15299, -14223, -13033, -11734, -10331, -8832, -7242, -5568, -3819, -2002,
+  },
+  { // 4 harmonics
+    682, 2470, 4268, 6066, 7848, 9601, 11313, 12970, 14559, 16069, 17486, 18801, 20002, 21079, 22022, 22825,
+    23480, 23979, 24319, 24495, 24504, 24345, 24016, 23519, 22854, 22026, 21039, 19897, 18607, 17177, 15614, 13929,
+    12132, 10233, 8244, 6178, 4048, 1867, -351, -2593, -4844, -7090, -9317, -11510, -13657, -15744, -17758, -19686,
+    -21518, -23241, -24846, -26322, -27662, -28858, -29903, -30792, -31520, -32083, -32479, -32707, -32767, -32659, -32386, -31951,
+    -31356, -30609, -29713, -28676, -27506, -26210, -24798, -23278, -21661, -19958, -18178, -16333, -14435, -12493, -10521, -8528,
+    -6526, -4526, -2538, -574, 1358, 3248, 5086, 6866, 8578, 10216, 11773, 13244, 14623, 15907, 17091, 18172,
+    19150, 20021, 20785, 21443, 21994, 22440, 22782, 23022, 23164, 23209, 23163, 23028, 22808, 22509, 22134, 21689,
+    21178, 20606, 19978, 19299, 18574, 17809, 17006, 16172, 15309, 14424, 13519, 12599, 11666, 10725, 9778, 8828,
+    7878, 6930, 5987, 5050, 4122, 3203, 2297, 1403, 523, -340, -1187, -2016, -2825, -3615, -4382, -5127,
+    -5848, -6543, -7211, -7850, -8459, -9037, -9581, -10089, -10559, -10991, -11380, -11726, -12026, -12278, -12480, -12630,
+    -12727, -12767, -12750, -12675, -12539, -12343, -12085, -11764, -11381, -10937, -10430, -9864, -9238, -8556, -7818, -7029,
+    -6191, -5308, -4383, -3422, -2429, -1410, -370, 685, 1748, 2813, 3873, 4921, 5950, 6953, 7923, 8852,
+    9734, 10562, 11328, 12027, 12653, 13199, 13660, 14033, 14311, 14493, 14575, 14555, 14430, 14201, 13868, 13430,
+    12890, 12250, 11513, 10683, 9764, 8763, 7685, 6538, 5329, 4066, 2757, 1413, 42, -1344, -2737, -4125,
+    -5498, -6845, -8156, -9419, -10624, -11762, -12823, -13798, -14677, -15453, -16118, -16666, -17090, -17387, -17551, -17580,
+    -17471, -17224, -16838, -16315, -15656, -14865, -13946, -12904, -11745, -10477, -9108, -7646, -6102, -4485, -2808, -1081,
+  },
+  { // 2 harmonics
+    6180, 5945, 5691, 5420, 5133, 4829, 4510, 4176, 3829, 3468, 3095, 2711, 2316, 1911, 1498, 1076,
+    648, 214, -225, -667, -1112, -1559, -2007, -2454, -2900, -3343, -3783, -4218, -4648, -5070, -5485, -5892,
+    -6288, -6674, -7048, -7410, -7758, -8092, -8411, -8715, -9001, -9270, -9521, -9754, -9967, -10160, -10334, -10486,
+    -10617, -10726, -10814, -10880, -10923, -10943, -10941, -10917, -10869, -10799, -10707, -10592, -10455, -10296, -10115, -9913,
+    -9691, -9447, -9184, -8902, -8601, -8281, -7944, -7591, -7221, -6837, -6438, -6025, -5600, -5163, -4716, -4259,
+    -3793, -3319, -2839, -2353, -1862, -1368, -872, -374, 124, 621, 1117, 1609, 2097, 2580, 3057, 3526,
+    3987, 4439, 4881, 5311, 5730, 6135, 6526, 6903, 7264, 7609, 7937, 8247, 8538, 8811, 9064, 9298,
+    9510, 9702, 9873, 10022, 10149, 10254, 10337, 10397, 10436, 10451, 10445, 10416, 10365, 10293, 10198, 10083,
+    9946, 9789, 9612, 9415, 9199, 8964, 8712, 8443, 8157, 7855, 7538, 7207, 6863, 6507, 6139, 5760,
+    5372, 4975, 4570, 4158, 3741, 3320, 2894, 2467, 2037, 1608, 1178, 751, 326, -95, -511, -922,
+    -1326, -1722, -2110, -2488, -2856, -3212, -3557, -3888, -4206, -4509, -4797, -5069, -5324, -5563, -5784, -5987,
+    -6172, -6338, -6484, -6611, -6718, -6805, -6872, -6919, -6946, -6952, -6938, -6904, -6850, -6776, -6683, -6570,
+    -6439, -6289, -6122, -5936, -5734, -5515, -5281, -5031, -4767, -4489, -4199, -3896, -3582, -3257, -2923, -2580,
+    -2230, -1873, -1510, -1142, -770, -395, -19, 358, 736, 1111, 1485, 1855, 2221, 2582, 2937, 3284,
+    3624, 3954, 4274, 4584, 4882, 5167, 5439, 5696, 5939, 6167, 6378, 6573, 6750, 6909, 7050, 7172,
+    7275, 7359, 7422, 7466, 7489, 7492, 7474, 7436, 7376, 7297, 7197, 7077, 6936, 6776, 6597, 6398,
+  },
+  { // 1 harmonics
+    -1884, -1923, -1961, -1998, -2034, -2068, -2102, -2134, -2165, -2194, -2222, -2249, -2274, -2299, -2321, -2343,
+    -2362, -2381, -2398, -2414, -2428, -2440, -2452, -2461, -2470, -2476, -2482, -2485, -2488, -2488, -2488, -2485,
+    -2482, -2477, -2470, -2462, -2452, -2441, -2428, -2414, -2399, -2382, -2363, -2343, -2322, -2299, -2275, -2250,
+    -2223, -2195, -2166, -2135, -2103, -2070, -2035, -2000, -1963, -1924, -1885, -1845, -1803, -1761, -1717, -1672,
+    -1627, -1580, -1532, -1484, -1434, -1384, -1333, -1281, -1228, -1174, -1120, -1065, -1010, -954, -897, -840,
+    -782, -724, -665, -606, -547, -487, -427, -367, -306, -246, -185, -124, -63, -2, 59, 120,
+    181, 242, 303, 363, 423, 483, 543, 603, 662, 720, 778, 836, 893, 950, 1006, 1062,
+    1117, 1171, 1224, 1277, 1329, 1380, 1431, 1480, 1529, 1576, 1623, 1669, 1714, 1757, 1800, 1842,
+    1882, 1921, 1960, 1997, 2032, 2067, 2100, 2132, 2163, 2193, 2221, 2247, 2273, 2297, 2320, 2341,
+    2361, 2379, 2396, 2412, 2426, 2439, 2450, 2460, 2468, 2475, 2480, 2484, 2486, 2487, 2486, 2484,
+    2480, 2475, 2468, 2460, 2450, 2439, 2427, 2413, 2397, 2380, 2362, 2342, 2321, 2298, 2274, 2248,
+    2222, 2194, 2164, 2134, 2102, 2068, 2034, 1998, 1961, 1923, 1884, 1843, 1802, 1759, 1715, 1671,
+    1625, 1578, 1531, 1482, 1433, 1382, 1331, 1279, 1226, 1173, 1119, 1064, 1008, 952, 896, 838,
+    781, 722, 664, 605, 545, 486, 426, 365, 305, 244, 183, 122, 61, 0, -61, -122,
+    -183, -243, -304, -365, -425, -485, -545, -604, -663, -722, -780, -838, -895, -952, -1008, -1063,
+    -1118, -1172, -1226, -1279, -1331, -1382, -1432, -1482, -1530, -1578, -1625, -1670, -1715, -1759, -1802, -1843,
+  },
+};
+
+extern const int16_t waveform_altosax_0001_mipmaps[WAVE_MIPMAPS][256] PROGMEM = {
+  { // 64 harmonics
+    73, 398, 643, 914, 1275, 1653, 1870, 1787, 1423, 973, 702, 761, 1067, 1389, 1575, 1682,
+    1844, 2075, 2261, 2338, 2372, 2434, 2495, 2488, 2456, 2544, 2832, 3213, 3491, 3585, 3580, 3572,
+    3525, 3331, 2994, 2639, 2329, 1971, 1452, 836, 339, 118, 124, 169, 128, 61, 140, 423,
+    746, 911, 966, 1190, 1768, 2598, 3474, 4326, 5170, 5962, 6692, 7515, 8568, 9662, 10436, 10836,
+    11238, 11956, 12853, 13555, 13927, 14151, 14423, 14736, 14927, 14815, 14318, 13529, 12676, 11935, 11314, 10743,
+    10201, 9677, 9120, 8526, 8015, 7698, 7524, 7361, 7174, 7008, 6875, 6796, 6880, 7209, 7672, 8097,
+    8516, 9101, 9870, 10663, 11449, 12400, 13567, 14706, 15573, 16236, 16920, 17699, 18489, 19261, 20060, 20887,
+    21743, 22726, 23914, 25135, 26052, 26512, 26695, 26887, 27225, 27701, 28281, 28914, 29506, 29990, 30370, 30657,
+    30801, 30740, 30493, 30105, 29546, 28727, 27638, 26400, 25153, 23899, 22481, 20703, 18464, 15842, 13076, 10444,
+    8094, 5970, 3961, 2125, 709, -136, -588, -993, -1448, -1653, -1226, -96, 1478, 3164, 4674, 5692,
+    5901, 5219, 3923, 2412, 875, -706, -2261, -3473, -4040, -4030, -3900, -4149, -4968, -6228, -7699, -9221,
+    -10693, -11982, -12913, -13395, -13527, -13559, -13719, -14113, -14774, -15758, -17091, -18645, -20162, -21441, -22458, -23268,
+    -23885, -24327, -24725, -25263, -26024, -26938, -27864, -28645, -29143, -29337, -29390, -29505, -29710, -29897, -30077, -30440,
+    -31083, -31823, -32386, -32680, -32767, -32659, -32313, -31791, -31240, -30681, -29987, -29114, -28239, -27554, -26987, -26228,
+    -25030, -23431, -21705, -20132, -18823, -17723, -16753, -15900, -15167, -14514, -13908, -13386, -12989, -12629, -12160, -11575,
+    -11036, -10639, -10272, -9770, -9118, -8390, -7575, -6613, -5578, -4667, -3964, -3341, -2631, -1824, -1045, -402,
+  },
+  { // 32 harmonics
+    -114, 320, 740, 1131, 1449, 1641, 1677, 1561, 1345, 1110, 940, 891, 982, 1186, 1452, 1724,
+    1960, 2140, 2261, 2333, 2370, 2388, 2406, 2445, 2530, 2677, 2883, 3127, 3367, 3554, 3650, 3634,
+    3511, 3299, 3020, 2685, 2298, 1863, 1392, 920, 498, 182, 7, -21, 63, 204, 348, 468,
+    577, 721, 961, 1347, 1897, 2592, 3388, 4236, 5100, 5963, 6827, 7695, 8561, 9404, 10198, 10919,
+    11564, 12148, 12701, 13244, 13777, 14268, 14657, 14876, 14871, 14623, 14154, 13523, 12803, 12065, 11357, 10705,
+    10110, 9562, 9055, 8586, 8163, 7795, 7490, 7250, 7073, 6954, 6897, 6912, 7013, 7218, 7537, 7973,
+    8516, 9154, 9876, 10675, 11548, 12488, 13477, 14480, 15451, 16343, 17130, 17817, 18454, 19113, 19873, 20781,
+    21832, 22963, 24070, 25046, 25813, 26357, 26727, 27015, 27323, 27721, 28231, 28821, 29427, 29975, 30408, 30690,
+    30806, 30749, 30509, 30076, 29445, 28626, 27643, 26524, 25284, 23906, 22339, 20514, 18383, 15952, 13302, 10587,
+    7991, 5682, 3758, 2229, 1032, 75, -703, -1296, -1624, -1565, -1016, 36, 1483, 3091, 4549, 5545,
+    5848, 5372, 4192, 2529, 685, -1033, -2391, -3280, -3735, -3915, -4049, -4372, -5050, -6139, -7571, -9172,
+    -10720, -12009, -12908, -13396, -13565, -13593, -13687, -14027, -14725, -15792, -17149, -18651, -20129, -21435, -22480, -23252,
+    -23811, -24269, -24748, -25341, -26079, -26924, -27781, -28533, -29088, -29410, -29532, -29549, -29581, -29734, -30063, -30561,
+    -31163, -31774, -32292, -32638, -32767, -32665, -32349, -31855, -31233, -30540, -29826, -29126, -28441, -27735, -26941, -25985,
+    -24815, -23433, -21900, -20333, -18862, -17593, -16575, -15789, -15165, -14614, -14070, -13508, -12946, -12421, -11962, -11566,
+    -11197, -10799, -10320, -9732, -9039, -8266, -7447, -6605, -5751, -4889, -4028, -3188, -2402, -1699, -1094, -575,
+  },
+  { // 16 harmonics
+    201, 565, 827, 1003, 1110, 1168, 1196, 1211, 1227, 1253, 1294, 1350, 1420, 1500, 1586, 1675,
+    1764, 1854, 1948, 2049, 2162, 2290, 2435, 2597, 2771, 2952, 3128, 3286, 3413, 3494, 3518, 3475,
+    3360, 3173, 2918, 2606, 2250, 1867, 1476, 1095, 744, 440, 195, 23, -71, -80, -2, 162,
+    411, 743, 1154, 1639, 2195, 2815, 3494, 4227, 5006, 5822, 6668, 7532, 8403, 9269, 10117, 10933,
+    11701, 12407, 13036, 13573, 14004, 14319, 14507, 14563, 14486, 14278, 13945, 13502, 12965, 12354, 11693, 11007,
+    10322, 9660, 9043, 8489, 8009, 7612, 7302, 7079, 6941, 6885, 6907, 7005, 7178, 7426, 7751, 8157,
+    8647, 9223, 9883, 10625, 11441, 12318, 13244, 14200, 15169, 16135, 17081, 17998, 18879, 19722, 20529, 21308,
+    22067, 22813, 23554, 24294, 25034, 25768, 26488, 27181, 27835, 28434, 28965, 29417, 29784, 30062, 30249, 30347,
+    30355, 30270, 30086, 29789, 29358, 28770, 27994, 27002, 25766, 24268, 22502, 20478, 18223, 15787, 13234, 10648,
+    8119, 5745, 3617, 1816, 405, -578, -1122, -1246, -996, -444, 321, 1201, 2091, 2895, 3531, 3933,
+    4061, 3897, 3449, 2744, 1827, 752, -423, -1639, -2847, -4006, -5089, -6080, -6979, -7793, -8538, -9236,
+    -9908, -10574, -11253, -11957, -12695, -13471, -14284, -15133, -16014, -16920, -17847, -18789, -19739, -20690, -21636, -22566,
+    -23469, -24336, -25155, -25915, -26608, -27230, -27778, -28256, -28672, -29037, -29366, -29673, -29972, -30276, -30589, -30912,
+    -31239, -31557, -31848, -32088, -32252, -32317, -32258, -32057, -31703, -31191, -30522, -29706, -28760, -27702, -26558, -25353,
+    -24112, -22860, -21620, -20411, -19252, -18156, -17134, -16194, -15342, -14579, -13904, -13310, -12789, -12327, -11907, -11508,
+    -11110, -10689, -10224, -9699, -9099, -8419, -7660, -6829, -5943, -5024, -4097, -3191, -2334, -1549, -858, -273,
+  },
+  { // 8 harmonics
+    -512, 1, 458, 854, 1187, 1457, 1665, 1814, 1910, 1959, 1968, 1947, 1905, 1852, 1797, 1749,
+    1716, 1704, 1719, 1763, 1837, 1942, 2073, 2226, 2396, 2573, 2751, 2918, 3066, 3186, 3268, 3306,
+    3294, 3228, 3107, 2930, 2702, 2429, 2118, 1781, 1430, 1079, 744, 441, 186, -6, -119, -140,
+    -60, 131, 438, 863, 1404, 2057, 2813, 3661, 4585, 5570, 6595, 7639, 8680, 9697, 10666, 11569,
+    12384, 13095, 13689, 14153, 14482, 14670, 14718, 14630, 14413, 14078, 13640, 13114, 12519, 11874, 11201, 10519,
+    9849, 9211, 8622, 8097, 7650, 7291, 7027, 6864, 6803, 6844, 6982, 7213, 7530, 7922, 8382, 8899,
+    9463, 10065, 10697, 11351, 12022, 12705, 13398, 14100, 14811, 15533, 16269, 17022, 17796, 18593, 19418, 20270,
+    21150, 22057, 22986, 23931, 24884, 25833, 26766, 27668, 28520, 29306, 30005, 30600, 31071, 31401, 31573, 31573,
+    31392, 31020, 30455, 29696, 28747, 27619, 26322, 24874, 23296, 21610, 19844, 18024, 16180, 14341, 12536, 10793,
+    9137, 7591, 6175, 4904, 3789, 2837, 2051, 1426, 955, 628, 428, 337, 333, 393, 492, 606,
+    710, 781, 798, 740, 593, 344, -16, -492, -1084, -1791, -2606, -3519, -4519, -5590, -6718, -7885,
+    -9073, -10266, -11449, -12605, -13723, -14793, -15805, -16756, -17643, -18466, -19228, -19935, -20593, -21211, -21798, -22364,
+    -22918, -23471, -24030, -24602, -25190, -25799, -26427, -27073, -27731, -28395, -29056, -29701, -30320, -30898, -31422, -31877,
+    -32251, -32530, -32705, -32767, -32709, -32526, -32218, -31787, -31236, -30572, -29805, -28946, -28009, -27008, -25959, -24877,
+    -23777, -22676, -21587, -20521, -19491, -18504, -17566, -16681, -15851, -15074, -14349, -13669, -13028, -12420, -11836, -11267,
+    -10705, -10142, -9571, -8986, -8384, -7761, -7118, -6454, -5773, -5081, -4382, -3684, -2996, -2326, -1683, -1075,
+  },
+  { // 4 harmonics
+    1517, 1799, 2026, 2200, 2322, 2396, 2425, 2411, 2359, 2272, 2154, 2009, 1842, 1656, 1457, 1249,
+    1036, 822, 612, 410, 219, 44, -113, -248, -358, -441, -495, -518, -509, -466, -389, -278,
+    -133, 46, 258, 501, 774, 1075, 1403, 1753, 2124, 2514, 2918, 3333, 3757, 4186, 4617, 5046,
+    5469, 5884, 6288, 6678, 7050, 7402, 7732, 8038, 8317, 8570, 8793, 8988, 9152, 9287, 9391, 9467,
+    9515, 9535, 9531, 9504, 9455, 9388, 9306, 9211, 9106, 8996, 8883, 8770, 8663, 8563, 8475, 8402,
+    8349, 8317, 8310, 8331, 8384, 8469, 8590, 8748, 8944, 9181, 9458, 9775, 10134, 10533, 10971, 11448,
+    11961, 12508, 13088, 13697, 14332, 14990, 15666, 16358, 17061, 17771, 18482, 19190, 19891, 20580, 21251, 21901,
+    22524, 23116, 23672, 24189, 24662, 25087, 25461, 25781, 26043, 26246, 26388, 26466, 26480, 26428, 26310, 26126,
+    25876, 25562, 25183, 24743, 24242, 23684, 23070, 22403, 21687, 20926, 20122, 19280, 18403, 17496, 16562, 15606,
+    14632, 13644, 12646, 11642, 10636, 9631, 8630, 7638, 6656, 5687, 4734, 3799, 2883, 1989, 1116, 267,
+    -560, -1363, -2143, -2900, -3635, -4348, -5042, -5717, -6376, -7020, -7650, -8269, -8879, -9482, -10080, -10675,
+    -11269, -11865, -12463, -13065, -13673, -14288, -14911, -15543, -16184, -16834, -17494, -18162, -18838, -19521, -20209, -20902,
+    -21596, -22290, -22981, -23667, -24344, -25009, -25658, -26289, -26898, -27480, -28033, -28551, -29033, -29473, -29868, -30216,
+    -30512, -30753, -30937, -31060, -31122, -31119, -31051, -30915, -30712, -30440, -30100, -29692, -29217, -28677, -28072, -27405,
+    -26680, -25897, -25062, -24178, -23248, -22277, -21269, -20230, -19165, -18078, -16976, -15862, -14744, -13626, -12514, -11413,
+    -10329, -9266, -8230, -7225, -6255, -5325, -4438, -3598, -2807, -2069, -1384, -756, -185, 328, 782, 1179,
+  },
+  { // 2 harmonics
+    -2989, -2464, -1956, -1466, -993, -538, -102, 315, 714, 1092, 1452, 1792, 2112, 2412, 2693, 2955,
+    3197, 3421, 3625, 3811, 3980, 4130, 4264, 4381, 4482, 4567, 4638, 4695, 4738, 4769, 4788, 4796,
+    4794, 4783, 4764, 4737, 4703, 4664, 4621, 4574, 4523, 4472, 4419, 4367, 4315, 4266, 4220, 4177,
+    4139, 4107, 4082, 4063, 4053, 4052, 4060, 4078, 4108, 4149, 4202, 4268, 4347, 4439, 4546, 4667,
+    4803, 4953, 5119, 5300, 5496, 5708, 5935, 6178, 6436, 6708, 6996, 7298, 7614, 7944, 8287, 8643,
+    9011, 9391, 9782, 10183, 10594, 11014, 11441, 11876, 12317, 12763, 13213, 13667, 14123, 14580, 15037, 15493,
+    15947, 16397, 16844, 17284, 17718, 18144, 18561, 18967, 19363, 19745, 20114, 20467, 20805, 21125, 21427, 21710,
+    21973, 22214, 22432, 22628, 22799, 22945, 23066, 23160, 23226, 23264, 23274, 23254, 23205, 23125, 23015, 22874,
+    22701, 22497, 22261, 21994, 21694, 21363, 21000, 20606, 20180, 19724, 19236, 18718, 18170, 17594, 16988, 16354,
+    15693, 15006, 14292, 13554, 12792, 12007, 11200, 10373, 9526, 8660, 7778, 6879, 5966, 5039, 4101, 3152,
+    2194, 1228, 256, -721, -1701, -2682, -3664, -4645, -5622, -6596, -7563, -8523, -9475, -10416, -11345, -12261,
+    -13162, -14047, -14915, -15764, -16593, -17401, -18186, -18947, -19684, -20395, -21079, -21735, -22362, -22959, -23526, -24062,
+    -24565, -25036, -25474, -25878, -26248, -26583, -26884, -27149, -27380, -27574, -27734, -27858, -27947, -28000, -28019, -28002,
+    -27952, -27868, -27750, -27599, -27416, -27201, -26956, -26680, -26374, -26040, -25679, -25290, -24877, -24438, -23976, -23491,
+    -22985, -22459, -21913, -21350, -20771, -20176, -19568, -18946, -18314, -17671, -17019, -16360, -15695, -15026, -14352, -13677,
+    -13000, -12324, -11649, -10977, -10309, -9647, -8990, -8341, -7700, -7068, -6447, -5837, -5240, -4655, -4085, -3529,
+  },
+  { // 1 harmonics
+    -12857, -12493, -12121, -11742, -11356, -10963, -10564, -10158, -9746, -9328, -8905, -8476, -8042, -7603, -7160, -6712,
+    -6260, -5805, -5346, -4884, -4419, -3951, -3481, -3009, -2535, -2059, -1582, -1105, -626, -148, 331, 810,
+    1288, 1765, 2241, 2716, 3190, 3661, 4130, 4597, 5060, 5521, 5979, 6433, 6882, 7328, 7770, 8206,
+    8638, 9065, 9486, 9901, 10310, 10714, 11110, 11500, 11883, 12259, 12628, 12989, 13342, 13687, 14023, 14352,
+    14671, 14982, 15284, 15577, 15860, 16133, 16397, 16651, 16895, 17129, 17352, 17565, 17768, 17959, 18140, 18310,
+    18469, 18617, 18753, 18879, 18993, 19095, 19186, 19265, 19333, 19389, 19433, 19466, 19487, 19496, 19494, 19479,
+    19453, 19415, 19366, 19305, 19232, 19148, 19052, 18944, 18826, 18695, 18554, 18401, 18238, 18063, 17877, 17681,
+    17474, 17256, 17028, 16790, 16542, 16283, 16015, 15738, 15450, 15154, 14848, 14533, 14210, 13878, 13537, 13189,
+    12832, 12468, 12096, 11717, 11331, 10938, 10539, 10133, 9721, 9303, 8880, 8451, 8017, 7578, 7135, 6687,
+    6235, 5780, 5321, 4859, 4394, 3926, 3456, 2984, 2510, 2034, 1557, 1080, 601, 123, -356, -835,
+    -1313, -1790, -2266, -2741, -3215, -3686, -4155, -4622, -5085, -5546, -6004, -6458, -6908, -7353, -7795, -8231,
+    -8663, -9090, -9511, -9926, -10335, -10739, -11135, -11525, -11908, -12284, -12653, -13014, -13367, -13712, -14048, -14377,
+    -14696, -15007, -15309, -15602, -15885, -16158, -16422, -16676, -16920, -17154, -17377, -17590, -17793, -17984, -18165, -18335,
+    -18494, -18642, -18778, -18904, -19018, -19120, -19211, -19290, -19358, -19414, -19458, -19491, -19512, -19521, -19519, -19504,
+    -19478, -19441, -19391, -19330, -19257, -19173, -19077, -18969, -18851, -18720, -18579, -18426, -18263, -18088, -17902, -17706,
+    -17499, -17281, -17053, -16815, -16567, -16308, -16040, -15763, -15475, -15179, -14873, -14558, -14235, -13903, -13562, -13214,
+  },
+};
+
+extern const int16_t waveform_birds_0011_mipmaps[WAVE_MIPMAPS][256] PROGMEM = {
+  { // 64 harmonics
+    1134, 4850, 8967, 13121, 17233, 21149, 24559, 27341, 29634, 31467, 32581, 32728, 31923, 30321, 28020, 25107,
+    21750, 18134, 14400, 10667, 7008, 3380, -326, -4089, -7693, -10896, -13594, -15822, -17698, -19362, -20845, -21961,
+    -22406, -22033, -20929, -19221, -16939, -14141, -11049, -7966, -5075, -2389, 150, 2575, 4874, 7007, 8939, 10653,
+    12130, 13307, 14111, 14508, 14494, 14045, 13135, 11777, 10001, 7794, 5174, 2315, -482, -3013, -5318, -7587,
+    -9952, -12407, -14866, -17246, -19478, -21494, -23202, -24502, -25319, -25615, -25365, -24541, -23154, -21257, -18915, -16180,
+    -13158, -10033, -6967, -4004, -1111, 1693, 4354, 6921, 9566, 12391, 15270, 17891, 19974, 21398, 22192, 22419,
+    22116, 21304, 20035, 18402, 16488, 14343, 12021, 9602, 7160, 4737, 2368, 105, -2021, -4032, -5951, -7734,
+    -9275, -10493, -11360, -11886, -12093, -12012, -11663, -11035, -10114, -8938, -7592, -6155, -4679, -3229, -1921, -891,
+    -183, 314, 817, 1483, 2299, 3154, 3977, 4739, 5357, 5662, 5530, 4961, 3995, 2625, 859, -1151,
+    -3154, -4967, -6578, -8052, -9428, -10712, -11965, -13323, -14887, -16608, -18283, -19696, -20735, -21357, -21481, -21004,
+    -19923, -18379, -16551, -14521, -12256, -9672, -6718, -3460, -110, 3082, 5984, 8634, 11101, 13376, 15413, 17230,
+    18891, 20398, 21611, 22301, 22291, 21576, 20314, 18693, 16805, 14682, 12388, 10024, 7641, 5213, 2725, 223,
+    -2230, -4593, -6824, -8864, -10650, -12122, -13239, -14030, -14640, -15225, -15771, -16081, -15947, -15310, -14249, -12870,
+    -11265, -9497, -7615, -5669, -3728, -1827, 54, 1939, 3796, 5603, 7424, 9304, 11114, 12574, 13483, 13834,
+    13706, 13156, 12220, 10956, 9421, 7659, 5705, 3556, 1154, -1533, -4445, -7507, -10719, -14064, -17379, -20440,
+    -23146, -25480, -27324, -28503, -28984, -28861, -28168, -26861, -24955, -22430, -19092, -14893, -10431, -6693, -4036, -1750,
+  },
+  { // 32 harmonics
+    1709, 5039, 8773, 12844, 17031, 21045, 24623, 27593, 29882, 31477, 32370, 32525, 31882, 30404, 28124, 25171,
+    21753, 18095, 14373, 10674, 7001, 3318, -388, -4060, -7574, -10785, -13580, -15926, -17866, -19471, -20780, -21745,
+    -22233, -22071, -21125, -19374, -16937, -14042, -10962, -7925, -5064, -2405, 98, 2500, 4820, 7021, 9028, 10761,
+    12172, 13247, 13996, 14418, 14482, 14123, 13268, 11874, 9963, 7632, 5033, 2333, -331, -2884, -5322, -7687,
+    -10039, -12418, -14821, -17198, -19461, -21503, -23218, -24516, -25330, -25616, -25351, -24528, -23157, -21266, -18909, -16174,
+    -13178, -10057, -6944, -3943, -1096, 1617, 4266, 6936, 9682, 12483, 15236, 17768, 19885, 21423, 22296, 22503,
+    22114, 21236, 19967, 18377, 16506, 14389, 12070, 9621, 7132, 4687, 2343, 118, -2000, -4023, -5944, -7716,
+    -9265, -10509, -11397, -11915, -12094, -11980, -11611, -10999, -10135, -9012, -7656, -6144, -4597, -3155, -1930, -970,
+    -247, 333, 887, 1514, 2261, 3110, 3984, 4774, 5362, 5642, 5532, 4983, 3985, 2576, 839, -1096,
+    -3078, -4964, -6656, -8125, -9420, -10644, -11918, -13336, -14918, -16605, -18263, -19718, -20800, -21384, -21412, -20892,
+    -19881, -18456, -16681, -14596, -12214, -9541, -6604, -3465, -232, 2959, 5976, 8727, 11183, 13374, 15365, 17213,
+    18920, 20416, 21570, 22228, 22269, 21652, 20430, 18735, 16730, 14563, 12325, 10047, 7710, 5290, 2783, 229,
+    -2297, -4704, -6910, -8863, -10544, -11959, -13133, -14090, -14850, -15416, -15776, -15899, -15734, -15226, -14332, -13046,
+    -11413, -9529, -7525, -5524, -3606, -1789, -24, 1764, 3637, 5603, 7598, 9501, 11170, 12478, 13346, 13745,
+    13684, 13191, 12301, 11051, 9483, 7653, 5617, 3415, 1055, -1498, -4293, -7361, -10671, -14107, -17487, -20603,
+    -23288, -25451, -27086, -28226, -28887, -29017, -28498, -27191, -25020, -22044, -18481, -14654, -10896, -7426, -4283, -1320,
+  },
+  { // 16 harmonics
+    2376, 6278, 10172, 13999, 17688, 21154, 24302, 27034, 29250, 30861, 31794, 32001, 31461, 30184, 28214, 25620,
+    22497, 18956, 15117, 11103, 7029, 3000, -893, -4576, -7989, -11087, -13833, -16198, -18157, -19684, -20757, -21353,
+    -21454, -21051, -20142, -18744, -16889, -14625, -12022, -9164, -6146, -3070, -40, 2849, 5510, 7873, 9886, 11513,
+    12740, 13565, 13998, 14058, 13766, 13141, 12205, 10972, 9456, 7669, 5627, 3348, 860, -1802, -4589, -7445,
+    -10303, -13090, -15730, -18151, -20282, -22065, -23452, -24408, -24912, -24957, -24548, -23701, -22437, -20786, -18783, -16463,
+    -13867, -11038, -8022, -4872, -1641, 1610, 4818, 7916, 10838, 13519, 15898, 17920, 19543, 20732, 21468, 21743,
+    21562, 20943, 19914, 18511, 16778, 14765, 12527, 10119, 7602, 5034, 2477, -10, -2370, -4549, -6499, -8180,
+    -9560, -10618, -11346, -11745, -11831, -11629, -11170, -10494, -9642, -8653, -7567, -6418, -5234, -4039, -2851, -1685,
+    -555, 526, 1540, 2470, 3292, 3982, 4512, 4856, 4989, 4894, 4556, 3973, 3150, 2100, 846, -584,
+    -2157, -3841, -5598, -7397, -9205, -10993, -12729, -14386, -15931, -17329, -18543, -19531, -20250, -20656, -20707, -20368,
+    -19615, -18435, -16832, -14826, -12454, -9770, -6841, -3743, -558, 2632, 5745, 8710, 11461, 13944, 16119, 17950,
+    19415, 20498, 21188, 21478, 21370, 20865, 19973, 18709, 17099, 15175, 12981, 10568, 7999, 5337, 2653, 13,
+    -2521, -4895, -7067, -9004, -10690, -12117, -13286, -14203, -14877, -15316, -15524, -15501, -15241, -14736, -13975, -12953,
+    -11668, -10130, -8357, -6383, -4255, -2028, 234, 2464, 4594, 6565, 8325, 9833, 11061, 11991, 12616, 12933,
+    12944, 12649, 12046, 11128, 9886, 8310, 6392, 4134, 1548, -1337, -4472, -7787, -11193, -14584, -17844, -20854,
+    -23497, -25672, -27296, -28310, -28685, -28417, -27531, -26073, -24102, -21688, -18902, -15812, -12479, -8952, -5277, -1489,
+  },
+  { // 8 harmonics
+    2805, 6924, 10942, 14772, 18335, 21554, 24360, 26694, 28505, 29756, 30420, 30484, 29950, 28832, 27156, 24964,
+    22306, 19245, 15852, 12204, 8386, 4484, 586, -3222, -6853, -10231, -13281, -15941, -18157, -19886, -21098, -21775,
+    -21912, -21519, -20616, -19236, -17424, -15233, -12728, -9976, -7052, -4034, -1001, 1970, 4803, 7426, 9775, 11792,
+    13429, 14646, 15416, 15720, 15554, 14922, 13841, 12339, 10451, 8223, 5708, 2964, 55, -2952, -5990, -8990,
+    -11885, -14612, -17112, -19330, -21221, -22744, -23868, -24570, -24838, -24667, -24062, -23038, -21615, -19824, -17703, -15293,
+    -12644, -9808, -6839, -3795, -733, 2290, 5219, 8000, 10585, 12930, 14995, 16747, 18160, 19214, 19897, 20204,
+    20137, 19705, 18924, 17818, 16415, 14750, 12860, 10788, 8579, 6282, 3943, 1611, -667, -2845, -4880, -6734,
+    -8373, -9767, -10892, -11732, -12275, -12518, -12464, -12123, -11510, -10649, -9567, -8297, -6877, -5348, -3753, -2137,
+    -545, 978, 2389, 3649, 4719, 5569, 6172, 6506, 6557, 6319, 5791, 4979, 3899, 2571, 1022, -714,
+    -2600, -4594, -6649, -8719, -10755, -12708, -14532, -16180, -17611, -18789, -19680, -20259, -20505, -20406, -19957, -19160,
+    -18024, -16566, -14809, -12784, -10525, -8074, -5475, -2776, -26, 2723, 5422, 8019, 10468, 12723, 14744, 16494,
+    17942, 19063, 19838, 20256, 20310, 20002, 19341, 18341, 17024, 15415, 13546, 11455, 9181, 6769, 4262, 1710,
+    -842, -3344, -5750, -8017, -10103, -11968, -13580, -14908, -15930, -16626, -16986, -17003, -16678, -16019, -15041, -13765,
+    -12216, -10429, -8440, -6292, -4030, -1706, 631, 2928, 5133, 7193, 9059, 10684, 12027, 13050, 13721, 14017,
+    13922, 13426, 12529, 11242, 9583, 7577, 5261, 2679, -120, -3079, -6135, -9222, -12272, -15214, -17981, -20504,
+    -22720, -24571, -26005, -26978, -27457, -27418, -26846, -25741, -24114, -21986, -19392, -16376, -12994, -9310, -5396, -1330,
+  },
+  { // 4 harmonics
+    1230, 1641, 2042, 2431, 2806, 3166, 3509, 3833, 4137, 4418, 4676, 4909, 5116, 5295, 5445, 5566,
+    5656, 5715, 5742, 5737, 5700, 5629, 5526, 5391, 5223, 5024, 4793, 4533, 4243, 3925, 3580, 3210,
+    2816, 2401, 1965, 1512, 1042, 559, 65, -437, -946, -1459, -1972, -2484, -2991, -3490, -3980, -4457,
+    -4918, -5361, -5784, -6184, -6558, -6905, -7222, -7507, -7759, -7976, -8156, -8298, -8402, -8465, -8489, -8472,
+    -8415, -8316, -8178, -8000, -7783, -7528, -7237, -6911, -6552, -6162, -5744, -5298, -4828, -4338, -3828, -3304,
+    -2767, -2220, -1668, -1113, -559, -10, 533, 1064, 1582, 2082, 2562, 3018, 3448, 3849, 4218, 4554,
+    4853, 5115, 5337, 5518, 5656, 5752, 5803, 5810, 5772, 5691, 5565, 5396, 5185, 4933, 4642, 4313,
+    3948, 3550, 3121, 2663, 2180, 1674, 1148, 606, 51, -513, -1084, -1658, -2231, -2800, -3361, -3911,
+    -4447, -4965, -5463, -5937, -6384, -6803, -7190, -7543, -7861, -8141, -8383, -8584, -8743, -8861, -8936, -8967,
+    -8957, -8903, -8808, -8671, -8494, -8278, -8024, -7735, -7412, -7058, -6674, -6263, -5828, -5371, -4896, -4404,
+    -3900, -3386, -2865, -2341, -1815, -1292, -775, -266, 232, 716, 1183, 1632, 2059, 2462, 2839, 3189,
+    3510, 3799, 4057, 4281, 4471, 4626, 4746, 4830, 4879, 4891, 4869, 4811, 4720, 4595, 4438, 4250,
+    4032, 3786, 3514, 3217, 2897, 2556, 2196, 1819, 1428, 1025, 611, 190, -237, -667, -1098, -1528,
+    -1955, -2376, -2789, -3192, -3584, -3962, -4324, -4670, -4997, -5303, -5588, -5850, -6088, -6301, -6488, -6648,
+    -6781, -6886, -6962, -7010, -7030, -7020, -6982, -6915, -6820, -6698, -6548, -6372, -6171, -5945, -5695, -5423,
+    -5129, -4815, -4482, -4132, -3767, -3386, -2994, -2590, -2178, -1758, -1332, -903, -472, -42, 387, 812,
+  },
+  { // 2 harmonics
+    -485, -472, -460, -449, -439, -430, -423, -416, -411, -407, -404, -403, -402, -403, -405, -408,
+    -412, -418, -425, -433, -442, -452, -463, -476, -489, -504, -519, -536, -554, -572, -591, -612,
+    -633, -655, -678, -701, -725, -750, -775, -801, -827, -854, -881, -909, -937, -965, -993, -1022,
+    -1050, -1079, -1108, -1137, -1165, -1194, -1222, -1250, -1278, -1305, -1332, -1359, -1385, -1411, -1436, -1461,
+    -1485, -1509, -1532, -1554, -1575, -1596, -1616, -1635, -1654, -1671, -1688, -1704, -1719, -1733, -1746, -1758,
+    -1770, -1780, -1790, -1798, -1806, -1813, -1819, -1824, -1828, -1832, -1834, -1836, -1837, -1837, -1836, -1835,
+    -1833, -1830, -1826, -1822, -1817, -1812, -1806, -1800, -1793, -1786, -1779, -1771, -1762, -1754, -1745, -1736,
+    -1727, -1717, -1708, -1699, -1689, -1679, -1670, -1661, -1651, -1642, -1633, -1624, -1616, -1608, -1600, -1592,
+    -1585, -1578, -1571, -1565, -1560, -1554, -1550, -1545, -1542, -1538, -1535, -1533, -1531, -1530, -1530, -1529,
+    -1530, -1531, -1532, -1534, -1536, -1539, -1543, -1546, -1551, -1555, -1560, -1566, -1572, -1578, -1584, -1591,
+    -1598, -1605, -1612, -1620, -1627, -1635, -1643, -1651, -1659, -1666, -1674, -1681, -1689, -1696, -1703, -1710,
+    -1716, -1722, -1728, -1733, -1738, -1742, -1746, -1749, -1752, -1754, -1756, -1756, -1757, -1756, -1755, -1753,
+    -1750, -1747, -1742, -1737, -1731, -1724, -1717, -1708, -1699, -1689, -1678, -1666, -1653, -1639, -1625, -1610,
+    -1593, -1577, -1559, -1540, -1521, -1501, -1481, -1459, -1437, -1415, -1392, -1368, -1344, -1319, -1294, -1268,
+    -1242, -1216, -1189, -1162, -1135, -1108, -1081, -1053, -1026, -999, -971, -944, -917, -890, -864, -838,
+    -812, -787, -762, -737, -713, -690, -668, -646, -624, -604, -584, -565, -547, -530, -514, -499,
+  },
+  { // 1 harmonics
+    -776, -773, -771, -768, -766, -764, -763, -762, -761, -761, -761, -761, -762, -763, -764, -766,
+    -768, -770, -773, -776, -779, -783, -787, -791, -796, -801, -806, -811, -817, -823, -830, -837,
+    -844, -851, -859, -867, -875, -884, -892, -901, -911, -920, -930, -940, -950, -961, -972, -982,
+    -994, -1005, -1016, -1028, -1040, -1052, -1064, -1077, -1089, -1102, -1115, -1128, -1141, -1154, -1167, -1180,
+    -1194, -1207, -1221, -1235, -1248, -1262, -1276, -1290, -1304, -1318, -1332, -1345, -1359, -1373, -1387, -1401,
+    -1414, -1428, -1442, -1455, -1469, -1482, -1495, -1509, -1522, -1535, -1548, -1560, -1573, -1585, -1598, -1610,
+    -1622, -1633, -1645, -1656, -1667, -1678, -1689, -1700, -1710, -1720, -1730, -1740, -1749, -1758, -1767, -1775,
+    -1784, -1792, -1799, -1807, -1814, -1821, -1828, -1834, -1840, -1845, -1851, -1856, -1861, -1865, -1869, -1873,
+    -1876, -1879, -1882, -1884, -1887, -1888, -1890, -1891, -1891, -1892, -1892, -1892, -1891, -1890, -1889, -1887,
+    -1885, -1883, -1880, -1877, -1874, -1870, -1866, -1862, -1857, -1852, -1847, -1841, -1835, -1829, -1823, -1816,
+    -1809, -1801, -1794, -1786, -1778, -1769, -1760, -1751, -1742, -1732, -1723, -1713, -1702, -1692, -1681, -1670,
+    -1659, -1648, -1636, -1625, -1613, -1601, -1588, -1576, -1563, -1551, -1538, -1525, -1512, -1499, -1486, -1472,
+    -1459, -1445, -1432, -1418, -1404, -1390, -1377, -1363, -1349, -1335, -1321, -1307, -1293, -1280, -1266, -1252,
+    -1238, -1225, -1211, -1197, -1184, -1170, -1157, -1144, -1131, -1118, -1105, -1092, -1080, -1067, -1055, -1043,
+    -1031, -1019, -1008, -996, -985, -974, -964, -953, -943, -933, -923, -913, -904, -895, -886, -877,
+    -869, -861, -853, -846, -839, -832, -825, -819, -813, -807, -802, -797, -792, -788, -784, -780,
+  },
+};
+
+extern const int16_t waveform_cello_0005_mipmaps[WAVE_MIPMAPS][256] PROGMEM = {
+  { // 64 harmonics
+    225, 2343, 4227, 5943, 7611, 9322, 11118, 12965, 14727, 16248, 17546, 18831, 20278, 21808, 23183, 24217,
+    24830, 24964, 24603, 23827, 22731, 21316, 19565, 17584, 15542, 13485, 11345, 9114, 6921, 4928, 3257, 1995,
+    1138, 532, -3, -459, -649, -482, -114, 210, 359, 300, -11, -631, -1546, -2646, -3752, -4664,
+    -5232, -5442, -5387, -5115, -4539, -3530, -2129, -609, 705, 1683, 2446, 3165, 3858, 4463, 5052, 5822,
+    6850, 8000, 9175, 10505, 12140, 13955, 15629, 17000, 18181, 19337, 20522, 21713, 22844, 23726, 24119, 24002,
+    23665, 23426, 23309, 23081, 22563, 21817, 21065, 20519, 20243, 20085, 19742, 18994, 17936, 16891, 16056, 15295,
+    14377, 13362, 12593, 12286, 12260, 12173, 11906, 11591, 11320, 10992, 10442, 9594, 8478, 7174, 5776, 4330,
+    2825, 1351, 188, -446, -716, -1024, -1495, -1833, -1826, -1768, -2193, -3293, -4796, -6325, -7713, -8970,
+    -10087, -10925, -11264, -11024, -10452, -10003, -9965, -10289, -10846, -11687, -12930, -14490, -16077, -17384, -18167, -18253,
+    -17637, -16533, -15197, -13747, -12224, -10723, -9324, -7973, -6599, -5242, -3933, -2515, -751, 1416, 3850, 6384,
+    8866, 11124, 13065, 14753, 16219, 17272, 17712, 17640, 17329, 16858, 16162, 15412, 15025, 15180, 15597, 15896,
+    15971, 15869, 15526, 14801, 13669, 12217, 10514, 8620, 6658, 4768, 3048, 1581, 453, -320, -833, -1191,
+    -1449, -1686, -2072, -2769, -3831, -5203, -6742, -8205, -9331, -10054, -10599, -11300, -12331, -13626, -15010, -16345,
+    -17608, -18901, -20371, -22071, -23904, -25685, -27236, -28417, -29188, -29665, -30085, -30637, -31331, -32024, -32544, -32767,
+    -32661, -32291, -31768, -31167, -30492, -29724, -28868, -27959, -27048, -26189, -25384, -24554, -23605, -22529, -21421, -20393,
+    -19509, -18795, -18266, -17899, -17598, -17210, -16593, -15691, -14575, -13353, -12048, -10558, -8778, -6706, -4431, -2076,
+  },
+  { // 32 harmonics
+    100, 2209, 4175, 6013, 7765, 9480, 11184, 12875, 14527, 16113, 17625, 19075, 20477, 21826, 23068, 24100,
+    24794, 25031, 24751, 23966, 22756, 21234, 19504, 17628, 15631, 13518, 11313, 9082, 6931, 4982, 3335, 2036,
+    1070, 386, -79, -361, -470, -408, -201, 78, 302, 329, 43, -597, -1536, -2640, -3735, -4655,
+    -5283, -5563, -5485, -5069, -4345, -3354, -2156, -841, 472, 1662, 2638, 3375, 3928, 4414, 4973, 5721,
+    6714, 7940, 9335, 10821, 12332, 13834, 15319, 16785, 18218, 19584, 20831, 21909, 22778, 23421, 23836, 24029,
+    24010, 23792, 23399, 22879, 22296, 21723, 21214, 20787, 20413, 20024, 19540, 18899, 18084, 17129, 16106, 15103,
+    14200, 13446, 12863, 12441, 12157, 11972, 11835, 11686, 11450, 11057, 10445, 9582, 8474, 7165, 5727, 4247,
+    2817, 1517, 418, -431, -1008, -1328, -1454, -1493, -1585, -1872, -2466, -3416, -4690, -6175, -7706, -9098,
+    -10186, -10865, -11111, -10985, -10625, -10225, -9990, -10100, -10664, -11693, -13088, -14658, -16160, -17353, -18048, -18149,
+    -17660, -16671, -15327, -13789, -12202, -10668, -9241, -7923, -6670, -5402, -4025, -2448, -611, 1499, 3835, 6298,
+    8761, 11092, 13173, 14918, 16267, 17184, 17656, 17700, 17377, 16802, 16136, 15557, 15213, 15174, 15401, 15754,
+    16037, 16053, 15669, 14845, 13627, 12113, 10410, 8601, 6748, 4908, 3158, 1603, 357, -500, -972, -1163,
+    -1260, -1481, -1997, -2875, -4066, -5424, -6780, -8000, -9036, -9921, -10747, -11607, -12565, -13644, -14831, -16115,
+    -17495, -18985, -20591, -22290, -24011, -25647, -27087, -28257, -29144, -29807, -30342, -30847, -31372, -31905, -32374, -32680,
+    -32736, -32501, -31992, -31277, -30447, -29586, -28750, -27955, -27180, -26383, -25520, -24568, -23531, -22449, -21384, -20407,
+    -19575, -18909, -18393, -17968, -17557, -17080, -16473, -15695, -14724, -13545, -12146, -10514, -8653, -6588, -4382, -2122,
+  },
+  { // 16 harmonics
+    -579, 1637, 3840, 5984, 8034, 9964, 11763, 13431, 14979, 16424, 17783, 19070, 20288, 21423, 22449, 23320,
+    23981, 24366, 24411, 24064, 23286, 22067, 20424, 18410, 16104, 13614, 11063, 8579, 6284, 4284, 2654, 1435,
+    630, 203, 85, 183, 392, 604, 724, 678, 423, -52, -724, -1539, -2426, -3297, -4067, -4657,
+    -5009, -5087, -4884, -4417, -3727, -2869, -1905, -897, 102, 1057, 1950, 2782, 3574, 4357, 5173, 6061,
+    7055, 8178, 9435, 10817, 12297, 13837, 15389, 16901, 18324, 19617, 20746, 21693, 22449, 23016, 23406, 23635,
+    23718, 23673, 23511, 23243, 22872, 22404, 21842, 21192, 20464, 19674, 18845, 18001, 17170, 16381, 15658, 15015,
+    14462, 13994, 13595, 13243, 12906, 12548, 12137, 11642, 11044, 10333, 9509, 8587, 7588, 6541, 5479, 4430,
+    3422, 2471, 1587, 770, 12, -700, -1383, -2056, -2731, -3419, -4122, -4839, -5562, -6279, -6978, -7650,
+    -8286, -8886, -9452, -9994, -10523, -11055, -11600, -12168, -12761, -13373, -13989, -14586, -15133, -15595, -15934, -16112,
+    -16096, -15858, -15379, -14648, -13665, -12437, -10982, -9321, -7486, -5507, -3423, -1271, 909, 3076, 5190, 7213,
+    9106, 10839, 12382, 13717, 14829, 15717, 16385, 16847, 17125, 17243, 17229, 17109, 16905, 16630, 16293, 15891,
+    15413, 14845, 14167, 13363, 12421, 11335, 10113, 8773, 7344, 5865, 4382, 2942, 1589, 357, -730, -1661,
+    -2446, -3105, -3675, -4197, -4722, -5294, -5955, -6735, -7652, -8711, -9903, -11207, -12596, -14039, -15506, -16968,
+    -18405, -19804, -21157, -22464, -23727, -24951, -26136, -27280, -28371, -29395, -30330, -31148, -31824, -32331, -32650, -32767,
+    -32679, -32391, -31921, -31291, -30531, -29675, -28754, -27799, -26835, -25883, -24957, -24066, -23214, -22402, -21628, -20889,
+    -20180, -19496, -18826, -18159, -17479, -16765, -15993, -15134, -14161, -13045, -11764, -10303, -8658, -6837, -4860, -2760,
+  },
+  { // 8 harmonics
+    -772, 1404, 3625, 5862, 8084, 10257, 12349, 14327, 16161, 17821, 19282, 20522, 21524, 22274, 22765, 22994,
+    22966, 22686, 22170, 21433, 20497, 19386, 18128, 16750, 15282, 13753, 12193, 10628, 9084, 7585, 6149, 4795,
+    3534, 2378, 1332, 399, -420, -1128, -1728, -2228, -2635, -2956, -3199, -3372, -3482, -3534, -3533, -3481,
+    -3379, -3226, -3021, -2760, -2439, -2052, -1594, -1059, -444, 257, 1046, 1923, 2888, 3937, 5065, 6264,
+    7524, 8832, 10176, 11538, 12901, 14249, 15563, 16824, 18016, 19122, 20127, 21018, 21784, 22418, 22914, 23269,
+    23483, 23560, 23504, 23323, 23027, 22627, 22136, 21566, 20933, 20249, 19527, 18781, 18020, 17256, 16496, 15746,
+    15011, 14295, 13597, 12918, 12256, 11608, 10970, 10338, 9707, 9071, 8427, 7771, 7099, 6408, 5697, 4964,
+    4210, 3436, 2644, 1837, 1016, 186, -650, -1488, -2325, -3158, -3983, -4798, -5602, -6391, -7166, -7924,
+    -8665, -9387, -10089, -10768, -11421, -12045, -12634, -13184, -13686, -14133, -14515, -14821, -15041, -15162, -15174, -15064,
+    -14822, -14438, -13903, -13212, -12360, -11346, -10173, -8845, -7372, -5766, -4043, -2223, -326, 1620, 3590, 5555,
+    7485, 9349, 11119, 12767, 14265, 15591, 16723, 17646, 18347, 18819, 19059, 19068, 18853, 18427, 17803, 17003,
+    16047, 14961, 13771, 12504, 11186, 9845, 8505, 7188, 5913, 4696, 3548, 2477, 1486, 574, -264, -1037,
+    -1757, -2440, -3101, -3759, -4434, -5142, -5901, -6726, -7631, -8624, -9712, -10896, -12175, -13542, -14987, -16495,
+    -18050, -19631, -21215, -22779, -24297, -25745, -27099, -28336, -29438, -30387, -31170, -31778, -32206, -32452, -32522, -32422,
+    -32164, -31762, -31234, -30600, -29881, -29096, -28269, -27417, -26560, -25713, -24889, -24095, -23338, -22619, -21935, -21279,
+    -20641, -20008, -19364, -18692, -17973, -17187, -16317, -15346, -14258, -13042, -11689, -10195, -8559, -6788, -4889, -2878,
+  },
+  { // 4 harmonics
+    4231, 5614, 6931, 8175, 9342, 10426, 11424, 12331, 13144, 13861, 14480, 14999, 15418, 15737, 15956, 16076,
+    16099, 16028, 15866, 15615, 15281, 14868, 14380, 13824, 13206, 12531, 11807, 11040, 10237, 9407, 8555, 7691,
+    6821, 5952, 5093, 4251, 3432, 2645, 1894, 1187, 530, -72, -614, -1090, -1498, -1834, -2093, -2275,
+    -2376, -2396, -2334, -2190, -1964, -1658, -1273, -811, -276, 329, 1001, 1735, 2526, 3370, 4260, 5190,
+    6155, 7148, 8163, 9192, 10228, 11266, 12297, 13315, 14313, 15285, 16223, 17122, 17975, 18776, 19521, 20203,
+    20819, 21364, 21834, 22226, 22537, 22764, 22907, 22963, 22931, 22812, 22606, 22313, 21935, 21473, 20931, 20309,
+    19613, 18844, 18008, 17108, 16150, 15138, 14077, 12973, 11832, 10659, 9460, 8241, 7010, 5770, 4530, 3294,
+    2069, 860, -327, -1485, -2611, -3698, -4743, -5740, -6685, -7574, -8404, -9172, -9874, -10507, -11071, -11562,
+    -11980, -12323, -12591, -12783, -12899, -12941, -12908, -12802, -12624, -12376, -12060, -11678, -11233, -10729, -10167, -9552,
+    -8887, -8176, -7422, -6630, -5805, -4950, -4070, -3170, -2254, -1327, -393, 542, 1474, 2398, 3310, 4204,
+    5077, 5924, 6741, 7522, 8264, 8964, 9617, 10219, 10767, 11257, 11687, 12054, 12354, 12586, 12747, 12836,
+    12850, 12788, 12650, 12434, 12141, 11769, 11319, 10792, 10188, 9509, 8756, 7931, 7036, 6073, 5046, 3958,
+    2812, 1611, 361, -934, -2270, -3642, -5045, -6473, -7920, -9381, -10850, -12320, -13785, -15239, -16676, -18088,
+    -19471, -20816, -22118, -23371, -24569, -25705, -26773, -27770, -28688, -29524, -30273, -30930, -31492, -31955, -32316, -32573,
+    -32724, -32767, -32701, -32527, -32243, -31850, -31351, -30746, -30037, -29228, -28322, -27323, -26235, -25063, -23813, -22489,
+    -21099, -19648, -18144, -16594, -15006, -13386, -11742, -10083, -8417, -6752, -5095, -3454, -1838, -254, 1290, 2787,
+  },
+  { // 2 harmonics
+    -9187, -8611, -8023, -7424, -6814, -6195, -5567, -4932, -4291, -3645, -2994, -2341, -1685, -1028, -371, 285,
+    938, 1588, 2234, 2875, 3509, 4136, 4755, 5364, 5963, 6550, 7126, 7688, 8237, 8771, 9289, 9791,
+    10276, 10744, 11193, 11624, 12035, 12426, 12796, 13146, 13474, 13781, 14066, 14329, 14569, 14787, 14982, 15155,
+    15304, 15431, 15536, 15618, 15677, 15714, 15730, 15724, 15696, 15648, 15579, 15490, 15382, 15254, 15108, 14945,
+    14764, 14566, 14353, 14124, 13882, 13625, 13356, 13075, 12782, 12479, 12167, 11845, 11517, 11181, 10839, 10492,
+    10140, 9785, 9428, 9069, 8709, 8349, 7990, 7632, 7277, 6926, 6578, 6235, 5898, 5567, 5242, 4925,
+    4617, 4317, 4026, 3744, 3473, 3213, 2964, 2726, 2499, 2285, 2083, 1893, 1716, 1552, 1401, 1262,
+    1136, 1023, 923, 835, 760, 697, 646, 607, 580, 563, 557, 562, 576, 600, 632, 673,
+    722, 778, 840, 909, 983, 1061, 1144, 1230, 1318, 1408, 1500, 1592, 1684, 1774, 1863, 1950,
+    2033, 2112, 2187, 2257, 2320, 2377, 2426, 2468, 2501, 2525, 2539, 2543, 2536, 2517, 2488, 2445,
+    2391, 2323, 2243, 2149, 2041, 1919, 1783, 1633, 1468, 1290, 1096, 889, 667, 431, 181, -83,
+    -361, -652, -955, -1271, -1600, -1940, -2292, -2654, -3026, -3408, -3800, -4199, -4606, -5020, -5440, -5866,
+    -6297, -6731, -7168, -7608, -8048, -8490, -8930, -9370, -9807, -10240, -10670, -11095, -11513, -11925, -12329, -12724,
+    -13109, -13484, -13847, -14198, -14536, -14859, -15168, -15462, -15738, -15998, -16240, -16464, -16668, -16852, -17016, -17160,
+    -17282, -17382, -17459, -17514, -17547, -17555, -17541, -17502, -17440, -17353, -17243, -17109, -16950, -16767, -16561, -16331,
+    -16078, -15801, -15501, -15179, -14835, -14469, -14082, -13675, -13247, -12800, -12334, -11850, -11349, -10831, -10298, -9749,
+  },
+  { // 1 harmonics
+    -4954, -4694, -4431, -4166, -3898, -3627, -3355, -3081, -2804, -2526, -2247, -1966, -1684, -1401, -1117, -832,
+    -547, -261, 24, 310, 595, 880, 1165, 1449, 1731, 2013, 2294, 2573, 2851, 3127, 3401, 3673,
+    3943, 4211, 4476, 4738, 4997, 5254, 5507, 5757, 6004, 6246, 6486, 6721, 6952, 7179, 7401, 7620,
+    7833, 8042, 8246, 8445, 8639, 8828, 9011, 9189, 9362, 9529, 9690, 9845, 9994, 10138, 10275, 10406,
+    10531, 10649, 10761, 10867, 10966, 11058, 11144, 11223, 11295, 11360, 11419, 11471, 11515, 11553, 11584, 11608,
+    11625, 11635, 11638, 11634, 11623, 11605, 11580, 11548, 11508, 11463, 11410, 11350, 11283, 11210, 11130, 11043,
+    10950, 10850, 10743, 10630, 10511, 10385, 10253, 10114, 9970, 9820, 9664, 9501, 9334, 9160, 8981, 8797,
+    8607, 8413, 8213, 8008, 7798, 7584, 7365, 7142, 6914, 6682, 6446, 6207, 5963, 5716, 5466, 5212,
+    4955, 4695, 4432, 4167, 3899, 3629, 3356, 3082, 2805, 2527, 2248, 1967, 1685, 1402, 1118, 833,
+    548, 263, -23, -309, -594, -879, -1164, -1447, -1730, -2012, -2293, -2572, -2850, -3126, -3400, -3672,
+    -3942, -4210, -4475, -4737, -4996, -5253, -5506, -5756, -6002, -6245, -6484, -6720, -6951, -7178, -7400, -7618,
+    -7832, -8041, -8245, -8444, -8638, -8827, -9010, -9188, -9361, -9528, -9689, -9844, -9993, -10137, -10274, -10405,
+    -10530, -10648, -10760, -10865, -10964, -11057, -11143, -11222, -11294, -11359, -11418, -11469, -11514, -11552, -11583, -11607,
+    -11624, -11634, -11637, -11633, -11622, -11603, -11578, -11546, -11507, -11461, -11409, -11349, -11282, -11209, -11129, -11042,
+    -10949, -10848, -10742, -10629, -10509, -10384, -10252, -10113, -9969, -9819, -9662, -9500, -9333, -9159, -8980, -8796,
+    -8606, -8411, -8212, -8007, -7797, -7583, -7364, -7140, -6913, -6681, -6445, -6205, -5962, -5715, -5464, -5211,
+  },
+};
+
+extern const int16_t waveform_clarinett_0001_mipmaps[WAVE_MIPMAPS][256] PROGMEM = {
+  { // 64 harmonics
+    -49, 843, 1688, 2517, 3299, 4046, 4829, 5611, 6230, 6638, 7012, 7469, 7807, 7742, 7312, 6796,
+    6300, 5690, 4949, 4316, 3984, 3899, 3979, 4325, 5048, 6050, 7154, 8336, 9685, 11193, 12746, 14264,
+    15741, 17179, 18569, 19892, 21091, 22122, 23074, 24122, 25297, 26433, 27429, 28401, 29454, 30469, 31284, 31921,
+    32438, 32685, 32455, 31794, 30928, 29903, 28578, 26969, 25325, 23808, 22343, 20858, 19451, 18210, 17038, 15792,
+    14486, 13219, 12022, 10866, 9747, 8660, 7550, 6377, 5164, 3936, 2681, 1414, 200, -937, -2027, -3052,
+    -3916, -4575, -5079, -5451, -5653, -5733, -5863, -6138, -6452, -6681, -6868, -7104, -7335, -7418, -7306, -7025,
+    -6535, -5796, -4917, -4082, -3287, -2334, -1121, 170, 1272, 2124, 2871, 3594, 4168, 4434, 4424, 4320,
+    4201, 3957, 3513, 3015, 2665, 2445, 2190, 1881, 1684, 1654, 1620, 1423, 1107, 747, 271, -404,
+    -1194, -1954, -2658, -3353, -4008, -4561, -5020, -5395, -5638, -5763, -5910, -6155, -6367, -6446, -6544, -6851,
+    -7265, -7566, -7813, -8244, -8805, -9144, -9148, -9145, -9422, -9836, -10101, -10221, -10406, -10742, -11183, -11777,
+    -12636, -13725, -14878, -16028, -17258, -18603, -19956, -21179, -22230, -23136, -23930, -24615, -25155, -25523, -25793, -26122,
+    -26566, -26982, -27201, -27259, -27358, -27594, -27843, -27928, -27817, -27587, -27281, -26857, -26278, -25589, -24857, -24057,
+    -23075, -21871, -20570, -19287, -17936, -16343, -14534, -12732, -11038, -9297, -7379, -5414, -3582, -1839, -15, 1894,
+    3754, 5527, 7252, 8841, 10124, 11108, 11977, 12800, 13436, 13784, 13944, 14012, 13893, 13454, 12727, 11852,
+    10894, 9847, 8725, 7562, 6390, 5277, 4310, 3462, 2578, 1590, 637, -153, -893, -1776, -2755, -3580,
+    -4150, -4636, -5202, -5763, -6116, -6215, -6192, -6151, -6034, -5716, -5176, -4508, -3793, -2999, -2065, -1038,
+  },
+  { // 32 harmonics
+    -110, 814, 1697, 2538, 3337, 4097, 4822, 5506, 6141, 6706, 7172, 7505, 7665, 7625, 7370, 6916,
+    6308, 5617, 4937, 4361, 3975, 3838, 3980, 4403, 5085, 5995, 7096, 8352, 9729, 11196, 12717, 14253,
+    15764, 17215, 18579, 19844, 21018, 22118, 23173, 24212, 25257, 26317, 27390, 28459, 29494, 30457, 31301, 31972,
+    32414, 32573, 32406, 31891, 31036, 29880, 28491, 26957, 25367, 23796, 22292, 20874, 19532, 18243, 16979, 15726,
+    14480, 13251, 12051, 10887, 9755, 8638, 7515, 6365, 5176, 3949, 2696, 1439, 206, -973, -2068, -3048,
+    -3887, -4563, -5071, -5421, -5649, -5803, -5940, -6109, -6337, -6619, -6922, -7193, -7372, -7408, -7272, -6954,
+    -6465, -5827, -5059, -4182, -3210, -2161, -1060, 56, 1136, 2127, 2977, 3647, 4115, 4382, 4461, 4380,
+    4171, 3867, 3503, 3112, 2729, 2384, 2103, 1897, 1759, 1662, 1562, 1408, 1152, 763, 232, -421,
+    -1157, -1928, -2685, -3388, -4013, -4548, -4992, -5349, -5628, -5838, -5997, -6127, -6255, -6410, -6614, -6880,
+    -7204, -7568, -7946, -8312, -8644, -8932, -9176, -9385, -9572, -9751, -9939, -10155, -10423, -10775, -11245, -11866,
+    -12659, -13630, -14760, -16014, -17338, -18672, -19960, -21153, -22220, -23144, -23923, -24568, -25099, -25538, -25910, -26236,
+    -26533, -26810, -27071, -27312, -27523, -27692, -27800, -27831, -27766, -27591, -27293, -26869, -26319, -25648, -24864, -23976,
+    -22984, -21886, -20672, -19334, -17868, -16280, -14588, -12819, -11005, -9174, -7341, -5512, -3677, -1827, 41, 1918,
+    3774, 5564, 7237, 8746, 10060, 11169, 12079, 12807, 13367, 13764, 13989, 14020, 13835, 13417, 12771, 11923,
+    10917, 9811, 8662, 7517, 6411, 5357, 4360, 3410, 2496, 1606, 729, -139, -1000, -1847, -2667, -3442,
+    -4151, -4774, -5295, -5707, -6005, -6189, -6256, -6199, -6010, -5676, -5191, -4561, -3801, -2940, -2014, -1060,
+  },
+  { // 16 harmonics
+    -232, 657, 1542, 2420, 3282, 4119, 4917, 5655, 6309, 6853, 7259, 7505, 7575, 7465, 7185, 6757,
+    6222, 5631, 5046, 4532, 4155, 3972, 4029, 4355, 4961, 5836, 6952, 8266, 9723, 11265, 12835, 14382,
+    15867, 17266, 18570, 19784, 20925, 22017, 23086, 24155, 25240, 26345, 27460, 28561, 29610, 30564, 31370, 31978,
+    32344, 32432, 32224, 31715, 30918, 29863, 28592, 27157, 25615, 24021, 22427, 20875, 19395, 18005, 16708, 15499,
+    14358, 13263, 12187, 11104, 9993, 8839, 7636, 6386, 5100, 3798, 2503, 1243, 46, -1065, -2068, -2951,
+    -3707, -4339, -4856, -5275, -5614, -5895, -6138, -6357, -6564, -6759, -6937, -7083, -7176, -7188, -7093, -6863,
+    -6479, -5927, -5206, -4328, -3317, -2209, -1051, 105, 1205, 2197, 3037, 3694, 4149, 4398, 4456, 4347,
+    4110, 3787, 3421, 3053, 2714, 2425, 2193, 2011, 1863, 1722, 1557, 1338, 1040, 644, 146, -449,
+    -1122, -1845, -2584, -3302, -3966, -4548, -5030, -5407, -5685, -5881, -6021, -6135, -6252, -6400, -6596, -6852,
+    -7164, -7522, -7906, -8293, -8658, -8982, -9251, -9462, -9626, -9762, -9900, -10077, -10331, -10699, -11210, -11881,
+    -12719, -13713, -14841, -16068, -17352, -18645, -19903, -21085, -22160, -23105, -23913, -24587, -25139, -25588, -25958, -26272,
+    -26551, -26808, -27051, -27279, -27484, -27653, -27768, -27809, -27759, -27600, -27321, -26914, -26376, -25707, -24911, -23994,
+    -22961, -21819, -20572, -19226, -17784, -16250, -14629, -12927, -11153, -9317, -7435, -5522, -3597, -1678, 213, 2058,
+    3835, 5527, 7115, 8582, 9909, 11081, 12081, 12893, 13503, 13901, 14078, 14034, 13773, 13307, 12654, 11839,
+    10895, 9854, 8753, 7624, 6499, 5401, 4348, 3347, 2400, 1502, 644, -184, -992, -1784, -2562, -3317,
+    -4037, -4703, -5290, -5774, -6133, -6345, -6400, -6291, -6021, -5602, -5052, -4392, -3647, -2839, -1990, -1117,
+  },
+  { // 8 harmonics
+    530, 1396, 2222, 2994, 3697, 4321, 4857, 5301, 5649, 5902, 6065, 6144, 6149, 6092, 5990, 5857,
+    5713, 5576, 5467, 5404, 5406, 5491, 5675, 5972, 6391, 6942, 7628, 8452, 9409, 10495, 11700, 13011,
+    14412, 15886, 17410, 18962, 20519, 22056, 23549, 24974, 26307, 27527, 28614, 29552, 30326, 30925, 31341, 31569,
+    31608, 31459, 31129, 30624, 29955, 29136, 28179, 27101, 25918, 24649, 23309, 21916, 20486, 19034, 17573, 16117,
+    14675, 13257, 11870, 10519, 9208, 7941, 6717, 5539, 4405, 3315, 2269, 1265, 305, -613, -1488, -2317,
+    -3098, -3828, -4503, -5118, -5668, -6147, -6551, -6872, -7108, -7253, -7303, -7257, -7114, -6875, -6542, -6120,
+    -5614, -5032, -4384, -3680, -2933, -2157, -1366, -573, 205, 955, 1662, 2313, 2896, 3401, 3818, 4141,
+    4365, 4487, 4507, 4426, 4249, 3981, 3629, 3202, 2711, 2166, 1580, 964, 330, -310, -945, -1566,
+    -2163, -2728, -3256, -3742, -4183, -4578, -4927, -5233, -5497, -5725, -5922, -6095, -6249, -6394, -6535, -6680,
+    -6838, -7013, -7214, -7444, -7710, -8015, -8361, -8752, -9189, -9671, -10199, -10772, -11386, -12042, -12734, -13460,
+    -14217, -15000, -15805, -16627, -17463, -18307, -19155, -20001, -20841, -21669, -22479, -23265, -24022, -24743, -25422, -26052,
+    -26626, -27137, -27578, -27940, -28219, -28405, -28493, -28476, -28349, -28106, -27744, -27259, -26648, -25912, -25049, -24063,
+    -22955, -21730, -20395, -18956, -17422, -15803, -14110, -12357, -10555, -8720, -6866, -5009, -3164, -1347, 425, 2137,
+    3775, 5322, 6767, 8095, 9295, 10357, 11271, 12031, 12631, 13066, 13335, 13438, 13375, 13152, 12773, 12246,
+    11581, 10788, 9882, 8876, 7786, 6629, 5424, 4188, 2942, 1705, 495, -669, -1768, -2785, -3706, -4516,
+    -5204, -5759, -6175, -6447, -6573, -6554, -6394, -6098, -5676, -5138, -4499, -3774, -2979, -2132, -1253, -359,
+  },
+  { // 4 harmonics
+    -5100, -5090, -5004, -4840, -4600, -4282, -3887, -3416, -2870, -2253, -1565, -811, 6, 882, 1812, 2793,
+    3819, 4885, 5984, 7111, 8261, 9426, 10600, 11778, 12952, 14116, 15264, 16389, 17486, 18548, 19569, 20545,
+    21470, 22339, 23147, 23890, 24566, 25169, 25698, 26149, 26522, 26813, 27023, 27150, 27195, 27157, 27038, 26839,
+    26561, 26207, 25779, 25279, 24712, 24080, 23387, 22638, 21837, 20989, 20098, 19168, 18206, 17216, 16203, 15173,
+    14130, 13079, 12027, 10976, 9933, 8902, 7887, 6893, 5923, 4981, 4071, 3196, 2358, 1561, 807, 98,
+    -565, -1179, -1745, -2261, -2726, -3141, -3505, -3819, -4084, -4300, -4469, -4592, -4670, -4706, -4701, -4657,
+    -4577, -4462, -4317, -4142, -3942, -3718, -3473, -3211, -2934, -2645, -2347, -2042, -1734, -1426, -1120, -818,
+    -524, -240, 31, 288, 528, 748, 947, 1123, 1274, 1397, 1492, 1558, 1591, 1592, 1559, 1492,
+    1389, 1249, 1072, 858, 606, 317, -11, -377, -780, -1220, -1697, -2209, -2756, -3337, -3951, -4595,
+    -5269, -5971, -6699, -7451, -8224, -9017, -9827, -10650, -11485, -12328, -13176, -14027, -14876, -15720, -16557, -17381,
+    -18190, -18981, -19748, -20489, -21200, -21878, -22518, -23117, -23673, -24180, -24637, -25041, -25387, -25675, -25901, -26064,
+    -26161, -26191, -26152, -26043, -25865, -25615, -25295, -24905, -24445, -23917, -23322, -22661, -21938, -21154, -20312, -19416,
+    -18470, -17476, -16440, -15365, -14258, -13121, -11961, -10783, -9593, -8395, -7197, -6002, -4818, -3649, -2502, -1382,
+    -294, 756, 1763, 2723, 3631, 4483, 5274, 6003, 6664, 7256, 7776, 8222, 8594, 8890, 9109, 9253,
+    9321, 9314, 9235, 9085, 8866, 8583, 8237, 7834, 7377, 6871, 6321, 5732, 5109, 4459, 3788, 3101,
+    2405, 1706, 1011, 325, -344, -991, -1610, -2195, -2740, -3240, -3690, -4085, -4421, -4693, -4899, -5036,
+  },
+  { // 2 harmonics
+    7999, 8291, 8577, 8857, 9132, 9402, 9665, 9923, 10175, 10420, 10660, 10893, 11119, 11339, 11553, 11759,
+    11959, 12151, 12337, 12516, 12687, 12851, 13008, 13158, 13300, 13434, 13561, 13680, 13792, 13896, 13992, 14081,
+    14161, 14234, 14299, 14355, 14404, 14445, 14478, 14503, 14520, 14529, 14530, 14522, 14507, 14484, 14453, 14413,
+    14366, 14311, 14247, 14176, 14097, 14010, 13915, 13812, 13702, 13584, 13458, 13324, 13183, 13034, 12878, 12714,
+    12543, 12365, 12180, 11987, 11788, 11581, 11368, 11148, 10921, 10687, 10448, 10201, 9949, 9690, 9426, 9155,
+    8879, 8597, 8310, 8017, 7719, 7416, 7109, 6796, 6479, 6157, 5832, 5502, 5168, 4831, 4490, 4146,
+    3798, 3448, 3095, 2739, 2381, 2021, 1659, 1295, 930, 563, 195, -173, -542, -912, -1281, -1651,
+    -2020, -2389, -2757, -3124, -3489, -3853, -4216, -4576, -4935, -5290, -5643, -5994, -6341, -6684, -7024, -7360,
+    -7692, -8019, -8342, -8661, -8974, -9282, -9584, -9881, -10172, -10456, -10735, -11007, -11272, -11530, -11781, -12025,
+    -12261, -12490, -12711, -12924, -13129, -13325, -13513, -13692, -13863, -14025, -14178, -14322, -14456, -14581, -14697, -14804,
+    -14900, -14988, -15065, -15133, -15191, -15239, -15277, -15305, -15324, -15332, -15331, -15319, -15298, -15266, -15225, -15174,
+    -15113, -15042, -14962, -14872, -14772, -14663, -14544, -14416, -14279, -14133, -13978, -13814, -13641, -13459, -13269, -13071,
+    -12865, -12650, -12428, -12198, -11960, -11715, -11463, -11204, -10938, -10665, -10386, -10101, -9810, -9513, -9211, -8903,
+    -8590, -8272, -7950, -7623, -7292, -6957, -6618, -6275, -5930, -5581, -5229, -4875, -4518, -4159, -3799, -3436,
+    -3073, -2708, -2342, -1975, -1608, -1241, -874, -506, -140, 227, 592, 956, 1319, 1680, 2040, 2398,
+    2753, 3107, 3457, 3806, 4151, 4493, 4831, 5167, 5498, 5826, 6150, 6469, 6785, 7096, 7402, 7703,
+  },
+  { // 1 harmonics
+    7842, 8152, 8456, 8755, 9050, 9338, 9621, 9899, 10170, 10435, 10694, 10946, 11192, 11431, 11663, 11889,
+    12107, 12317, 12521, 12716, 12904, 13085, 13257, 13422, 13578, 13726, 13866, 13998, 14121, 14235, 14341, 14439,
+    14527, 14607, 14678, 14741, 14794, 14839, 14874, 14901, 14918, 14927, 14927, 14917, 14899, 14872, 14835, 14790,
+    14736, 14673, 14601, 14520, 14431, 14333, 14226, 14111, 13987, 13855, 13714, 13565, 13408, 13243, 13070, 12889,
+    12701, 12504, 12300, 12089, 11870, 11645, 11412, 11172, 10926, 10673, 10414, 10148, 9876, 9598, 9315, 9026,
+    8731, 8431, 8126, 7817, 7502, 7183, 6860, 6532, 6201, 5866, 5527, 5185, 4840, 4492, 4141, 3788,
+    3432, 3074, 2715, 2354, 1991, 1627, 1263, 897, 531, 165, -202, -568, -934, -1299, -1664, -2028,
+    -2390, -2751, -3111, -3468, -3823, -4177, -4527, -4875, -5220, -5562, -5900, -6235, -6566, -6893, -7216, -7535,
+    -7849, -8158, -8463, -8762, -9057, -9345, -9628, -9905, -10177, -10442, -10701, -10953, -11199, -11438, -11670, -11895,
+    -12113, -12324, -12528, -12723, -12911, -13092, -13264, -13428, -13585, -13733, -13873, -14004, -14128, -14242, -14348, -14446,
+    -14534, -14614, -14685, -14748, -14801, -14846, -14881, -14908, -14925, -14934, -14934, -14924, -14906, -14879, -14842, -14797,
+    -14743, -14680, -14608, -14527, -14438, -14340, -14233, -14118, -13994, -13862, -13721, -13572, -13415, -13250, -13077, -12896,
+    -12708, -12511, -12307, -12096, -11877, -11652, -11419, -11179, -10933, -10680, -10420, -10155, -9883, -9605, -9322, -9033,
+    -8738, -8438, -8133, -7824, -7509, -7190, -6867, -6539, -6208, -5873, -5534, -5192, -4847, -4499, -4148, -3794,
+    -3439, -3081, -2722, -2361, -1998, -1634, -1270, -904, -538, -172, 195, 561, 927, 1293, 1657, 2021,
+    2383, 2744, 3104, 3461, 3817, 4170, 4520, 4868, 5213, 5555, 5893, 6228, 6559, 6886, 7209, 7528,
+  },
+};
+
+extern const int16_t waveform_clavinet_0021_mipmaps[WAVE_MIPMAPS][256] PROGMEM = {
+  { // 64 harmonics
+    2199, 7596, 13176, 18852, 24258, 28782, 31760, 32731, 31659, 28968, 25349, 21499, 18013, 15390, 13973, 13742,
+    14200, 14579, 14290, 13290, 12107, 11527, 12111, 13861, 16215, 18378, 19725, 20013, 19356, 18070, 16535, 15114,
+    14047, 13352, 12838, 12259, 11468, 10411, 9068, 7544, 6193, 5430, 5266, 5159, 4539, 3477, 2656, 2646,
+    3336, 4111, 4419, 4110, 3413, 2763, 2536, 2743, 2990, 2857, 2382, 2060, 2307, 2968, 3394, 3008,
+    1844, 569, -42, 267, 1074, 1693, 1720, 1219, 547, 115, 180, 617, 876, 397, -779, -1903,
+    -2172, -1500, -574, -192, -635, -1619, -2660, -3388, -3618, -3331, -2669, -1877, -1147, -510, 60, 422,
+    252, -664, -2097, -3419, -4022, -3710, -2747, -1639, -897, -845, -1422, -2090, -2110, -1087, 690, 2464,
+    3505, 3382, 1913, -843, -4381, -7702, -9750, -10034, -8809, -6745, -4521, -2654, -1388, -545, 425, 2000,
+    4144, 6389, 8304, 9719, 10508, 10403, 9267, 7480, 5816, 4836, 4462, 4240, 3906, 3561, 3333, 3100,
+    2677, 2156, 1882, 2129, 2956, 4412, 6628, 9548, 12684, 15321, 16979, 17575, 17222, 16062, 14331, 12391,
+    10516, 8661, 6508, 3729, 206, -3942, -8414, -12797, -16644, -19571, -21346, -21964, -21642, -20712, -19450, -18009,
+    -16487, -15006, -13684, -12543, -11500, -10478, -9545, -8959, -9041, -9935, -11446, -13130, -14581, -15627, -16249, -16402,
+    -15982, -14985, -13617, -12252, -11292, -11053, -11664, -12958, -14463, -15589, -15919, -15352, -13970, -11772, -8606, -4387,
+    618, 5754, 10237, 13483, 15269, 15685, 14945, 13150, 10185, 5898, 460, -5474, -11062, -15767, -19529, -22471,
+    -24521, -25362, -24693, -22511, -19211, -15499, -12148, -9674, -8123, -7169, -6434, -5720, -5016, -4357, -3740, -3148,
+    -2663, -2595, -3464, -5712, -9283, -13453, -17172, -19652, -20720, -20672, -19842, -18296, -15862, -12394, -8007, -3038,
+  },
+  { // 32 harmonics
+    1940, 7529, 13328, 19059, 24331, 28666, 31569, 32653, 31783, 29179, 25425, 21343, 17774, 15317, 14149, 13997,
+    14288, 14418, 14029, 13162, 12226, 11786, 12282, 13794, 15975, 18183, 19741, 20209, 19549, 18101, 16403, 14943,
+    13965, 13408, 12996, 12413, 11477, 10212, 8814, 7526, 6509, 5776, 5219, 4700, 4146, 3604, 3201, 3064,
+    3223, 3577, 3926, 4062, 3877, 3411, 2837, 2374, 2182, 2296, 2608, 2931, 3084, 2969, 2601, 2086,
+    1565, 1152, 902, 806, 822, 895, 982, 1048, 1058, 977, 773, 436, -6, -480, -892, -1156,
+    -1235, -1160, -1030, -980, -1129, -1534, -2151, -2832, -3362, -3524, -3185, -2358, -1229, -122, 604, 680,
+    44, -1117, -2415, -3405, -3762, -3417, -2591, -1695, -1134, -1108, -1495, -1898, -1836, -1003, 530, 2279,
+    3501, 3505, 1957, -932, -4450, -7633, -9630, -10008, -8886, -6828, -4563, -2669, -1350, -415, 555, 1951,
+    3908, 6220, 8424, 10004, 10613, 10203, 9023, 7499, 6056, 4974, 4330, 4027, 3885, 3731, 3459, 3053,
+    2571, 2135, 1913, 2106, 2913, 4467, 6758, 9584, 12555, 15175, 16983, 17698, 17305, 16042, 14285, 12386,
+    10520, 8627, 6463, 3738, 274, -3876, -8409, -12854, -16711, -19594, -21321, -21931, -21629, -20698, -19411, -17980,
+    -16532, -15126, -13779, -12501, -11319, -10297, -9538, -9171, -9311, -10016, -11240, -12806, -14431, -15780, -16561, -16607,
+    -15936, -14747, -13367, -12160, -11427, -11336, -11888, -12925, -14169, -15269, -15865, -15632, -14340, -11895, -8370, -4007,
+    804, 5591, 9870, 13220, 15336, 16045, 15305, 13179, 9818, 5446, 353, -5112, -10561, -15592, -19829, -22964,
+    -24782, -25195, -24250, -22143, -19204, -15868, -12611, -9852, -7858, -6674, -6114, -5835, -5473, -4793, -3804, -2774,
+    -2145, -2372, -3740, -6253, -9608, -13280, -16676, -19288, -20791, -21076, -20200, -18307, -15556, -12075, -7953, -3257,
+  },
+  { // 16 harmonics
+    2423, 8350, 14144, 19458, 23975, 27446, 29705, 30687, 30437, 29095, 26886, 24094, 21030, 18003, 15288, 13103,
+    11592, 10815, 10749, 11302, 12327, 13643, 15061, 16402, 17518, 18304, 18701, 18701, 18334, 17663, 16769, 15735,
+    14641, 13548, 12498, 11510, 10587, 9717, 8883, 8068, 7261, 6463, 5687, 4953, 4290, 3727, 3289, 2993,
+    2841, 2822, 2909, 3067, 3253, 3425, 3542, 3578, 3514, 3350, 3098, 2780, 2428, 2075, 1751, 1482,
+    1282, 1155, 1097, 1091, 1116, 1147, 1161, 1135, 1057, 917, 714, 454, 149, -189, -541, -892,
+    -1224, -1524, -1778, -1977, -2112, -2179, -2178, -2114, -1994, -1834, -1652, -1472, -1319, -1216, -1183, -1233,
+    -1365, -1570, -1822, -2088, -2324, -2484, -2526, -2419, -2151, -1728, -1183, -571, 33, 543, 874, 950,
+    716, 152, -727, -1861, -3155, -4481, -5693, -6642, -7194, -7242, -6727, -5641, -4031, -2000, 307, 2714,
+    5034, 7090, 8728, 9840, 10369, 10315, 9733, 8725, 7426, 5987, 4562, 3287, 2272, 1591, 1280, 1342,
+    1748, 2451, 3394, 4518, 5772, 7111, 8499, 9903, 11287, 12605, 13794, 14773, 15444, 15695, 15414, 14502,
+    12888, 10543, 7497, 3839, -277, -4645, -9018, -13134, -16738, -19611, -21592, -22598, -22633, -21791, -20241, -18214,
+    -15971, -13778, -11873, -10441, -9595, -9364, -9697, -10475, -11527, -12661, -13693, -14469, -14892, -14928, -14617, -14056,
+    -13386, -12766, -12345, -12234, -12486, -13079, -13916, -14833, -15615, -16029, -15854, -14911, -13100, -10414, -6950, -2909,
+    1421, 5696, 9544, 12613, 14603, 15301, 14606, 12539, 9244, 4968, 40, -5164, -10260, -14888, -18752, -21632,
+    -23410, -24062, -23659, -22342, -20309, -17784, -14996, -12161, -9463, -7051, -5030, -3471, -2414, -1875, -1855, -2341,
+    -3310, -4728, -6538, -8664, -10996, -13392, -15679, -17660, -19125, -19868, -19709, -18515, -16219, -12834, -8461, -3287,
+  },
+  { // 8 harmonics
+    5536, 7271, 8957, 10580, 12123, 13571, 14912, 16135, 17231, 18192, 19013, 19692, 20226, 20619, 20871, 20988,
+    20977, 20845, 20602, 20257, 19822, 19307, 18726, 18089, 17409, 16696, 15962, 15217, 14470, 13730, 13003, 12297,
+    11615, 10962, 10341, 9754, 9201, 8683, 8198, 7746, 7324, 6930, 6561, 6215, 5889, 5580, 5285, 5003,
+    4730, 4466, 4209, 3957, 3711, 3470, 3234, 3003, 2778, 2559, 2347, 2142, 1945, 1758, 1580, 1412,
+    1253, 1104, 965, 834, 712, 597, 489, 385, 285, 188, 92, -5, -102, -201, -302, -407,
+    -515, -626, -741, -857, -975, -1094, -1212, -1328, -1440, -1547, -1648, -1740, -1824, -1897, -1959, -2009,
+    -2047, -2073, -2087, -2089, -2081, -2063, -2037, -2004, -1966, -1923, -1879, -1834, -1789, -1745, -1704, -1664,
+    -1627, -1592, -1556, -1520, -1481, -1435, -1381, -1315, -1234, -1133, -1009, -858, -676, -461, -208, 84,
+    418, 794, 1212, 1672, 2172, 2709, 3280, 3878, 4499, 5134, 5777, 6417, 7046, 7654, 8230, 8763,
+    9242, 9658, 9999, 10257, 10423, 10489, 10448, 10295, 10027, 9641, 9136, 8514, 7777, 6930, 5978, 4931,
+    3796, 2584, 1308, -21, -1389, -2782, -4185, -5583, -6963, -8310, -9611, -10852, -12021, -13109, -14104, -14998,
+    -15786, -16460, -17018, -17456, -17774, -17972, -18053, -18019, -17875, -17627, -17281, -16844, -16324, -15730, -15072, -14357,
+    -13596, -12798, -11973, -11129, -10276, -9423, -8579, -7750, -6947, -6174, -5441, -4753, -4116, -3536, -3018, -2568,
+    -2189, -1885, -1660, -1515, -1454, -1478, -1587, -1781, -2059, -2419, -2858, -3373, -3957, -4607, -5313, -6068,
+    -6863, -7687, -8530, -9379, -10221, -11043, -11832, -12573, -13254, -13859, -14377, -14795, -15100, -15283, -15335, -15247,
+    -15014, -14633, -14100, -13417, -12584, -11608, -10493, -9250, -7887, -6418, -4856, -3216, -1516, 227, 1996, 3772,
+  },
+  { // 4 harmonics
+    2823, 4069, 5320, 6568, 7806, 9026, 10219, 11378, 12495, 13562, 14574, 15524, 16405, 17213, 17942, 18588,
+    19147, 19617, 19996, 20280, 20471, 20567, 20570, 20481, 20301, 20034, 19682, 19250, 18743, 18165, 17522, 16820,
+    16065, 15264, 14424, 13552, 12656, 11742, 10817, 9890, 8967, 8055, 7160, 6289, 5448, 4642, 3876, 3156,
+    2484, 1864, 1300, 792, 344, -45, -373, -641, -850, -1002, -1098, -1141, -1134, -1080, -984, -850,
+    -682, -486, -265, -27, 225, 485, 747, 1006, 1258, 1496, 1717, 1917, 2091, 2235, 2347, 2423,
+    2462, 2462, 2422, 2340, 2218, 2055, 1852, 1612, 1336, 1026, 687, 320, -70, -478, -900, -1332,
+    -1768, -2203, -2632, -3050, -3451, -3830, -4182, -4503, -4787, -5030, -5229, -5380, -5479, -5523, -5512, -5443,
+    -5315, -5127, -4881, -4576, -4213, -3796, -3325, -2806, -2240, -1632, -987, -310, 393, 1118, 1857, 2604,
+    3353, 4097, 4829, 5542, 6230, 6887, 7504, 8078, 8601, 9068, 9475, 9815, 10087, 10284, 10406, 10449,
+    10412, 10293, 10092, 9810, 9448, 9006, 8488, 7897, 7236, 6509, 5720, 4877, 3983, 3045, 2070, 1065,
+    36, -1009, -2062, -3117, -4165, -5200, -6213, -7199, -8150, -9061, -9924, -10734, -11486, -12176, -12800, -13353,
+    -13834, -14241, -14571, -14824, -15000, -15099, -15124, -15075, -14956, -14769, -14519, -14210, -13846, -13433, -12976, -12482,
+    -11956, -11405, -10836, -10255, -9669, -9085, -8509, -7948, -7408, -6893, -6411, -5966, -5562, -5203, -4894, -4636,
+    -4433, -4285, -4194, -4160, -4183, -4262, -4395, -4579, -4813, -5091, -5411, -5767, -6155, -6569, -7003, -7451,
+    -7907, -8363, -8813, -9251, -9668, -10060, -10418, -10737, -11011, -11233, -11398, -11502, -11539, -11507, -11401, -11219,
+    -10959, -10619, -10199, -9699, -9120, -8463, -7730, -6924, -6049, -5109, -4109, -3054, -1950, -803, 380, 1591,
+  },
+  { // 2 harmonics
+    6315, 6790, 7252, 7701, 8134, 8552, 8954, 9339, 9706, 10055, 10386, 10697, 10988, 11260, 11510, 11740,
+    11949, 12136, 12302, 12446, 12567, 12667, 12745, 12801, 12835, 12848, 12838, 12808, 12756, 12684, 12591, 12478,
+    12346, 12194, 12024, 11836, 11631, 11409, 11171, 10917, 10648, 10366, 10071, 9763, 9444, 9114, 8774, 8426,
+    8069, 7705, 7335, 6960, 6581, 6198, 5813, 5426, 5039, 4652, 4267, 3883, 3503, 3126, 2755, 2389,
+    2029, 1677, 1333, 998, 672, 356, 51, -242, -523, -792, -1047, -1289, -1517, -1731, -1929, -2113,
+    -2281, -2433, -2570, -2691, -2795, -2884, -2957, -3013, -3054, -3078, -3087, -3081, -3059, -3023, -2972, -2906,
+    -2827, -2734, -2629, -2511, -2382, -2241, -2090, -1929, -1758, -1579, -1393, -1199, -998, -793, -582, -367,
+    -150, 70, 292, 514, 736, 957, 1176, 1392, 1605, 1813, 2016, 2213, 2404, 2587, 2761, 2927,
+    3083, 3229, 3364, 3487, 3597, 3695, 3780, 3851, 3908, 3950, 3977, 3989, 3984, 3964, 3928, 3876,
+    3807, 3721, 3619, 3501, 3366, 3214, 3046, 2862, 2662, 2447, 2216, 1971, 1710, 1436, 1148, 847,
+    533, 207, -130, -477, -835, -1202, -1577, -1960, -2350, -2747, -3148, -3554, -3963, -4375, -4788, -5202,
+    -5616, -6029, -6440, -6848, -7251, -7650, -8043, -8429, -8807, -9176, -9536, -9885, -10223, -10549, -10862, -11161,
+    -11445, -11714, -11967, -12202, -12421, -12621, -12803, -12966, -13108, -13231, -13333, -13414, -13473, -13511, -13527, -13521,
+    -13493, -13442, -13369, -13273, -13155, -13015, -12853, -12668, -12462, -12234, -11985, -11715, -11425, -11115, -10785, -10437,
+    -10070, -9685, -9283, -8866, -8432, -7984, -7521, -7045, -6557, -6058, -5548, -5028, -4500, -3964, -3422, -2873,
+    -2321, -1764, -1205, -644, -83, 477, 1036, 1593, 2145, 2693, 3236, 3771, 4299, 4818, 5328, 5827,
+  },
+  { // 1 harmonics
+    1611, 1776, 1940, 2103, 2264, 2424, 2582, 2739, 2895, 3048, 3200, 3350, 3497, 3643, 3787, 3928,
+    4067, 4203, 4337, 4468, 4596, 4722, 4845, 4965, 5082, 5196, 5307, 5414, 5519, 5620, 5717, 5811,
+    5902, 5989, 6073, 6152, 6229, 6301, 6369, 6434, 6495, 6552, 6605, 6654, 6699, 6740, 6777, 6810,
+    6838, 6863, 6883, 6900, 6912, 6920, 6923, 6923, 6918, 6910, 6897, 6880, 6859, 6833, 6804, 6770,
+    6733, 6691, 6645, 6596, 6542, 6484, 6423, 6357, 6288, 6215, 6138, 6058, 5974, 5886, 5795, 5700,
+    5602, 5500, 5395, 5287, 5176, 5061, 4944, 4823, 4700, 4573, 4444, 4313, 4178, 4042, 3902, 3761,
+    3617, 3471, 3323, 3173, 3021, 2867, 2711, 2554, 2395, 2235, 2073, 1910, 1746, 1581, 1415, 1249,
+    1081, 913, 744, 575, 405, 235, 65, -105, -275, -445, -614, -783, -952, -1120, -1288, -1454,
+    -1620, -1785, -1949, -2111, -2273, -2433, -2591, -2748, -2904, -3057, -3209, -3359, -3506, -3652, -3795, -3937,
+    -4075, -4212, -4346, -4477, -4605, -4731, -4854, -4974, -5091, -5205, -5316, -5423, -5527, -5628, -5726, -5820,
+    -5911, -5998, -6081, -6161, -6237, -6310, -6378, -6443, -6504, -6561, -6614, -6663, -6708, -6749, -6786, -6818,
+    -6847, -6872, -6892, -6908, -6921, -6928, -6932, -6932, -6927, -6919, -6906, -6889, -6868, -6842, -6813, -6779,
+    -6742, -6700, -6654, -6604, -6551, -6493, -6432, -6366, -6297, -6224, -6147, -6067, -5982, -5895, -5803, -5709,
+    -5610, -5509, -5404, -5296, -5184, -5070, -4952, -4832, -4708, -4582, -4453, -4322, -4187, -4050, -3911, -3770,
+    -3626, -3480, -3332, -3181, -3029, -2876, -2720, -2563, -2404, -2244, -2082, -1919, -1755, -1590, -1424, -1257,
+    -1090, -922, -753, -584, -414, -244, -74, 96, 266, 436, 605, 775, 943, 1111, 1279, 1446,
+  },
+};
+
+extern const int16_t waveform_dbass_0015_mipmaps[WAVE_MIPMAPS][256] PROGMEM = {
+  { // 64 harmonics
+    532, 1279, 1260, 1137, 1475, 2126, 2744, 3361, 4130, 4929, 5619, 6403, 7478, 8498, 8826, 8363,
+    7829, 8046, 9102, 10363, 11231, 11747, 12367, 13275, 14153, 14624, 14704, 14678, 14747, 15004, 15556, 16389,
+    17210, 17756, 18182, 18838, 19676, 20230, 20206, 19789, 19302, 18905, 18697, 18712, 18670, 18115, 17049, 16145,
+    15992, 16348, 16450, 15956, 15275, 15019, 15388, 16110, 16762, 17081, 17109, 17088, 17221, 17542, 17995, 18546,
+    19175, 19904, 20861, 22148, 23577, 24737, 25453, 26018, 26794, 27771, 28676, 29370, 29913, 30365, 30786, 31339,
+    32075, 32667, 32656, 32009, 31176, 30509, 29908, 29143, 28290, 27611, 27188, 26904, 26696, 26598, 26558, 26452,
+    26319, 26392, 26789, 27301, 27584, 27492, 27088, 26421, 25406, 23943, 22030, 19719, 17074, 14204, 11286, 8475,
+    5834, 3386, 1207, -597, -1982, -3003, -3774, -4413, -4989, -5493, -5886, -6225, -6702, -7507, -8674, -10091,
+    -11635, -13227, -14795, -16271, -17647, -18939, -20088, -20960, -21479, -21725, -21849, -21936, -21978, -21946, -21842, -21692,
+    -21526, -21387, -21298, -21236, -21138, -20991, -20896, -21017, -21421, -21998, -22541, -22889, -22977, -22803, -22392, -21781,
+    -20985, -20007, -18906, -17824, -16870, -16002, -15122, -14261, -13569, -13114, -12812, -12573, -12421, -12395, -12448, -12512,
+    -12580, -12638, -12591, -12328, -11832, -11174, -10433, -9699, -9085, -8670, -8441, -8354, -8436, -8734, -9200, -9700,
+    -10145, -10580, -11104, -11721, -12316, -12772, -13110, -13446, -13821, -14137, -14296, -14317, -14255, -14074, -13745, -13394,
+    -13222, -13302, -13566, -13970, -14537, -15240, -15979, -16649, -17162, -17451, -17585, -17785, -18150, -18452, -18430, -18209,
+    -18125, -18221, -18246, -18176, -18291, -18639, -18848, -18714, -18579, -18844, -19390, -19817, -20023, -20206, -20434, -20532,
+    -20333, -19764, -18786, -17465, -16030, -14671, -13356, -11984, -10526, -8896, -6963, -4931, -3376, -2547, -1896, -792,
+  },
+  { // 32 harmonics
+    196, 749, 1184, 1527, 1820, 2133, 2548, 3139, 3936, 4897, 5919, 6858, 7586, 8039, 8240, 8298,
+    8370, 8605, 9096, 9853, 10800, 11814, 12759, 13527, 14070, 14399, 14578, 14701, 14865, 15149, 15599, 16215,
+    16956, 17749, 18506, 19143, 19602, 19857, 19914, 19807, 19578, 19268, 18909, 18519, 18111, 17693, 17271, 16854,
+    16454, 16089, 15781, 15564, 15469, 15520, 15720, 16040, 16422, 16794, 17095, 17304, 17448, 17605, 17876, 18347,
+    19062, 20004, 21104, 22267, 23402, 24453, 25400, 26255, 27043, 27785, 28491, 29167, 29814, 30437, 31034, 31584,
+    32039, 32324, 32360, 32092, 31523, 30721, 29809, 28925, 28181, 27628, 27253, 26995, 26787, 26592, 26423, 26328,
+    26362, 26551, 26862, 27206, 27457, 27485, 27187, 26499, 25397, 23881, 21969, 19692, 17102, 14283, 11354, 8458,
+    5736, 3300, 1216, -505, -1892, -2991, -3853, -4515, -5019, -5414, -5776, -6199, -6781, -7601, -8693, -10037,
+    -11565, -13185, -14802, -16338, -17738, -18969, -20006, -20832, -21431, -21806, -21980, -22002, -21933, -21835, -21747, -21678,
+    -21610, -21512, -21365, -21179, -21001, -20896, -20930, -21139, -21512, -21986, -22459, -22818, -22968, -22849, -22447, -21793,
+    -20944, -19968, -18930, -17886, -16874, -15925, -15061, -14301, -13659, -13148, -12770, -12525, -12403, -12386, -12448, -12548,
+    -12636, -12655, -12547, -12270, -11810, -11190, -10471, -9744, -9104, -8631, -8374, -8337, -8492, -8790, -9184, -9635,
+    -10122, -10637, -11169, -11707, -12230, -12717, -13153, -13531, -13847, -14095, -14259, -14316, -14246, -14049, -13764, -13468,
+    -13263, -13246, -13475, -13946, -14595, -15318, -16011, -16599, -17059, -17409, -17688, -17926, -18127, -18274, -18342, -18328,
+    -18258, -18184, -18162, -18221, -18355, -18522, -18674, -18784, -18870, -18986, -19195, -19526, -19949, -20365, -20639, -20640,
+    -20292, -19594, -18611, -17442, -16170, -14839, -13443, -11953, -10350, -8654, -6928, -5263, -3750, -2446, -1368, -499,
+  },
+  { // 16 harmonics
+    -138, 522, 1113, 1659, 2183, 2700, 3222, 3756, 4304, 4865, 5439, 6020, 6607, 7196, 7785, 8372,
+    8956, 9534, 10104, 10663, 11210, 11741, 12256, 12755, 13242, 13720, 14197, 14680, 15173, 15684, 16211, 16753,
+    17301, 17840, 18351, 18814, 19202, 19495, 19674, 19725, 19644, 19435, 19113, 18699, 18224, 17718, 17217, 16752,
+    16350, 16031, 15806, 15678, 15643, 15690, 15807, 15980, 16196, 16447, 16731, 17049, 17410, 17825, 18306, 18865,
+    19511, 20248, 21072, 21976, 22943, 23954, 24984, 26008, 27002, 27943, 28811, 29590, 30267, 30832, 31279, 31601,
+    31792, 31848, 31766, 31547, 31195, 30721, 30142, 29486, 28787, 28087, 27430, 26863, 26425, 26149, 26049, 26123,
+    26347, 26676, 27045, 27373, 27571, 27549, 27223, 26526, 25415, 23874, 21920, 19603, 16997, 14202, 11330, 8496,
+    5810, 3366, 1233, -548, -1968, -3051, -3845, -4420, -4862, -5257, -5690, -6231, -6932, -7824, -8913, -10181,
+    -11594, -13099, -14636, -16143, -17561, -18836, -19929, -20813, -21479, -21927, -22175, -22249, -22183, -22015, -21786, -21534,
+    -21296, -21103, -20977, -20936, -20986, -21124, -21337, -21605, -21899, -22183, -22418, -22567, -22590, -22459, -22152, -21660,
+    -20988, -20155, -19195, -18150, -17074, -16022, -15046, -14193, -13498, -12979, -12641, -12467, -12427, -12480, -12574, -12660,
+    -12687, -12619, -12430, -12110, -11669, -11131, -10533, -9924, -9354, -8872, -8523, -8337, -8333, -8512, -8862, -9355,
+    -9956, -10619, -11300, -11954, -12546, -13046, -13436, -13710, -13871, -13935, -13921, -13855, -13765, -13679, -13622, -13616,
+    -13678, -13817, -14039, -14342, -14719, -15156, -15637, -16142, -16647, -17130, -17567, -17940, -18232, -18436, -18548, -18576,
+    -18535, -18445, -18334, -18233, -18170, -18173, -18260, -18441, -18712, -19057, -19447, -19842, -20193, -20449, -20557, -20472,
+    -20157, -19590, -18765, -17692, -16398, -14922, -13316, -11636, -9940, -8281, -6706, -5250, -3937, -2776, -1765, -892,
+  },
+  { // 8 harmonics
+    -681, 394, 1390, 2301, 3127, 3865, 4520, 5095, 5598, 6039, 6427, 6775, 7095, 7402, 7707, 8024,
+    8363, 8735, 9146, 9604, 10112, 10670, 11277, 11928, 12618, 13337, 14075, 14819, 15557, 16273, 16954, 17586,
+    18155, 18651, 19062, 19381, 19603, 19724, 19745, 19668, 19499, 19247, 18923, 18539, 18110, 17655, 17188, 16729,
+    16295, 15904, 15570, 15310, 15134, 15053, 15076, 15205, 15444, 15791, 16242, 16792, 17430, 18145, 18926, 19758,
+    20627, 21516, 22410, 23296, 24160, 24988, 25770, 26497, 27161, 27759, 28286, 28742, 29128, 29447, 29702, 29898,
+    30042, 30140, 30197, 30220, 30214, 30184, 30131, 30059, 29966, 29853, 29715, 29548, 29347, 29104, 28811, 28460,
+    28043, 27550, 26973, 26306, 25541, 24675, 23703, 22624, 21440, 20153, 18767, 17291, 15731, 14100, 12409, 10671,
+    8900, 7111, 5319, 3537, 1780, 62, -1607, -3215, -4754, -6217, -7598, -8894, -10104, -11228, -12267, -13224,
+    -14105, -14915, -15659, -16344, -16976, -17562, -18107, -18618, -19097, -19549, -19976, -20380, -20760, -21116, -21446, -21748,
+    -22017, -22252, -22447, -22598, -22702, -22755, -22753, -22696, -22580, -22406, -22173, -21884, -21540, -21145, -20702, -20218,
+    -19697, -19146, -18571, -17979, -17377, -16772, -16169, -15575, -14996, -14436, -13900, -13391, -12912, -12466, -12055, -11679,
+    -11340, -11037, -10771, -10541, -10347, -10188, -10063, -9972, -9914, -9888, -9893, -9930, -9996, -10091, -10214, -10364,
+    -10539, -10738, -10959, -11199, -11457, -11729, -12012, -12303, -12599, -12897, -13192, -13483, -13766, -14039, -14300, -14547,
+    -14781, -15000, -15206, -15400, -15583, -15758, -15929, -16098, -16270, -16446, -16631, -16828, -17039, -17264, -17505, -17762,
+    -18031, -18310, -18596, -18881, -19159, -19421, -19660, -19865, -20025, -20130, -20170, -20135, -20015, -19803, -19491, -19075,
+    -18551, -17918, -17177, -16332, -15388, -14353, -13236, -12051, -10809, -9526, -8217, -6897, -5583, -4291, -3034, -1827,
+  },
+  { // 4 harmonics
+    -3562, -2568, -1569, -569, 428, 1418, 2399, 3367, 4319, 5250, 6159, 7041, 7895, 8718, 9507, 10260,
+    10974, 11650, 12284, 12875, 13424, 13929, 14390, 14807, 15181, 15512, 15800, 16049, 16258, 16429, 16566, 16670,
+    16743, 16789, 16810, 16810, 16791, 16758, 16713, 16661, 16605, 16547, 16493, 16445, 16407, 16381, 16372, 16382,
+    16414, 16470, 16553, 16665, 16807, 16980, 17187, 17428, 17703, 18012, 18355, 18731, 19140, 19580, 20049, 20545,
+    21066, 21609, 22171, 22748, 23338, 23937, 24539, 25142, 25741, 26331, 26908, 27467, 28004, 28513, 28991, 29432,
+    29833, 30188, 30494, 30746, 30942, 31077, 31149, 31154, 31090, 30955, 30746, 30463, 30105, 29670, 29158, 28570,
+    27906, 27167, 26354, 25470, 24516, 23496, 22411, 21265, 20062, 18806, 17501, 16151, 14761, 13336, 11880, 10399,
+    8899, 7384, 5861, 4333, 2808, 1289, -217, -1706, -3172, -4611, -6018, -7388, -8718, -10003, -11240, -12426,
+    -13557, -14630, -15644, -16595, -17483, -18305, -19062, -19751, -20373, -20928, -21416, -21837, -22192, -22482, -22710, -22876,
+    -22982, -23031, -23025, -22966, -22857, -22702, -22502, -22261, -21983, -21670, -21325, -20953, -20556, -20137, -19699, -19247,
+    -18783, -18310, -17831, -17349, -16867, -16387, -15912, -15445, -14987, -14541, -14108, -13692, -13292, -12912, -12552, -12213,
+    -11898, -11605, -11338, -11095, -10879, -10689, -10525, -10389, -10280, -10197, -10142, -10113, -10111, -10136, -10185, -10261,
+    -10360, -10484, -10630, -10799, -10990, -11200, -11430, -11678, -11943, -12224, -12518, -12826, -13145, -13474, -13811, -14155,
+    -14503, -14855, -15207, -15559, -15907, -16251, -16588, -16916, -17233, -17537, -17825, -18096, -18347, -18576, -18781, -18960,
+    -19110, -19231, -19319, -19374, -19393, -19374, -19317, -19220, -19082, -18901, -18677, -18408, -18096, -17738, -17335, -16888,
+    -16396, -15860, -15280, -14658, -13995, -13293, -12552, -11775, -10964, -10122, -9250, -8351, -7429, -6486, -5525, -4549,
+  },
+  { // 2 harmonics
+    -6446, -6020, -5577, -5118, -4643, -4151, -3644, -3121, -2583, -2029, -1461, -879, -282, 327, 950, 1584,
+    2231, 2888, 3556, 4234, 4920, 5614, 6316, 7024, 7738, 8457, 9179, 9904, 10631, 11359, 12086, 12813,
+    13537, 14259, 14975, 15687, 16392, 17090, 17778, 18458, 19126, 19783, 20427, 21057, 21673, 22272, 22854, 23419,
+    23964, 24490, 24995, 25478, 25939, 26376, 26789, 27178, 27540, 27877, 28186, 28468, 28722, 28948, 29144, 29310,
+    29447, 29553, 29629, 29674, 29688, 29670, 29622, 29542, 29431, 29289, 29116, 28912, 28677, 28412, 28117, 27792,
+    27437, 27054, 26642, 26203, 25737, 25244, 24725, 24181, 23612, 23021, 22406, 21770, 21113, 20435, 19739, 19025,
+    18294, 17547, 16786, 16010, 15222, 14422, 13612, 12793, 11966, 11132, 10292, 9448, 8600, 7750, 6899, 6048,
+    5198, 4351, 3506, 2667, 1833, 1006, 186, -625, -1426, -2217, -2996, -3763, -4516, -5255, -5980, -6688,
+    -7381, -8056, -8714, -9353, -9974, -10575, -11156, -11718, -12258, -12778, -13277, -13754, -14210, -14644, -15056, -15446,
+    -15814, -16160, -16484, -16787, -17068, -17328, -17567, -17785, -17982, -18159, -18316, -18454, -18573, -18674, -18756, -18822,
+    -18870, -18902, -18918, -18919, -18906, -18879, -18839, -18787, -18722, -18647, -18562, -18467, -18363, -18251, -18131, -18005,
+    -17872, -17734, -17592, -17445, -17296, -17143, -16988, -16832, -16675, -16518, -16361, -16204, -16049, -15895, -15744, -15595,
+    -15449, -15306, -15167, -15032, -14900, -14773, -14651, -14533, -14419, -14311, -14207, -14108, -14014, -13925, -13840, -13759,
+    -13683, -13611, -13543, -13479, -13417, -13359, -13303, -13249, -13198, -13147, -13098, -13049, -12999, -12949, -12898, -12846,
+    -12791, -12733, -12672, -12607, -12537, -12462, -12381, -12294, -12199, -12097, -11987, -11868, -11739, -11601, -11451, -11291,
+    -11119, -10935, -10738, -10528, -10305, -10068, -9816, -9550, -9268, -8971, -8659, -8331, -7986, -7626, -7249, -6856,
+  },
+  { // 1 harmonics
+    510, 1061, 1611, 2160, 2708, 3255, 3799, 4341, 4881, 5417, 5951, 6480, 7006, 7528, 8045, 8558,
+    9065, 9567, 10063, 10553, 11037, 11514, 11984, 12447, 12903, 13351, 13790, 14222, 14645, 15059, 15464, 15860,
+    16246, 16623, 16989, 17346, 17692, 18027, 18352, 18665, 18967, 19258, 19537, 19805, 20060, 20304, 20535, 20754,
+    20961, 21155, 21336, 21504, 21660, 21802, 21931, 22048, 22151, 22240, 22316, 22379, 22428, 22464, 22487, 22495,
+    22491, 22472, 22441, 22395, 22337, 22265, 22179, 22080, 21968, 21843, 21704, 21553, 21388, 21211, 21021, 20818,
+    20603, 20375, 20136, 19884, 19620, 19344, 19057, 18758, 18448, 18127, 17795, 17452, 17099, 16735, 16362, 15978,
+    15585, 15183, 14771, 14351, 13922, 13485, 13039, 12586, 12125, 11657, 11182, 10701, 10212, 9718, 9218, 8712,
+    8201, 7685, 7165, 6640, 6112, 5579, 5044, 4505, 3964, 3420, 2874, 2327, 1778, 1228, 677, 126,
+    -425, -975, -1526, -2075, -2623, -3169, -3713, -4256, -4795, -5332, -5865, -6395, -6921, -7443, -7960, -8472,
+    -8980, -9481, -9978, -10468, -10951, -11429, -11899, -12362, -12817, -13265, -13705, -14136, -14559, -14974, -15379, -15775,
+    -16161, -16537, -16904, -17260, -17606, -17942, -18266, -18580, -18882, -19173, -19452, -19719, -19975, -20218, -20450, -20669,
+    -20875, -21069, -21250, -21419, -21574, -21717, -21846, -21962, -22065, -22155, -22231, -22294, -22343, -22379, -22401, -22410,
+    -22405, -22387, -22355, -22310, -22251, -22179, -22094, -21995, -21883, -21757, -21619, -21467, -21303, -21126, -20936, -20733,
+    -20518, -20290, -20050, -19798, -19534, -19259, -18971, -18672, -18362, -18041, -17709, -17366, -17013, -16650, -16276, -15893,
+    -15500, -15097, -14686, -14266, -13837, -13399, -12954, -12501, -12040, -11572, -11097, -10615, -10127, -9633, -9132, -8627,
+    -8116, -7600, -7080, -6555, -6026, -5494, -4958, -4420, -3878, -3334, -2789, -2241, -1692, -1142, -592, -41,
+  },
+};
+
+extern const int16_t waveform_ebass_0037_mipmaps[WAVE_MIPMAPS][256] PROGMEM = {
+  { // 64 harmonics
+    482, 2420, 4376, 6325, 8225, 10053, 11816, 13513, 15114, 16584, 17922, 19164, 20351, 21498, 22596, 23640,
+    24637, 25613, 26592, 27570, 28519, 29400, 30187, 30876, 31465, 31948, 32314, 32566, 32712, 32754, 32692, 32537,
+    32299, 31968, 31527, 30981, 30359, 29654, 28812, 27789, 26611, 25344, 24030, 22667, 21246, 19751, 18151, 16433,
+    14647, 12882, 11179, 9515, 7871, 6288, 4814, 3445, 2147, 922, -198, -1203, -2122, -2973, -3747, -4427,
+    -5022, -5543, -5991, -6368, -6688, -6959, -7166, -7300, -7377, -7424, -7438, -7400, -7320, -7251, -7235, -7253,
+    -7248, -7181, -7048, -6862, -6631, -6366, -6073, -5747, -5392, -5038, -4709, -4380, -3996, -3542, -3070, -2647,
+    -2301, -2020, -1779, -1530, -1216, -811, -357, 80, 466, 798, 1063, 1235, 1329, 1398, 1493, 1625,
+    1782, 1953, 2129, 2296, 2434, 2520, 2522, 2415, 2205, 1944, 1705, 1558, 1551, 1694, 1943, 2226,
+    2468, 2621, 2669, 2634, 2569, 2525, 2514, 2519, 2527, 2524, 2474, 2327, 2069, 1740, 1403, 1102,
+    858, 687, 587, 529, 467, 368, 218, 21, -201, -409, -570, -683, -775, -881, -1038, -1284,
+    -1638, -2085, -2578, -3064, -3503, -3872, -4163, -4393, -4606, -4858, -5191, -5624, -6147, -6728, -7320, -7879,
+    -8387, -8853, -9297, -9738, -10211, -10762, -11419, -12159, -12925, -13668, -14357, -14975, -15509, -15969, -16392, -16816,
+    -17268, -17765, -18312, -18888, -19446, -19949, -20396, -20799, -21168, -21516, -21873, -22267, -22693, -23126, -23541, -23925,
+    -24260, -24523, -24706, -24825, -24910, -24990, -25074, -25147, -25194, -25220, -25233, -25213, -25137, -25032, -24974, -25005,
+    -25080, -25138, -25176, -25231, -25303, -25341, -25313, -25227, -25098, -24923, -24704, -24447, -24143, -23754, -23253, -22644,
+    -21940, -21136, -20222, -19188, -18033, -16771, -15446, -14101, -12732, -11301, -9794, -8244, -6668, -5029, -3281, -1429,
+  },
+  { // 32 harmonics
+    472, 2410, 4366, 6314, 8225, 10075, 11844, 13516, 15085, 16551, 17917, 19190, 20383, 21507, 22578, 23612,
+    24624, 25623, 26612, 27582, 28515, 29389, 30182, 30878, 31467, 31945, 32312, 32570, 32718, 32759, 32695, 32534,
+    32282, 31948, 31528, 31016, 30395, 29649, 28767, 27751, 26614, 25379, 24064, 22682, 21234, 19712, 18111, 16432,
+    14694, 12930, 11177, 9472, 7840, 6293, 4831, 3451, 2151, 934, -191, -1218, -2147, -2982, -3733, -4407,
+    -5011, -5543, -6001, -6386, -6700, -6951, -7147, -7292, -7387, -7432, -7430, -7390, -7333, -7278, -7242, -7226,
+    -7212, -7172, -7075, -6901, -6653, -6352, -6028, -5707, -5397, -5087, -4754, -4379, -3957, -3507, -3064, -2662,
+    -2323, -2040, -1783, -1512, -1190, -806, -375, 66, 472, 807, 1054, 1221, 1332, 1418, 1508, 1620,
+    1763, 1936, 2125, 2308, 2455, 2534, 2517, 2396, 2189, 1940, 1713, 1574, 1566, 1696, 1932, 2209,
+    2457, 2622, 2681, 2653, 2581, 2515, 2488, 2504, 2538, 2545, 2481, 2319, 2063, 1741, 1402, 1095,
+    855, 693, 596, 533, 465, 362, 210, 16, -197, -398, -563, -685, -781, -885, -1041, -1286,
+    -1635, -2076, -2570, -3066, -3513, -3879, -4161, -4386, -4601, -4857, -5193, -5628, -6150, -6727, -7316, -7879,
+    -8393, -8856, -9289, -9729, -10215, -10777, -11427, -12150, -12911, -13664, -14365, -14983, -15511, -15968, -16387, -16809,
+    -17266, -17772, -18320, -18886, -19438, -19948, -20402, -20801, -21164, -21514, -21878, -22268, -22688, -23122, -23546, -23933,
+    -24260, -24515, -24698, -24826, -24918, -24995, -25069, -25140, -25199, -25232, -25230, -25190, -25126, -25058, -25011, -25002,
+    -25037, -25107, -25193, -25270, -25320, -25329, -25293, -25213, -25093, -24932, -24725, -24462, -24135, -23731, -23240, -22651,
+    -21957, -21147, -20219, -19173, -18021, -16779, -15468, -14107, -12709, -11277, -9804, -8277, -6683, -5010, -3255, -1423,
+  },
+  { // 16 harmonics
+    542, 2452, 4375, 6290, 8174, 10006, 11768, 13442, 15020, 16498, 17876, 19162, 20366, 21502, 22584, 23625,
+    24635, 25621, 26582, 27516, 28414, 29264, 30050, 30758, 31374, 31885, 32283, 32563, 32723, 32767, 32699, 32525,
+    32252, 31884, 31425, 30875, 30232, 29492, 28648, 27696, 26631, 25450, 24155, 22751, 21248, 19659, 18004, 16302,
+    14576, 12849, 11141, 9472, 7858, 6313, 4846, 3462, 2166, 958, -160, -1191, -2134, -2991, -3762, -4448,
+    -5051, -5572, -6013, -6380, -6676, -6909, -7086, -7216, -7305, -7363, -7396, -7407, -7401, -7379, -7338, -7279,
+    -7197, -7088, -6950, -6780, -6576, -6337, -6065, -5762, -5432, -5080, -4711, -4329, -3941, -3550, -3161, -2775,
+    -2397, -2028, -1667, -1318, -978, -650, -332, -25, 269, 551, 819, 1072, 1306, 1520, 1711, 1876,
+    2013, 2119, 2194, 2236, 2248, 2232, 2194, 2140, 2077, 2015, 1962, 1927, 1915, 1933, 1981, 2058,
+    2160, 2278, 2403, 2523, 2624, 2696, 2729, 2714, 2649, 2532, 2369, 2167, 1936, 1688, 1436, 1192,
+    964, 761, 587, 440, 318, 214, 120, 27, -77, -199, -346, -523, -733, -976, -1248, -1546,
+    -1865, -2200, -2544, -2895, -3249, -3604, -3961, -4321, -4686, -5059, -5444, -5843, -6260, -6697, -7155, -7637,
+    -8143, -8672, -9223, -9796, -10387, -10994, -11613, -12240, -12870, -13498, -14118, -14725, -15316, -15886, -16433, -16957,
+    -17459, -17940, -18405, -18857, -19300, -19740, -20179, -20618, -21059, -21499, -21935, -22361, -22773, -23164, -23526, -23855,
+    -24146, -24397, -24605, -24773, -24902, -24996, -25059, -25098, -25117, -25121, -25115, -25105, -25092, -25080, -25073, -25072,
+    -25077, -25089, -25107, -25129, -25150, -25164, -25163, -25136, -25072, -24958, -24782, -24530, -24192, -23759, -23225, -22586,
+    -21843, -20999, -20061, -19033, -17926, -16744, -15494, -14180, -12804, -11364, -9860, -8289, -6649, -4941, -3168, -1337,
+  },
+  { // 8 harmonics
+    843, 2683, 4510, 6315, 8087, 9819, 11504, 13135, 14708, 16220, 17668, 19051, 20367, 21618, 22803, 23924,
+    24982, 25977, 26910, 27783, 28593, 29342, 30026, 30644, 31192, 31665, 32061, 32372, 32594, 32720, 32746, 32664,
+    32471, 32161, 31732, 31181, 30506, 29709, 28791, 27756, 26610, 25360, 24013, 22581, 21075, 19508, 17893, 16245,
+    14578, 12908, 11247, 9612, 8015, 6469, 4984, 3571, 2238, 992, -163, -1223, -2187, -3054, -3826, -4506,
+    -5099, -5608, -6039, -6399, -6694, -6931, -7116, -7255, -7353, -7416, -7448, -7452, -7431, -7388, -7324, -7239,
+    -7133, -7006, -6858, -6687, -6494, -6276, -6034, -5767, -5476, -5162, -4825, -4468, -4093, -3703, -3302, -2893,
+    -2480, -2068, -1661, -1264, -880, -513, -167, 155, 452, 721, 961, 1173, 1357, 1513, 1644, 1751,
+    1837, 1905, 1957, 1998, 2029, 2054, 2076, 2095, 2116, 2138, 2163, 2191, 2221, 2254, 2288, 2322,
+    2353, 2381, 2403, 2416, 2419, 2411, 2388, 2351, 2298, 2228, 2142, 2039, 1920, 1787, 1639, 1480,
+    1311, 1132, 947, 756, 562, 365, 166, -34, -234, -435, -637, -842, -1049, -1262, -1482, -1711,
+    -1950, -2202, -2470, -2754, -3057, -3380, -3725, -4091, -4481, -4892, -5326, -5781, -6257, -6751, -7263, -7789,
+    -8329, -8880, -9440, -10007, -10579, -11154, -11730, -12307, -12882, -13455, -14025, -14590, -15152, -15708, -16259, -16804,
+    -17342, -17873, -18396, -18910, -19414, -19907, -20386, -20851, -21298, -21728, -22136, -22523, -22885, -23221, -23531, -23812,
+    -24064, -24288, -24483, -24651, -24792, -24909, -25003, -25077, -25133, -25175, -25206, -25227, -25243, -25253, -25262, -25268,
+    -25273, -25275, -25273, -25265, -25246, -25212, -25158, -25078, -24964, -24808, -24604, -24342, -24015, -23614, -23133, -22565,
+    -21904, -21145, -20284, -19321, -18254, -17083, -15813, -14447, -12991, -11451, -9837, -8157, -6422, -4643, -2831, -999,
+  },
+  { // 4 harmonics
+    215, 1901, 3603, 5315, 7030, 8742, 10444, 12129, 13790, 15421, 17014, 18563, 20062, 21503, 22881, 24189,
+    25421, 26573, 27638, 28613, 29493, 30275, 30954, 31528, 31996, 32354, 32602, 32740, 32767, 32684, 32492, 32192,
+    31788, 31282, 30676, 29976, 29185, 28308, 27350, 26317, 25215, 24051, 22830, 21559, 20246, 18897, 17520, 16121,
+    14709, 13290, 11872, 10461, 9064, 7687, 6338, 5022, 3744, 2510, 1326, 194, -879, -1892, -2840, -3721,
+    -4533, -5274, -5943, -6539, -7062, -7512, -7890, -8197, -8434, -8604, -8708, -8750, -8732, -8658, -8530, -8354,
+    -8132, -7868, -7568, -7235, -6872, -6486, -6079, -5656, -5221, -4777, -4330, -3881, -3436, -2996, -2565, -2146,
+    -1741, -1351, -980, -629, -299, 10, 296, 558, 797, 1012, 1204, 1373, 1521, 1647, 1753, 1840,
+    1909, 1962, 2000, 2025, 2038, 2040, 2035, 2022, 2003, 1980, 1954, 1927, 1899, 1870, 1843, 1818,
+    1795, 1774, 1756, 1740, 1727, 1716, 1706, 1698, 1689, 1680, 1670, 1656, 1639, 1617, 1588, 1551,
+    1505, 1448, 1380, 1298, 1201, 1089, 960, 814, 648, 463, 257, 31, -217, -486, -777, -1090,
+    -1424, -1779, -2155, -2551, -2966, -3399, -3849, -4316, -4797, -5292, -5799, -6317, -6843, -7378, -7919, -8464,
+    -9012, -9562, -10112, -10660, -11206, -11748, -12285, -12816, -13340, -13856, -14364, -14862, -15350, -15829, -16297, -16755,
+    -17202, -17639, -18065, -18482, -18888, -19285, -19673, -20052, -20422, -20785, -21140, -21487, -21828, -22161, -22488, -22807,
+    -23120, -23425, -23722, -24011, -24291, -24561, -24819, -25065, -25298, -25514, -25714, -25894, -26052, -26187, -26296, -26377,
+    -26426, -26441, -26420, -26359, -26256, -26108, -25912, -25666, -25367, -25012, -24599, -24127, -23593, -22995, -22333, -21604,
+    -20809, -19946, -19016, -18019, -16955, -15826, -14632, -13377, -12061, -10688, -9261, -7783, -6259, -4692, -3088, -1450,
+  },
+  { // 2 harmonics
+    4877, 5921, 6947, 7955, 8942, 9907, 10847, 11762, 12649, 13507, 14335, 15131, 15893, 16620, 17312, 17967,
+    18584, 19162, 19701, 20199, 20655, 21070, 21442, 21772, 22059, 22302, 22502, 22659, 22772, 22842, 22869, 22854,
+    22796, 22697, 22557, 22377, 22157, 21898, 21602, 21270, 20901, 20499, 20063, 19596, 19098, 18572, 18018, 17438,
+    16834, 16207, 15559, 14892, 14208, 13508, 12794, 12068, 11331, 10587, 9836, 9080, 8322, 7562, 6804, 6048,
+    5296, 4551, 3814, 3086, 2370, 1667, 979, 306, -349, -985, -1600, -2194, -2765, -3312, -3834, -4330,
+    -4798, -5239, -5651, -6033, -6386, -6708, -6999, -7258, -7486, -7682, -7846, -7978, -8079, -8147, -8185, -8191,
+    -8166, -8112, -8027, -7914, -7773, -7605, -7410, -7190, -6945, -6677, -6387, -6076, -5746, -5397, -5032, -4651,
+    -4256, -3849, -3431, -3004, -2569, -2128, -1683, -1235, -786, -338, 108, 550, 987, 1416, 1836, 2246,
+    2643, 3027, 3396, 3748, 4081, 4396, 4689, 4960, 5208, 5431, 5629, 5800, 5943, 6058, 6143, 6198,
+    6222, 6214, 6175, 6103, 5999, 5861, 5691, 5487, 5250, 4979, 4676, 4340, 3972, 3572, 3141, 2679,
+    2187, 1666, 1116, 540, -64, -692, -1344, -2020, -2716, -3433, -4169, -4921, -5689, -6471, -7266, -8071,
+    -8885, -9706, -10533, -11363, -12194, -13026, -13855, -14680, -15500, -16311, -17113, -17903, -18680, -19442, -20186, -20911,
+    -21616, -22298, -22956, -23589, -24194, -24769, -25315, -25828, -26308, -26754, -27163, -27536, -27870, -28166, -28421, -28635,
+    -28807, -28937, -29024, -29068, -29068, -29023, -28934, -28800, -28622, -28399, -28132, -27820, -27465, -27067, -26625, -26142,
+    -25617, -25051, -24446, -23801, -23120, -22401, -21648, -20860, -20040, -19188, -18307, -17398, -16463, -15502, -14519, -13515,
+    -12492, -11451, -10395, -9325, -8244, -7153, -6055, -4952, -3846, -2738, -1631, -527, 572, 1664, 2747, 3818,
+  },
+  { // 1 harmonics
+    -1083, -753, -424, -96, 231, 556, 879, 1201, 1521, 1838, 2153, 2465, 2775, 3082, 3385, 3685,
+    3981, 4274, 4563, 4848, 5128, 5404, 5676, 5943, 6205, 6461, 6713, 6959, 7200, 7435, 7664, 7888,
+    8105, 8316, 8521, 8719, 8910, 9095, 9274, 9445, 9609, 9766, 9916, 10059, 10194, 10322, 10442, 10554,
+    10659, 10757, 10846, 10927, 11001, 11067, 11124, 11174, 11216, 11249, 11275, 11292, 11301, 11302, 11295, 11280,
+    11256, 11225, 11185, 11138, 11082, 11018, 10947, 10867, 10780, 10685, 10582, 10471, 10353, 10227, 10093, 9953,
+    9805, 9649, 9487, 9317, 9141, 8958, 8768, 8571, 8368, 8159, 7943, 7721, 7493, 7260, 7020, 6776,
+    6525, 6270, 6009, 5744, 5473, 5198, 4919, 4635, 4347, 4056, 3760, 3461, 3158, 2853, 2544, 2232,
+    1918, 1601, 1282, 961, 637, 313, -14, -341, -670, -1000, -1330, -1661, -1992, -2324, -2655, -2986,
+    -3317, -3647, -3976, -4304, -4630, -4956, -5279, -5601, -5920, -6238, -6553, -6865, -7175, -7481, -7785, -8085,
+    -8381, -8674, -8963, -9248, -9528, -9804, -10076, -10343, -10604, -10861, -11113, -11359, -11600, -11835, -12064, -12287,
+    -12505, -12716, -12920, -13119, -13310, -13495, -13673, -13845, -14009, -14166, -14316, -14458, -14594, -14721, -14842, -14954,
+    -15059, -15156, -15246, -15327, -15401, -15467, -15524, -15574, -15615, -15649, -15674, -15692, -15701, -15702, -15695, -15679,
+    -15656, -15625, -15585, -15537, -15482, -15418, -15347, -15267, -15180, -15084, -14981, -14871, -14752, -14627, -14493, -14352,
+    -14204, -14049, -13887, -13717, -13541, -13357, -13167, -12971, -12768, -12558, -12343, -12121, -11893, -11660, -11420, -11175,
+    -10925, -10670, -10409, -10143, -9873, -9598, -9319, -9035, -8747, -8455, -8160, -7861, -7558, -7252, -6944, -6632,
+    -6318, -6001, -5682, -5360, -5037, -4712, -4386, -4058, -3730, -3400, -3070, -2739, -2407, -2076, -1745, -1414,
+  },
+};
+
+extern const int16_t waveform_eguitar_0002_mipmaps[WAVE_MIPMAPS][256] PROGMEM = {
+  { // 64 harmonics
+    1692, 6385, 11759, 18434, 25505, 30730, 32767, 32576, 32115, 32223, 32417, 32279, 32085, 32112, 32173, 32066,
+    31938, 31950, 31980, 31895, 31801, 31814, 31836, 31756, 31654, 31630, 31615, 31527, 31430, 31400, 31376, 31289,
+    31197, 31163, 31134, 31050, 30965, 30933, 30901, 30817, 30733, 30699, 30666, 30583, 30501, 30466, 30434, 30357,
+    30281, 30244, 30202, 30119, 30044, 30013, 29975, 29893, 29816, 29782, 29744, 29665, 29590, 29556, 29517, 29437,
+    29365, 29333, 29294, 29214, 29143, 29114, 29074, 28992, 28918, 28887, 28847, 28767, 28697, 28669, 28629, 28548,
+    28478, 28450, 28409, 28327, 28258, 28230, 28189, 28108, 28043, 28020, 27979, 27896, 27835, 27814, 27765, 27672,
+    27609, 27596, 27555, 27462, 27397, 27379, 27325, 27219, 27153, 27137, 27074, 26956, 26888, 26876, 26804, 26674,
+    26613, 26596, 26481, 26344, 26374, 26323, 25548, 23828, 21681, 19570, 17270, 14412, 11159, 7797, 4086, -350,
+    -5319, -10454, -15967, -22096, -27887, -31592, -32605, -32192, -31927, -32115, -32196, -32004, -31889, -31961, -31969, -31834,
+    -31753, -31785, -31772, -31672, -31619, -31643, -31621, -31521, -31449, -31437, -31391, -31292, -31222, -31200, -31151, -31059,
+    -30993, -30966, -30914, -30827, -30764, -30734, -30680, -30592, -30527, -30494, -30443, -30363, -30299, -30262, -30209, -30132,
+    -30071, -30032, -29977, -29900, -29839, -29801, -29750, -29676, -29615, -29574, -29525, -29459, -29398, -29348, -29289, -29221,
+    -29167, -29125, -29069, -28998, -28940, -28896, -28843, -28776, -28718, -28672, -28616, -28549, -28496, -28455, -28402, -28334,
+    -28277, -28235, -28184, -28118, -28060, -28015, -27963, -27900, -27845, -27803, -27753, -27688, -27630, -27586, -27535, -27469,
+    -27412, -27371, -27322, -27258, -27197, -27149, -27094, -27027, -26963, -26909, -26848, -26780, -26718, -26658, -26586, -26511,
+    -26440, -26350, -26252, -26216, -26195, -25873, -24930, -23449, -21814, -20166, -18254, -15911, -13302, -10474, -7072, -2889,
+  },
+  { // 32 harmonics
+    1101, 6664, 12825, 19011, 24538, 28813, 31524, 32717, 32767, 32219, 31599, 31249, 31260, 31511, 31786, 31903,
+    31802, 31552, 31294, 31153, 31173, 31303, 31435, 31472, 31376, 31188, 30993, 30873, 30859, 30916, 30974, 30966,
+    30865, 30704, 30545, 30446, 30429, 30466, 30499, 30475, 30378, 30234, 30095, 30009, 29991, 30016, 30036, 30005,
+    29910, 29776, 29650, 29571, 29552, 29569, 29577, 29539, 29445, 29318, 29201, 29130, 29112, 29125, 29128, 29085,
+    28990, 28868, 28758, 28694, 28680, 28692, 28690, 28643, 28545, 28423, 28316, 28256, 28246, 28259, 28256, 28206,
+    28106, 27985, 27881, 27825, 27819, 27833, 27827, 27774, 27672, 27551, 27453, 27406, 27407, 27424, 27416, 27354,
+    27242, 27116, 27020, 26980, 26990, 27009, 26992, 26910, 26777, 26635, 26536, 26502, 26516, 26526, 26477, 26355,
+    26195, 26065, 26022, 26046, 26022, 25752, 25021, 23689, 21748, 19327, 16628, 13820, 10938, 7851, 4305, 52,
+    -5003, -10704, -16625, -22177, -26778, -30033, -31848, -32441, -32244, -31741, -31316, -31155, -31248, -31453, -31608, -31616,
+    -31477, -31273, -31107, -31043, -31081, -31165, -31220, -31194, -31084, -30934, -30801, -30726, -30714, -30733, -30737, -30693,
+    -30597, -30475, -30365, -30296, -30272, -30270, -30259, -30212, -30126, -30018, -29918, -29850, -29818, -29806, -29789, -29744,
+    -29665, -29567, -29473, -29404, -29366, -29348, -29329, -29287, -29215, -29124, -29035, -28966, -28925, -28903, -28880, -28838,
+    -28767, -28678, -28589, -28519, -28478, -28456, -28435, -28395, -28327, -28238, -28148, -28076, -28034, -28015, -27999, -27965,
+    -27900, -27811, -27718, -27644, -27601, -27583, -27571, -27541, -27478, -27387, -27291, -27215, -27172, -27158, -27152, -27124,
+    -27060, -26965, -26862, -26781, -26738, -26728, -26724, -26695, -26623, -26514, -26397, -26304, -26252, -26234, -26221, -26183,
+    -26107, -26004, -25894, -25775, -25593, -25238, -24566, -23461, -21884, -19901, -17655, -15292, -12864, -10271, -7266, -3547,
+  },
+  { // 16 harmonics
+    3698, 8478, 13164, 17589, 21598, 25067, 27908, 30076, 31572, 32441, 32767, 32659, 32244, 31653, 31009, 30414,
+    29946, 29650, 29542, 29606, 29806, 30090, 30397, 30674, 30873, 30963, 30934, 30791, 30557, 30266, 29958, 29673,
+    29445, 29296, 29236, 29261, 29354, 29488, 29633, 29757, 29833, 29844, 29781, 29649, 29461, 29241, 29015, 28809,
+    28646, 28542, 28502, 28522, 28590, 28685, 28783, 28861, 28898, 28882, 28806, 28676, 28503, 28308, 28112, 27937,
+    27802, 27720, 27693, 27718, 27782, 27866, 27949, 28010, 28030, 27998, 27912, 27776, 27604, 27413, 27227, 27064,
+    26944, 26877, 26865, 26902, 26976, 27065, 27149, 27205, 27217, 27174, 27073, 26922, 26736, 26536, 26345, 26186,
+    26077, 26027, 26038, 26100, 26195, 26301, 26390, 26438, 26427, 26349, 26204, 26006, 25779, 25551, 25351, 25204,
+    25120, 25095, 25102, 25094, 25001, 24735, 24201, 23299, 21939, 20050, 17589, 14545, 10951, 6875, 2424, -2266,
+    -7036, -11722, -16160, -20204, -23736, -26671, -28967, -30622, -31674, -32195, -32283, -32051, -31614, -31085, -30559, -30109,
+    -29786, -29611, -29582, -29677, -29858, -30083, -30304, -30484, -30593, -30614, -30546, -30399, -30193, -29955, -29716, -29502,
+    -29335, -29228, -29185, -29199, -29258, -29341, -29427, -29495, -29528, -29513, -29448, -29336, -29186, -29015, -28840, -28678,
+    -28546, -28453, -28404, -28398, -28425, -28473, -28527, -28569, -28587, -28570, -28513, -28417, -28288, -28139, -27982, -27835,
+    -27710, -27618, -27564, -27549, -27567, -27606, -27654, -27694, -27713, -27700, -27648, -27557, -27433, -27284, -27127, -26977,
+    -26847, -26752, -26698, -26685, -26710, -26760, -26822, -26878, -26911, -26907, -26859, -26764, -26628, -26462, -26284, -26111,
+    -25964, -25857, -25802, -25800, -25845, -25923, -26016, -26101, -26155, -26159, -26104, -25985, -25810, -25596, -25363, -25137,
+    -24938, -24777, -24652, -24541, -24404, -24178, -23785, -23136, -22136, -20698, -18751, -16248, -13176, -9561, -5469, -1004,
+  },
+  { // 8 harmonics
+    4182, 7160, 10093, 12946, 15689, 18290, 20723, 22965, 24996, 26800, 28367, 29690, 30769, 31606, 32209, 32591,
+    32767, 32757, 32582, 32267, 31837, 31320, 30742, 30128, 29505, 28894, 28318, 27794, 27337, 26959, 26667, 26467,
+    26360, 26342, 26408, 26550, 26757, 27017, 27314, 27635, 27964, 28286, 28586, 28852, 29072, 29236, 29339, 29374,
+    29341, 29239, 29073, 28847, 28569, 28250, 27899, 27529, 27153, 26784, 26433, 26112, 25832, 25601, 25427, 25313,
+    25262, 25275, 25348, 25477, 25654, 25872, 26120, 26386, 26657, 26922, 27167, 27381, 27553, 27673, 27734, 27730,
+    27659, 27520, 27314, 27048, 26727, 26362, 25964, 25546, 25122, 24708, 24317, 23966, 23667, 23433, 23274, 23198,
+    23211, 23313, 23504, 23778, 24127, 24538, 24996, 25483, 25976, 26454, 26890, 27259, 27535, 27690, 27701, 27543,
+    27196, 26642, 25865, 24856, 23608, 22120, 20394, 18438, 16265, 13893, 11342, 8638, 5809, 2887, -97, -3107,
+    -6108, -9066, -11947, -14718, -17351, -19818, -22096, -24165, -26011, -27623, -28995, -30125, -31018, -31680, -32124, -32364,
+    -32419, -32311, -32062, -31697, -31240, -30718, -30155, -29575, -28999, -28448, -27939, -27487, -27103, -26795, -26569, -26426,
+    -26365, -26382, -26470, -26621, -26824, -27067, -27337, -27621, -27905, -28177, -28425, -28639, -28809, -28928, -28992, -28996,
+    -28942, -28829, -28663, -28447, -28189, -27898, -27583, -27254, -26923, -26599, -26293, -26014, -25771, -25571, -25419, -25318,
+    -25271, -25277, -25334, -25439, -25584, -25763, -25968, -26188, -26414, -26635, -26840, -27020, -27166, -27268, -27322, -27321,
+    -27264, -27148, -26976, -26750, -26477, -26162, -25817, -25451, -25075, -24703, -24348, -24021, -23736, -23503, -23332, -23230,
+    -23205, -23257, -23389, -23596, -23873, -24211, -24598, -25019, -25456, -25889, -26296, -26655, -26941, -27129, -27197, -27120,
+    -26877, -26449, -25819, -24973, -23904, -22603, -21071, -19310, -17329, -15139, -12757, -10203, -7503, -4683, -1773, 1193,
+  },
+  { // 4 harmonics
+    3554, 5141, 6719, 8285, 9832, 11358, 12857, 14324, 15757, 17150, 18500, 19803, 21056, 22256, 23399, 24483,
+    25506, 26465, 27358, 28185, 28943, 29632, 30252, 30802, 31282, 31693, 32035, 32310, 32519, 32663, 32745, 32767,
+    32731, 32640, 32498, 32306, 32069, 31791, 31474, 31124, 30743, 30336, 29907, 29461, 29000, 28531, 28056, 27579,
+    27106, 26639, 26182, 25740, 25314, 24910, 24529, 24174, 23849, 23555, 23294, 23068, 22878, 22727, 22613, 22539,
+    22503, 22507, 22549, 22629, 22745, 22897, 23082, 23299, 23545, 23819, 24116, 24434, 24771, 25122, 25484, 25853,
+    26226, 26598, 26966, 27325, 27671, 28000, 28309, 28592, 28847, 29068, 29252, 29396, 29496, 29548, 29550, 29498,
+    29390, 29224, 28996, 28706, 28351, 27930, 27443, 26888, 26266, 25575, 24818, 23993, 23102, 22147, 21128, 20049,
+    18910, 17715, 16466, 15167, 13820, 12429, 10999, 9532, 8033, 6507, 4957, 3388, 1805, 212, -1385, -2982,
+    -4575, -6158, -7727, -9277, -10805, -12304, -13772, -15204, -16596, -17945, -19246, -20497, -21695, -22837, -23920, -24943,
+    -25902, -26797, -27627, -28389, -29084, -29712, -30271, -30762, -31186, -31544, -31836, -32065, -32231, -32336, -32384, -32375,
+    -32313, -32201, -32042, -31839, -31594, -31313, -30997, -30652, -30281, -29887, -29474, -29046, -28608, -28163, -27714, -27265,
+    -26821, -26384, -25957, -25545, -25149, -24774, -24421, -24092, -23791, -23519, -23278, -23069, -22894, -22753, -22648, -22578,
+    -22544, -22545, -22582, -22653, -22757, -22894, -23061, -23258, -23481, -23730, -24000, -24291, -24598, -24919, -25251, -25590,
+    -25933, -26276, -26616, -26950, -27272, -27581, -27871, -28139, -28381, -28594, -28774, -28918, -29022, -29083, -29098, -29064,
+    -28978, -28838, -28642, -28387, -28072, -27696, -27256, -26752, -26183, -25550, -24851, -24087, -23259, -22367, -21412, -20397,
+    -19322, -18190, -17002, -15763, -14473, -13137, -11757, -10338, -8883, -7396, -5880, -4341, -2783, -1209, 374, 1964,
+  },
+  { // 2 harmonics
+    2879, 3674, 4467, 5257, 6045, 6830, 7611, 8387, 9160, 9927, 10688, 11443, 12192, 12934, 13668, 14394,
+    15112, 15821, 16521, 17212, 17892, 18561, 19220, 19867, 20502, 21126, 21736, 22334, 22918, 23488, 24045, 24587,
+    25114, 25626, 26122, 26603, 27067, 27516, 27947, 28362, 28759, 29139, 29501, 29845, 30170, 30478, 30766, 31036,
+    31287, 31519, 31731, 31924, 32097, 32251, 32385, 32499, 32592, 32666, 32720, 32754, 32767, 32760, 32733, 32686,
+    32619, 32532, 32424, 32297, 32150, 31982, 31796, 31589, 31363, 31118, 30854, 30571, 30269, 29948, 29609, 29252,
+    28876, 28484, 28073, 27646, 27201, 26740, 26262, 25769, 25259, 24735, 24195, 23641, 23072, 22489, 21893, 21283,
+    20660, 20025, 19378, 18720, 18050, 17369, 16678, 15977, 15266, 14547, 13819, 13082, 12338, 11587, 10829, 10065,
+    9295, 8520, 7740, 6955, 6167, 5375, 4581, 3784, 2985, 2185, 1384, 582, -220, -1021, -1821, -2619,
+    -3416, -4210, -5001, -5788, -6572, -7351, -8126, -8895, -9659, -10416, -11167, -11910, -12646, -13374, -14094, -14805,
+    -15506, -16198, -16880, -17552, -18213, -18862, -19500, -20126, -20740, -21341, -21929, -22504, -23066, -23613, -24146, -24664,
+    -25168, -25656, -26129, -26586, -27028, -27453, -27862, -28254, -28629, -28988, -29329, -29652, -29958, -30246, -30516, -30768,
+    -31002, -31218, -31415, -31593, -31753, -31894, -32017, -32120, -32204, -32270, -32316, -32344, -32352, -32342, -32312, -32263,
+    -32195, -32109, -32003, -31879, -31736, -31574, -31394, -31195, -30978, -30742, -30488, -30217, -29928, -29621, -29296, -28954,
+    -28595, -28220, -27827, -27418, -26993, -26552, -26095, -25622, -25135, -24632, -24115, -23583, -23037, -22478, -21905, -21318,
+    -20720, -20108, -19485, -18849, -18202, -17545, -16876, -16198, -15509, -14811, -14104, -13388, -12664, -11932, -11192, -10446,
+    -9693, -8934, -8169, -7399, -6624, -5845, -5062, -4276, -3486, -2694, -1900, -1105, -308, 489, 1286, 2083,
+  },
+  { // 1 harmonics
+    3136, 3935, 4731, 5525, 6315, 7101, 7883, 8660, 9432, 10199, 10959, 11712, 12459, 13198, 13929, 14651,
+    15365, 16070, 16764, 17449, 18123, 18786, 19438, 20078, 20706, 21322, 21924, 22514, 23090, 23652, 24199, 24732,
+    25251, 25753, 26241, 26712, 27168, 27607, 28029, 28435, 28823, 29194, 29548, 29883, 30201, 30500, 30781, 31044,
+    31287, 31512, 31718, 31905, 32072, 32221, 32349, 32458, 32548, 32618, 32669, 32699, 32710, 32701, 32673, 32625,
+    32557, 32469, 32362, 32236, 32090, 31924, 31740, 31536, 31313, 31072, 30811, 30532, 30235, 29920, 29586, 29235,
+    28865, 28479, 28075, 27655, 27218, 26764, 26294, 25808, 25307, 24791, 24259, 23713, 23153, 22578, 21991, 21389,
+    20775, 20149, 19510, 18859, 18197, 17524, 16841, 16147, 15444, 14731, 14009, 13279, 12541, 11796, 11043, 10283,
+    9518, 8746, 7970, 7188, 6402, 5613, 4819, 4023, 3225, 2424, 1623, 820, 16, -787, -1590, -2392,
+    -3193, -3992, -4788, -5581, -6372, -7158, -7940, -8717, -9489, -10256, -11016, -11769, -12516, -13255, -13986, -14708,
+    -15422, -16126, -16821, -17506, -18180, -18843, -19495, -20135, -20763, -21379, -21981, -22571, -23147, -23708, -24256, -24789,
+    -25307, -25810, -26298, -26769, -27225, -27664, -28086, -28492, -28880, -29251, -29605, -29940, -30258, -30557, -30838, -31101,
+    -31344, -31569, -31775, -31962, -32129, -32277, -32406, -32515, -32605, -32675, -32725, -32756, -32767, -32758, -32730, -32682,
+    -32614, -32526, -32419, -32293, -32147, -31981, -31797, -31593, -31370, -31129, -30868, -30589, -30292, -29976, -29643, -29291,
+    -28922, -28536, -28132, -27712, -27274, -26821, -26351, -25865, -25364, -24848, -24316, -23770, -23210, -22635, -22047, -21446,
+    -20832, -20205, -19567, -18916, -18254, -17581, -16898, -16204, -15501, -14788, -14066, -13336, -12598, -11853, -11100, -10340,
+    -9575, -8803, -8027, -7245, -6459, -5669, -4876, -4080, -3282, -2481, -1679, -877, -73, 730, 1533, 2335,
+  },
+};
+
+extern const int16_t waveform_eorgan_0064_mipmaps[WAVE_MIPMAPS][256] PROGMEM = {
+  { // 64 harmonics
+    456, 2398, 4302, 6156, 7912, 9523, 10967, 12238, 13322, 14205, 14891, 15397, 15734, 15919, 15980, 15951,
+    15862, 15740, 15623, 15549, 15548, 15639, 15845, 16186, 16673, 17305, 18081, 18993, 20024, 21150, 22344, 23584,
+    24834, 26060, 27226, 28305, 29265, 30080, 30730, 31202, 31488, 31583, 31492, 31229, 30810, 30256, 29596, 28863,
+    28091, 27312, 26561, 25873, 25277, 24800, 24463, 24284, 24269, 24418, 24728, 25191, 25790, 26500, 27291, 28133,
+    28991, 29828, 30611, 31307, 31882, 32308, 32563, 32631, 32502, 32170, 31640, 30923, 30034, 28996, 27836, 26585,
+    25276, 23943, 22623, 21350, 20154, 19063, 18100, 17284, 16625, 16126, 15785, 15595, 15541, 15600, 15749, 15958,
+    16195, 16428, 16624, 16754, 16787, 16697, 16464, 16076, 15522, 14801, 13919, 12889, 11727, 10454, 9099, 7693,
+    6270, 4866, 3515, 2249, 1097, 86, -761, -1430, -1913, -2209, -2321, -2260, -2046, -1702, -1257, -743,
+    -195, 351, 860, 1297, 1628, 1825, 1867, 1736, 1421, 918, 228, -638, -1663, -2828, -4105, -5463,
+    -6871, -8293, -9692, -11037, -12297, -13445, -14458, -15319, -16018, -16551, -16919, -17129, -17200, -17152, -17011, -16803,
+    -16561, -16317, -16106, -15959, -15904, -15966, -16164, -16512, -17020, -17689, -18512, -19479, -20572, -21767, -23035, -24345,
+    -25665, -26960, -28193, -29329, -30340, -31199, -31884, -32379, -32673, -32767, -32666, -32380, -31926, -31324, -30604, -29799,
+    -28944, -28073, -27222, -26426, -25715, -25118, -24656, -24348, -24204, -24225, -24411, -24751, -25231, -25826, -26509, -27251,
+    -28020, -28778, -29490, -30125, -30654, -31047, -31278, -31335, -31209, -30893, -30387, -29702, -28857, -27872, -26770, -25582,
+    -24342, -23081, -21832, -20628, -19500, -18471, -17561, -16787, -16160, -15680, -15341, -15135, -15048, -15053, -15122, -15227,
+    -15338, -15417, -15429, -15345, -15139, -14782, -14248, -13530, -12623, -11518, -10218, -8745, -7127, -5369, -3484, -1519,
+  },
+  { // 32 harmonics
+    435, 2399, 4320, 6166, 7907, 9514, 10964, 12238, 13320, 14206, 14895, 15398, 15731, 15916, 15979, 15950,
+    15859, 15740, 15626, 15551, 15544, 15634, 15843, 16186, 16673, 17306, 18083, 18992, 20021, 21146, 22344, 23584,
+    24833, 26059, 27226, 28304, 29262, 30078, 30729, 31202, 31486, 31582, 31491, 31227, 30807, 30254, 29595, 28863,
+    28089, 27310, 26560, 25872, 25276, 24799, 24463, 24282, 24266, 24416, 24728, 25192, 25789, 26498, 27289, 28131,
+    28989, 29828, 30611, 31305, 31879, 32305, 32561, 32630, 32500, 32169, 31639, 30921, 30032, 28994, 27834, 26583,
+    25275, 23943, 22623, 21349, 20152, 19062, 18100, 17283, 16624, 16125, 15785, 15595, 15540, 15599, 15748, 15957,
+    16194, 16428, 16625, 16753, 16785, 16695, 16463, 16075, 15522, 14801, 13920, 12888, 11725, 10452, 9098, 7693,
+    6271, 4867, 3514, 2247, 1096, 86, -761, -1430, -1913, -2208, -2320, -2260, -2047, -1703, -1257, -743,
+    -194, 352, 860, 1296, 1627, 1825, 1867, 1737, 1421, 917, 228, -638, -1664, -2828, -4105, -5463,
+    -6870, -8291, -9691, -11037, -12297, -13445, -14457, -15318, -16017, -16549, -16917, -17130, -17201, -17152, -17009, -16800,
+    -16559, -16317, -16107, -15959, -15904, -15965, -16162, -16511, -17019, -17688, -18512, -19479, -20571, -21765, -23033, -24344,
+    -25665, -26959, -28191, -29329, -30340, -31198, -31881, -32376, -32672, -32767, -32666, -32379, -31923, -31322, -30603, -29798,
+    -28942, -28071, -27221, -26425, -25714, -25117, -24655, -24347, -24202, -24224, -24410, -24751, -25229, -25824, -26508, -27250,
+    -28018, -28776, -29490, -30126, -30652, -31043, -31276, -31335, -31207, -30890, -30386, -29703, -28857, -27870, -26768, -25580,
+    -24340, -23080, -21832, -20629, -19499, -18469, -17559, -16786, -16159, -15679, -15342, -15137, -15047, -15050, -15119, -15226,
+    -15337, -15417, -15431, -15348, -15138, -14776, -14245, -13529, -12621, -11519, -10226, -8753, -7119, -5350, -3477, -1536,
+  },
+  { // 16 harmonics
+    424, 2391, 4319, 6171, 7916, 9523, 10970, 12239, 13317, 14200, 14889, 15394, 15730, 15916, 15980, 15949,
+    15858, 15739, 15626, 15552, 15546, 15637, 15844, 16185, 16670, 17302, 18079, 18990, 20019, 21146, 22345, 23584,
+    24833, 26058, 27225, 28303, 29262, 30077, 30728, 31200, 31485, 31579, 31489, 31225, 30805, 30252, 29594, 28862,
+    28089, 27310, 26560, 25872, 25276, 24799, 24461, 24280, 24263, 24413, 24726, 25191, 25789, 26497, 27289, 28130,
+    28988, 29827, 30610, 31304, 31878, 32304, 32559, 32627, 32498, 32167, 31638, 30921, 30032, 28994, 27834, 26582,
+    25273, 23941, 22621, 21348, 20152, 19062, 18100, 17283, 16623, 16124, 15784, 15594, 15539, 15598, 15747, 15956,
+    16194, 16428, 16624, 16753, 16784, 16694, 16462, 16074, 15520, 14801, 13920, 12888, 11725, 10452, 9097, 7692,
+    6270, 4866, 3515, 2248, 1097, 87, -761, -1431, -1914, -2209, -2320, -2260, -2046, -1702, -1257, -743,
+    -194, 352, 860, 1296, 1627, 1825, 1867, 1736, 1421, 917, 228, -638, -1663, -2828, -4105, -5463,
+    -6869, -8290, -9690, -11036, -12296, -13445, -14458, -15319, -16018, -16549, -16916, -17128, -17199, -17150, -17008, -16800,
+    -16558, -16316, -16106, -15959, -15903, -15965, -16162, -16511, -17019, -17687, -18510, -19477, -20570, -21764, -23033, -24345,
+    -25665, -26958, -28189, -29326, -30337, -31196, -31881, -32376, -32672, -32767, -32665, -32377, -31920, -31319, -30600, -29796,
+    -28941, -28071, -27220, -26424, -25713, -25116, -24655, -24346, -24201, -24223, -24409, -24749, -25228, -25822, -26506, -27249,
+    -28016, -28775, -29489, -30125, -30652, -31043, -31276, -31334, -31206, -30888, -30383, -29700, -28855, -27869, -26767, -25580,
+    -24340, -23079, -21831, -20627, -19498, -18469, -17560, -16787, -16158, -15677, -15340, -15134, -15045, -15048, -15119, -15226,
+    -15336, -15415, -15430, -15348, -15140, -14780, -14249, -13532, -12620, -11513, -10216, -8743, -7113, -5350, -3483, -1547,
+  },
+  { // 8 harmonics
+    418, 2386, 4315, 6168, 7914, 9524, 10972, 12242, 13321, 14204, 14894, 15399, 15733, 15919, 15981, 15950,
+    15857, 15737, 15624, 15549, 15544, 15635, 15842, 16184, 16670, 17302, 18079, 18990, 20020, 21147, 22345, 23584,
+    24833, 26058, 27225, 28303, 29262, 30078, 30730, 31202, 31486, 31581, 31490, 31227, 30806, 30253, 29594, 28861,
+    28088, 27309, 26559, 25871, 25275, 24798, 24461, 24279, 24263, 24413, 24727, 25191, 25789, 26498, 27289, 28131,
+    28989, 29827, 30611, 31305, 31879, 32305, 32560, 32628, 32499, 32167, 31638, 30921, 30032, 28993, 27833, 26581,
+    25272, 23940, 22620, 21347, 20152, 19062, 18100, 17284, 16624, 16125, 15785, 15595, 15540, 15599, 15748, 15956,
+    16194, 16427, 16624, 16752, 16784, 16694, 16462, 16074, 15521, 14801, 13920, 12889, 11725, 10452, 9098, 7693,
+    6271, 4866, 3515, 2248, 1097, 87, -761, -1431, -1914, -2209, -2321, -2260, -2046, -1703, -1257, -743,
+    -194, 352, 861, 1297, 1628, 1826, 1868, 1737, 1421, 918, 228, -638, -1664, -2829, -4106, -5464,
+    -6871, -8291, -9691, -11037, -12297, -13445, -14458, -15319, -16017, -16548, -16915, -17127, -17198, -17150, -17007, -16800,
+    -16558, -16316, -16106, -15959, -15904, -15965, -16163, -16511, -17019, -17687, -18511, -19478, -20570, -21765, -23034, -24345,
+    -25665, -26958, -28190, -29326, -30337, -31195, -31880, -32376, -32672, -32767, -32665, -32377, -31921, -31319, -30601, -29797,
+    -28942, -28071, -27220, -26424, -25713, -25116, -24655, -24346, -24201, -24223, -24410, -24750, -25229, -25823, -26507, -27249,
+    -28017, -28775, -29489, -30124, -30652, -31043, -31276, -31334, -31206, -30888, -30383, -29700, -28855, -27869, -26768, -25581,
+    -24340, -23078, -21830, -20627, -19498, -18468, -17560, -16787, -16160, -15679, -15342, -15137, -15048, -15051, -15122, -15228,
+    -15337, -15415, -15428, -15345, -15136, -14776, -14244, -13527, -12616, -11510, -10215, -8744, -7115, -5353, -3488, -1552,
+  },
+  { // 4 harmonics
+    366, 1436, 2503, 3565, 4619, 5664, 6695, 7713, 8714, 9696, 10658, 11597, 12513, 13404, 14268, 15104,
+    15912, 16691, 17439, 18157, 18844, 19500, 20125, 20720, 21284, 21818, 22323, 22800, 23248, 23671, 24067, 24439,
+    24787, 25114, 25419, 25705, 25972, 26222, 26456, 26675, 26881, 27074, 27255, 27426, 27587, 27738, 27881, 28016,
+    28143, 28262, 28374, 28478, 28574, 28663, 28743, 28815, 28878, 28930, 28972, 29002, 29019, 29023, 29013, 28987,
+    28945, 28885, 28807, 28709, 28591, 28451, 28289, 28104, 27895, 27662, 27405, 27122, 26813, 26480, 26120, 25736,
+    25327, 24893, 24435, 23954, 23450, 22926, 22381, 21817, 21236, 20639, 20027, 19402, 18767, 18121, 17468, 16810,
+    16147, 15482, 14817, 14153, 13492, 12836, 12187, 11546, 10914, 10292, 9683, 9086, 8503, 7935, 7381, 6844,
+    6322, 5815, 5325, 4851, 4392, 3947, 3517, 3100, 2695, 2302, 1919, 1545, 1178, 817, 461, 108,
+    -244, -595, -948, -1305, -1666, -2034, -2409, -2793, -3187, -3593, -4011, -4443, -4889, -5349, -5825, -6316,
+    -6823, -7345, -7883, -8437, -9005, -9588, -10183, -10792, -11411, -12041, -12680, -13326, -13978, -14634, -15293, -15953,
+    -16612, -17268, -17919, -18564, -19201, -19828, -20443, -21045, -21631, -22201, -22753, -23286, -23798, -24288, -24756, -25200,
+    -25620, -26015, -26385, -26729, -27048, -27341, -27609, -27851, -28069, -28262, -28432, -28578, -28703, -28806, -28889, -28952,
+    -28997, -29024, -29035, -29031, -29013, -28981, -28937, -28881, -28815, -28739, -28654, -28560, -28458, -28348, -28230, -28105,
+    -27973, -27833, -27685, -27529, -27364, -27190, -27005, -26810, -26603, -26384, -26150, -25902, -25637, -25356, -25055, -24735,
+    -24394, -24031, -23644, -23232, -22795, -22331, -21839, -21319, -20770, -20191, -19582, -18943, -18273, -17572, -16841, -16079,
+    -15288, -14468, -13620, -12745, -11844, -10919, -9970, -9000, -8010, -7003, -5980, -4943, -3894, -2837, -1773, -704,
+  },
+  { // 2 harmonics
+    348, 1260, 2171, 3080, 3986, 4888, 5785, 6677, 7562, 8439, 9308, 10168, 11018, 11857, 12685, 13500,
+    14301, 15089, 15863, 16621, 17363, 18088, 18796, 19486, 20158, 20810, 21444, 22057, 22649, 23221, 23771, 24300,
+    24806, 25290, 25752, 26190, 26606, 26998, 27367, 27712, 28034, 28331, 28606, 28856, 29083, 29286, 29465, 29621,
+    29754, 29864, 29950, 30014, 30056, 30076, 30073, 30049, 30004, 29938, 29852, 29745, 29619, 29474, 29310, 29127,
+    28927, 28709, 28475, 28224, 27957, 27675, 27379, 27068, 26743, 26405, 26054, 25692, 25317, 24932, 24536, 24130,
+    23715, 23290, 22857, 22417, 21968, 21513, 21051, 20583, 20109, 19630, 19146, 18658, 18166, 17670, 17171, 16669,
+    16164, 15657, 15148, 14637, 14125, 13612, 13097, 12582, 12066, 11549, 11032, 10516, 9999, 9482, 8965, 8449,
+    7933, 7418, 6902, 6388, 5874, 5360, 4847, 4335, 3823, 3311, 2800, 2289, 1779, 1268, 759, 249,
+    -261, -770, -1280, -1789, -2299, -2808, -3318, -3828, -4339, -4849, -5361, -5872, -6384, -6896, -7408, -7921,
+    -8434, -8947, -9460, -9973, -10487, -11000, -11513, -12026, -12538, -13050, -13560, -14070, -14579, -15085, -15591, -16094,
+    -16595, -17093, -17588, -18081, -18569, -19054, -19534, -20010, -20481, -20946, -21405, -21858, -22304, -22742, -23173, -23596,
+    -24009, -24414, -24809, -25193, -25567, -25929, -26279, -26617, -26942, -27254, -27551, -27835, -28103, -28355, -28592, -28811,
+    -29014, -29199, -29367, -29515, -29645, -29755, -29846, -29916, -29966, -29995, -30002, -29988, -29952, -29894, -29813, -29709,
+    -29583, -29433, -29260, -29064, -28844, -28601, -28334, -28043, -27729, -27391, -27030, -26645, -26237, -25806, -25352, -24875,
+    -24376, -23855, -23312, -22747, -22162, -21556, -20930, -20284, -19619, -18935, -18233, -17514, -16778, -16026, -15258, -14475,
+    -13678, -12868, -12045, -11210, -10364, -9507, -8641, -7767, -6885, -5995, -5100, -4200, -3295, -2387, -1477, -565,
+  },
+  { // 1 harmonics
+    304, 1015, 1725, 2434, 3142, 3848, 4552, 5252, 5950, 6644, 7334, 8020, 8701, 9376, 10046, 10710,
+    11367, 12018, 12661, 13297, 13925, 14544, 15155, 15756, 16348, 16930, 17502, 18063, 18614, 19153, 19681, 20197,
+    20700, 21191, 21670, 22135, 22587, 23026, 23450, 23861, 24257, 24638, 25005, 25357, 25693, 26014, 26319, 26608,
+    26882, 27139, 27379, 27604, 27811, 28002, 28176, 28333, 28473, 28596, 28702, 28790, 28861, 28914, 28950, 28969,
+    28970, 28954, 28921, 28870, 28801, 28715, 28612, 28492, 28354, 28200, 28028, 27840, 27635, 27413, 27174, 26920,
+    26649, 26362, 26059, 25740, 25406, 25057, 24692, 24313, 23919, 23511, 23088, 22652, 22201, 21738, 21261, 20772,
+    20270, 19756, 19230, 18692, 18144, 17584, 17013, 16433, 15842, 15242, 14633, 14015, 13388, 12754, 12111, 11462,
+    10805, 10143, 9473, 8799, 8119, 7434, 6744, 6051, 5353, 4653, 3950, 3244, 2537, 1828, 1118, 407,
+    -304, -1015, -1725, -2435, -3142, -3848, -4552, -5253, -5950, -6644, -7334, -8020, -8701, -9376, -10046, -10710,
+    -11368, -12018, -12662, -13297, -13925, -14544, -15155, -15756, -16348, -16930, -17502, -18063, -18614, -19153, -19681, -20197,
+    -20700, -21192, -21670, -22135, -22588, -23026, -23451, -23861, -24257, -24639, -25005, -25357, -25693, -26014, -26319, -26608,
+    -26882, -27139, -27380, -27604, -27811, -28002, -28176, -28333, -28473, -28596, -28702, -28790, -28861, -28914, -28951, -28969,
+    -28971, -28954, -28921, -28870, -28801, -28715, -28612, -28492, -28355, -28200, -28028, -27840, -27635, -27413, -27175, -26920,
+    -26649, -26362, -26059, -25740, -25406, -25057, -24693, -24313, -23919, -23511, -23088, -22652, -22202, -21738, -21262, -20772,
+    -20270, -19756, -19230, -18693, -18144, -17584, -17013, -16433, -15842, -15242, -14633, -14015, -13388, -12754, -12112, -11462,
+    -10806, -10143, -9474, -8799, -8119, -7434, -6744, -6051, -5354, -4653, -3950, -3244, -2537, -1828, -1118, -407,
+  },
+};
+
+extern const int16_t waveform_epiano_0044_mipmaps[WAVE_MIPMAPS][256] PROGMEM = {
+  { // 64 harmonics
+    740, 3041, 5377, 7736, 10087, 12393, 14632, 16786, 18839, 20773, 22577, 24241, 25755, 27113, 28320, 29376,
+    30280, 31032, 31642, 32116, 32458, 32671, 32763, 32743, 32614, 32381, 32052, 31636, 31136, 30558, 29910, 29199,
+    28427, 27601, 26729, 25816, 24864, 23877, 22866, 21837, 20791, 19729, 18657, 17583, 16510, 15441, 14379, 13326,
+    12285, 11257, 10247, 9259, 8292, 7346, 6427, 5540, 4687, 3866, 3081, 2336, 1634, 976, 364, -198,
+    -709, -1168, -1570, -1913, -2196, -2419, -2578, -2672, -2698, -2658, -2550, -2372, -2122, -1800, -1405, -937,
+    -396, 218, 903, 1656, 2472, 3344, 4263, 5218, 6196, 7189, 8184, 9168, 10125, 11045, 11920, 12743,
+    13507, 14207, 14842, 15414, 15922, 16371, 16762, 17102, 17395, 17646, 17860, 18042, 18193, 18318, 18419, 18500,
+    18561, 18605, 18632, 18641, 18630, 18602, 18557, 18491, 18402, 18291, 18157, 17997, 17806, 17587, 17340, 17063,
+    16751, 16403, 16023, 15607, 15152, 14659, 14128, 13561, 12954, 12307, 11623, 10904, 10148, 9356, 8532, 7676,
+    6789, 5870, 4924, 3950, 2948, 1919, 864, -214, -1317, -2441, -3581, -4736, -5903, -7078, -8248, -9404,
+    -10540, -11651, -12726, -13748, -14706, -15594, -16405, -17132, -17770, -18317, -18775, -19146, -19438, -19656, -19811, -19910,
+    -19966, -19986, -19979, -19954, -19920, -19885, -19853, -19828, -19815, -19819, -19842, -19885, -19951, -20040, -20152, -20287,
+    -20444, -20624, -20825, -21046, -21284, -21537, -21806, -22091, -22386, -22688, -22998, -23318, -23646, -23977, -24305, -24627,
+    -24945, -25254, -25551, -25834, -26101, -26349, -26578, -26785, -26970, -27129, -27261, -27368, -27449, -27500, -27523, -27519,
+    -27488, -27427, -27335, -27218, -27077, -26908, -26708, -26480, -26225, -25941, -25623, -25272, -24882, -24448, -23963, -23426,
+    -22828, -22158, -21404, -20563, -19629, -18588, -17434, -16162, -14764, -13235, -11576, -9800, -7910, -5894, -3756, -1531,
+  },
+  { // 32 harmonics
+    725, 3045, 5392, 7746, 10084, 12385, 14627, 16785, 18841, 20777, 22580, 24240, 25752, 27112, 28320, 29375,
+    30279, 31034, 31645, 32117, 32456, 32669, 32763, 32742, 32614, 32382, 32054, 31636, 31135, 30557, 29910, 29198,
+    28428, 27603, 26730, 25815, 24862, 23878, 22868, 21837, 20789, 19728, 18658, 17584, 16511, 15441, 14378, 13325,
+    12285, 11259, 10249, 9259, 8290, 7346, 6429, 5541, 4686, 3866, 3082, 2337, 1634, 976, 364, -198,
+    -710, -1167, -1569, -1913, -2197, -2419, -2578, -2671, -2698, -2658, -2549, -2371, -2122, -1800, -1406, -938,
+    -396, 218, 904, 1657, 2472, 3343, 4262, 5217, 6198, 7191, 8185, 9166, 10123, 11045, 11921, 12743,
+    13507, 14207, 14843, 15414, 15922, 16370, 16762, 17102, 17396, 17647, 17860, 18041, 18192, 18317, 18419, 18501,
+    18562, 18605, 18631, 18639, 18630, 18603, 18557, 18491, 18403, 18292, 18156, 17995, 17806, 17589, 17341, 17062,
+    16750, 16404, 16023, 15606, 15151, 14660, 14129, 13561, 12953, 12308, 11624, 10903, 10147, 9356, 8532, 7676,
+    6789, 5871, 4924, 3950, 2947, 1919, 865, -214, -1316, -2440, -3582, -4738, -5905, -7076, -8245, -9404,
+    -10543, -11654, -12725, -13745, -14705, -15595, -16406, -17132, -17770, -18317, -18775, -19147, -19438, -19657, -19811, -19910,
+    -19965, -19985, -19978, -19955, -19921, -19885, -19852, -19827, -19815, -19819, -19842, -19886, -19952, -20040, -20152, -20286,
+    -20444, -20624, -20825, -21046, -21284, -21538, -21807, -22089, -22383, -22687, -23000, -23321, -23646, -23975, -24303, -24627,
+    -24946, -25255, -25552, -25834, -26101, -26349, -26578, -26785, -26969, -27129, -27262, -27369, -27448, -27499, -27523, -27519,
+    -27487, -27426, -27338, -27221, -27077, -26905, -26706, -26480, -26226, -25942, -25625, -25272, -24881, -24446, -23963, -23426,
+    -22827, -22157, -21406, -20566, -19629, -18586, -17431, -16159, -14763, -13240, -11587, -9804, -7898, -5877, -3755, -1548,
+  },
+  { // 16 harmonics
+    720, 3044, 5395, 7752, 10092, 12391, 14627, 16781, 18833, 20769, 22574, 24238, 25754, 27118, 28326, 29381,
+    30283, 31036, 31645, 32116, 32454, 32666, 32759, 32738, 32609, 32379, 32054, 31639, 31140, 30564, 29916, 29202,
+    28429, 27602, 26727, 25811, 24858, 23874, 22865, 21835, 20788, 19729, 18661, 17589, 16516, 15446, 14381, 13326,
+    12282, 11254, 10244, 9253, 8286, 7344, 6429, 5543, 4689, 3869, 3086, 2340, 1636, 976, 363, -201,
+    -714, -1171, -1573, -1915, -2198, -2418, -2575, -2668, -2695, -2655, -2548, -2371, -2123, -1802, -1409, -941,
+    -399, 217, 903, 1657, 2474, 3346, 4264, 5219, 6199, 7192, 8185, 9166, 10122, 11043, 11919, 12742,
+    13506, 14207, 14844, 15415, 15923, 16371, 16763, 17103, 17395, 17646, 17859, 18040, 18191, 18317, 18419, 18501,
+    18563, 18606, 18632, 18640, 18631, 18603, 18556, 18489, 18401, 18290, 18155, 17995, 17807, 17590, 17343, 17064,
+    16751, 16405, 16023, 15605, 15150, 14658, 14128, 13559, 12952, 12308, 11625, 10905, 10150, 9359, 8534, 7677,
+    6788, 5869, 4922, 3947, 2945, 1917, 864, -214, -1314, -2437, -3578, -4734, -5902, -7075, -8246, -9407,
+    -10548, -11658, -12729, -13748, -14706, -15593, -16402, -17128, -17765, -18313, -18772, -19146, -19440, -19660, -19816, -19916,
+    -19969, -19987, -19979, -19953, -19917, -19880, -19847, -19823, -19813, -19819, -19843, -19889, -19955, -20045, -20156, -20290,
+    -20446, -20624, -20823, -21041, -21278, -21533, -21803, -22087, -22384, -22691, -23006, -23327, -23652, -23978, -24303, -24626,
+    -24942, -25250, -25547, -25831, -26099, -26349, -26579, -26787, -26972, -27131, -27265, -27371, -27450, -27500, -27523, -27517,
+    -27484, -27423, -27334, -27219, -27076, -26906, -26709, -26483, -26229, -25944, -25626, -25274, -24882, -24447, -23963, -23424,
+    -22823, -22152, -21402, -20565, -19630, -18591, -17438, -16164, -14765, -13238, -11582, -9799, -7895, -5877, -3759, -1554,
+  },
+  { // 8 harmonics
+    981, 3182, 5402, 7625, 9833, 12011, 14143, 16213, 18206, 20108, 21907, 23590, 25148, 26571, 27854, 28990,
+    29977, 30813, 31497, 32030, 32417, 32661, 32767, 32742, 32594, 32331, 31961, 31493, 30936, 30301, 29594, 28827,
+    28006, 27140, 26237, 25302, 24342, 23363, 22369, 21365, 20353, 19338, 18321, 17305, 16291, 15281, 14276, 13278,
+    12287, 11305, 10333, 9374, 8427, 7496, 6584, 5691, 4822, 3980, 3168, 2389, 1648, 949, 296, -307,
+    -856, -1347, -1776, -2139, -2434, -2656, -2805, -2877, -2872, -2789, -2628, -2390, -2076, -1688, -1228, -701,
+    -111, 539, 1242, 1992, 2785, 3611, 4466, 5342, 6230, 7125, 8019, 8905, 9777, 10627, 11450, 12241,
+    12995, 13708, 14375, 14995, 15565, 16084, 16551, 16966, 17329, 17643, 17908, 18126, 18301, 18435, 18531, 18592,
+    18622, 18623, 18598, 18550, 18482, 18396, 18292, 18173, 18040, 17892, 17729, 17551, 17357, 17145, 16914, 16662,
+    16385, 16082, 15751, 15387, 14989, 14555, 14082, 13567, 13009, 12407, 11759, 11064, 10323, 9536, 8703, 7826,
+    6907, 5947, 4950, 3918, 2856, 1767, 656, -473, -1614, -2762, -3912, -5057, -6193, -7314, -8414, -9486,
+    -10527, -11530, -12491, -13406, -14269, -15077, -15828, -16518, -17146, -17711, -18211, -18648, -19022, -19335, -19589, -19788,
+    -19935, -20036, -20094, -20117, -20109, -20078, -20029, -19970, -19906, -19846, -19794, -19756, -19739, -19746, -19781, -19848,
+    -19950, -20087, -20260, -20469, -20713, -20989, -21295, -21627, -21981, -22352, -22735, -23125, -23517, -23904, -24282, -24647,
+    -24993, -25316, -25614, -25884, -26123, -26331, -26507, -26652, -26767, -26852, -26911, -26945, -26957, -26950, -26927, -26889,
+    -26838, -26777, -26705, -26623, -26530, -26424, -26302, -26160, -25995, -25799, -25567, -25292, -24966, -24580, -24127, -23599,
+    -22986, -22282, -21479, -20572, -19556, -18426, -17180, -15817, -14339, -12748, -11048, -9245, -7347, -5364, -3307, -1187,
+  },
+  { // 4 harmonics
+    2303, 4212, 6118, 8013, 9888, 11736, 13548, 15316, 17034, 18693, 20285, 21806, 23247, 24603, 25868, 27037,
+    28106, 29070, 29926, 30671, 31304, 31821, 32222, 32508, 32677, 32732, 32673, 32503, 32224, 31840, 31355, 30772,
+    30097, 29336, 28493, 27574, 26587, 25538, 24434, 23281, 22088, 20861, 19608, 18336, 17052, 15765, 14480, 13206,
+    11948, 10713, 9507, 8337, 7207, 6124, 5090, 4112, 3193, 2336, 1545, 821, 168, -414, -923, -1359,
+    -1721, -2010, -2226, -2370, -2443, -2447, -2384, -2257, -2068, -1820, -1516, -1160, -754, -302, 192, 724,
+    1290, 1887, 2511, 3158, 3825, 4507, 5201, 5904, 6611, 7321, 8030, 8735, 9432, 10120, 10797, 11458,
+    12104, 12731, 13337, 13922, 14483, 15019, 15529, 16011, 16465, 16890, 17284, 17648, 17980, 18279, 18545, 18778,
+    18977, 19142, 19271, 19365, 19424, 19446, 19432, 19380, 19292, 19166, 19002, 18800, 18559, 18280, 17962, 17605,
+    17210, 16775, 16302, 15791, 15241, 14654, 14030, 13369, 12673, 11943, 11179, 10383, 9556, 8700, 7817, 6909,
+    5977, 5025, 4054, 3067, 2066, 1055, 36, -988, -2014, -3038, -4058, -5071, -6073, -7061, -8032, -8984,
+    -9913, -10817, -11692, -12537, -13350, -14127, -14867, -15569, -16232, -16853, -17432, -17969, -18463, -18915, -19324, -19691,
+    -20017, -20304, -20552, -20764, -20941, -21086, -21202, -21290, -21354, -21397, -21422, -21432, -21431, -21421, -21406, -21390,
+    -21376, -21367, -21366, -21375, -21399, -21438, -21496, -21574, -21675, -21799, -21947, -22120, -22319, -22543, -22792, -23064,
+    -23360, -23676, -24011, -24363, -24728, -25103, -25485, -25870, -26254, -26633, -27001, -27355, -27688, -27997, -28276, -28519,
+    -28721, -28879, -28985, -29036, -29027, -28953, -28811, -28595, -28303, -27932, -27479, -26941, -26317, -25605, -24805, -23917,
+    -22940, -21875, -20725, -19490, -18175, -16781, -15313, -13774, -12170, -10505, -8786, -7019, -5210, -3366, -1494, 398,
+  },
+  { // 2 harmonics
+    6634, 7525, 8392, 9234, 10050, 10837, 11596, 12325, 13024, 13691, 14326, 14928, 15496, 16030, 16530, 16995,
+    17425, 17820, 18179, 18503, 18791, 19044, 19262, 19445, 19594, 19709, 19790, 19838, 19853, 19838, 19791, 19714,
+    19609, 19475, 19314, 19128, 18916, 18681, 18423, 18144, 17845, 17528, 17194, 16843, 16478, 16101, 15711, 15312,
+    14904, 14488, 14067, 13642, 13214, 12785, 12356, 11928, 11503, 11083, 10668, 10260, 9860, 9469, 9089, 8720,
+    8365, 8023, 7696, 7384, 7089, 6812, 6553, 6312, 6091, 5890, 5709, 5549, 5410, 5293, 5197, 5123,
+    5071, 5041, 5032, 5045, 5079, 5133, 5209, 5304, 5419, 5553, 5706, 5876, 6063, 6265, 6483, 6715,
+    6960, 7217, 7485, 7763, 8050, 8344, 8644, 8949, 9258, 9569, 9881, 10192, 10501, 10807, 11109, 11404,
+    11692, 11971, 12240, 12498, 12742, 12972, 13186, 13384, 13563, 13723, 13863, 13980, 14076, 14147, 14193, 14214,
+    14209, 14175, 14114, 14024, 13905, 13755, 13575, 13364, 13122, 12848, 12542, 12205, 11836, 11435, 11002, 10538,
+    10042, 9516, 8959, 8373, 7757, 7112, 6439, 5740, 5014, 4263, 3487, 2689, 1868, 1027, 166, -713,
+    -1608, -2519, -3444, -4381, -5328, -6285, -7249, -8219, -9193, -10169, -11146, -12121, -13094, -14062, -15022, -15975,
+    -16917, -17848, -18764, -19665, -20549, -21414, -22258, -23080, -23877, -24649, -25395, -26111, -26797, -27452, -28075, -28663,
+    -29216, -29732, -30211, -30652, -31053, -31413, -31733, -32010, -32245, -32437, -32586, -32691, -32751, -32767, -32738, -32665,
+    -32548, -32386, -32179, -31929, -31635, -31299, -30919, -30498, -30036, -29533, -28991, -28411, -27793, -27139, -26449, -25726,
+    -24970, -24182, -23365, -22519, -21646, -20748, -19827, -18883, -17919, -16936, -15937, -14922, -13895, -12855, -11806, -10750,
+    -9687, -8621, -7552, -6483, -5416, -4352, -3293, -2241, -1198, -165, 855, 1862, 2854, 3828, 4784, 5719,
+  },
+  { // 1 harmonics
+    -3873, -3401, -2926, -2450, -1972, -1493, -1013, -533, -52, 429, 909, 1389, 1868, 2346, 2823, 3298,
+    3770, 4241, 4709, 5174, 5636, 6095, 6550, 7001, 7448, 7891, 8328, 8761, 9188, 9610, 10026, 10436,
+    10840, 11237, 11627, 12011, 12387, 12755, 13116, 13469, 13814, 14151, 14479, 14799, 15109, 15410, 15703, 15985,
+    16258, 16521, 16775, 17018, 17251, 17473, 17685, 17887, 18077, 18257, 18425, 18583, 18729, 18864, 18988, 19100,
+    19201, 19290, 19368, 19434, 19488, 19531, 19561, 19580, 19587, 19583, 19566, 19538, 19498, 19446, 19383, 19308,
+    19221, 19122, 19012, 18891, 18758, 18614, 18459, 18293, 18115, 17927, 17728, 17518, 17298, 17067, 16826, 16575,
+    16314, 16043, 15762, 15472, 15172, 14864, 14546, 14220, 13885, 13542, 13190, 12831, 12464, 12089, 11707, 11318,
+    10923, 10520, 10112, 9697, 9276, 8850, 8419, 7982, 7541, 7095, 6644, 6190, 5732, 5271, 4806, 4339,
+    3869, 3396, 2922, 2445, 1968, 1489, 1009, 528, 48, -433, -914, -1394, -1873, -2351, -2827, -3302,
+    -3775, -4246, -4714, -5179, -5641, -6100, -6555, -7006, -7453, -7895, -8333, -8765, -9193, -9614, -10031, -10440,
+    -10844, -11241, -11632, -12015, -12391, -12760, -13121, -13474, -13819, -14156, -14484, -14803, -15114, -15415, -15707, -15990,
+    -16263, -16526, -16779, -17022, -17255, -17478, -17690, -17891, -18082, -18261, -18430, -18588, -18734, -18869, -18993, -19105,
+    -19206, -19295, -19373, -19438, -19493, -19535, -19566, -19585, -19592, -19587, -19571, -19543, -19502, -19451, -19387, -19312,
+    -19225, -19127, -19017, -18896, -18763, -18619, -18464, -18297, -18120, -17932, -17732, -17523, -17302, -17072, -16831, -16579,
+    -16318, -16047, -15767, -15476, -15177, -14868, -14551, -14224, -13890, -13546, -13195, -12836, -12468, -12094, -11712, -11323,
+    -10927, -10525, -10116, -9701, -9281, -8855, -8423, -7986, -7545, -7099, -6649, -6195, -5737, -5275, -4811, -4343,
+  },
+};
+
+extern const int16_t waveform_flute_0001_mipmaps[WAVE_MIPMAPS][256] PROGMEM = {
+  { // 64 harmonics
+    231, 938, 1682, 2460, 3149, 3653, 4003, 4302, 4643, 5042, 5445, 5756, 5908, 5918, 5886, 5912,
+    6031, 6210, 6395, 6557, 6709, 6906, 7209, 7645, 8180, 8732, 9232, 9664, 10063, 10468, 10881, 11263,
+    11568, 11776, 11898, 11967, 12048, 12204, 12447, 12707, 12886, 12958, 12996, 13093, 13290, 13566, 13897, 14271,
+    14673, 15072, 15452, 15818, 16202, 16638, 17156, 17760, 18415, 19073, 19717, 20367, 21022, 21636, 22178, 22683,
+    23222, 23803, 24355, 24824, 25245, 25709, 26271, 26909, 27566, 28190, 28755, 29261, 29732, 30205, 30706, 31234,
+    31739, 32140, 32392, 32537, 32653, 32749, 32747, 32586, 32294, 31930, 31494, 30963, 30375, 29834, 29407, 29084,
+    28823, 28587, 28339, 28049, 27731, 27441, 27198, 26945, 26602, 26128, 25528, 24820, 24017, 23114, 22082, 20886,
+    19538, 18094, 16618, 15148, 13715, 12356, 11075, 9824, 8548, 7230, 5882, 4510, 3124, 1762, 472, -716,
+    -1795, -2753, -3574, -4258, -4816, -5264, -5618, -5883, -6038, -6070, -6033, -6052, -6219, -6499, -6779, -6995,
+    -7193, -7451, -7801, -8230, -8722, -9268, -9861, -10491, -11145, -11790, -12375, -12854, -13210, -13442, -13568, -13632,
+    -13706, -13839, -14019, -14211, -14408, -14643, -14921, -15204, -15456, -15696, -15975, -16309, -16665, -16999, -17292, -17551,
+    -17804, -18080, -18380, -18662, -18899, -19146, -19501, -19980, -20473, -20882, -21256, -21745, -22415, -23174, -23876, -24466,
+    -24996, -25560, -26217, -26960, -27711, -28380, -28915, -29322, -29617, -29798, -29873, -29874, -29845, -29819, -29830, -29916,
+    -30089, -30317, -30563, -30822, -31102, -31387, -31632, -31800, -31881, -31887, -31830, -31716, -31527, -31223, -30771, -30170,
+    -29450, -28652, -27814, -26974, -26158, -25374, -24623, -23901, -23198, -22508, -21849, -21261, -20755, -20282, -19765, -19160,
+    -18469, -17701, -16837, -15855, -14765, -13607, -12410, -11162, -9835, -8438, -7025, -5633, -4253, -2888, -1624, -580,
+  },
+  { // 32 harmonics
+    265, 1085, 1804, 2438, 3004, 3515, 3981, 4406, 4787, 5121, 5400, 5622, 5787, 5903, 5982, 6042,
+    6099, 6175, 6288, 6452, 6678, 6969, 7321, 7725, 8170, 8644, 9134, 9627, 10107, 10554, 10947, 11271,
+    11519, 11702, 11843, 11973, 12117, 12285, 12470, 12651, 12806, 12929, 13032, 13147, 13311, 13552, 13876, 14260,
+    14671, 15075, 15455, 15822, 16206, 16643, 17157, 17750, 18401, 19075, 19742, 20384, 20998, 21591, 22170, 22736,
+    23281, 23798, 24288, 24764, 25249, 25765, 26326, 26924, 27539, 28143, 28716, 29253, 29762, 30258, 30749, 31229,
+    31679, 32071, 32381, 32597, 32720, 32754, 32702, 32556, 32305, 31942, 31477, 30944, 30391, 29873, 29430, 29074,
+    28791, 28550, 28314, 28062, 27789, 27501, 27202, 26887, 26531, 26100, 25561, 24887, 24071, 23114, 22029, 20825,
+    19515, 18117, 16659, 15183, 13734, 12346, 11032, 9775, 8535, 7263, 5931, 4539, 3121, 1733, 431, -747,
+    -1790, -2710, -3523, -4237, -4845, -5326, -5666, -5870, -5966, -6006, -6046, -6130, -6275, -6476, -6711, -6961,
+    -7219, -7498, -7822, -8214, -8689, -9245, -9863, -10517, -11173, -11797, -12359, -12829, -13191, -13438, -13586, -13669,
+    -13734, -13824, -13969, -14174, -14423, -14689, -14948, -15192, -15432, -15688, -15978, -16305, -16653, -16996, -17310, -17584,
+    -17828, -18064, -18316, -18599, -18914, -19249, -19596, -19956, -20344, -20783, -21291, -21868, -22496, -23144, -23784, -24402,
+    -25007, -25624, -26274, -26961, -27663, -28332, -28912, -29358, -29651, -29804, -29854, -29847, -29827, -29824, -29860, -29944,
+    -30085, -30284, -30536, -30827, -31128, -31406, -31632, -31787, -31868, -31882, -31836, -31725, -31528, -31218, -30769, -30176,
+    -29455, -28648, -27805, -26967, -26160, -25386, -24636, -23901, -23182, -22494, -21855, -21279, -20758, -20264, -19752, -19175,
+    -18498, -17708, -16810, -15821, -14758, -13631, -12437, -11172, -9836, -8439, -7010, -5585, -4208, -2914, -1731, -671,
+  },
+  { // 16 harmonics
+    163, 1028, 1801, 2487, 3092, 3624, 4088, 4489, 4832, 5120, 5357, 5549, 5700, 5819, 5916, 6003,
+    6093, 6199, 6336, 6513, 6740, 7022, 7359, 7746, 8176, 8636, 9112, 9588, 10048, 10480, 10871, 11214,
+    11506, 11748, 11943, 12101, 12231, 12343, 12449, 12558, 12681, 12822, 12988, 13181, 13403, 13654, 13935, 14246,
+    14586, 14957, 15359, 15794, 16261, 16762, 17293, 17854, 18440, 19045, 19664, 20288, 20911, 21525, 22126, 22710,
+    23274, 23819, 24347, 24863, 25372, 25881, 26394, 26917, 27454, 28004, 28568, 29139, 29710, 30271, 30809, 31309,
+    31758, 32139, 32440, 32649, 32758, 32763, 32664, 32467, 32181, 31820, 31402, 30946, 30475, 30007, 29561, 29152,
+    28788, 28472, 28202, 27965, 27747, 27527, 27280, 26982, 26607, 26135, 25548, 24835, 23994, 23025, 21939, 20750,
+    19476, 18137, 16755, 15348, 13931, 12518, 11115, 9728, 8359, 7008, 5676, 4364, 3076, 1821, 609, -544,
+    -1623, -2609, -3485, -4240, -4864, -5354, -5716, -5961, -6109, -6183, -6214, -6229, -6260, -6332, -6467, -6680,
+    -6977, -7360, -7820, -8344, -8914, -9510, -10110, -10696, -11249, -11756, -12209, -12603, -12940, -13223, -13461, -13663,
+    -13840, -14003, -14161, -14324, -14499, -14692, -14904, -15139, -15395, -15671, -15964, -16270, -16584, -16902, -17220, -17533,
+    -17840, -18139, -18430, -18717, -19006, -19302, -19616, -19956, -20332, -20754, -21228, -21758, -22345, -22984, -23667, -24381,
+    -25110, -25836, -26539, -27199, -27801, -28329, -28775, -29135, -29412, -29612, -29749, -29839, -29899, -29949, -30007, -30088,
+    -30202, -30355, -30546, -30772, -31019, -31272, -31513, -31719, -31870, -31945, -31926, -31799, -31556, -31194, -30715, -30128,
+    -29448, -28692, -27882, -27042, -26195, -25362, -24562, -23810, -23112, -22470, -21880, -21329, -20802, -20276, -19729, -19136,
+    -18474, -17725, -16875, -15915, -14846, -13674, -12412, -11081, -9703, -8305, -6913, -5551, -4244, -3007, -1856, -798,
+  },
+  { // 8 harmonics
+    -736, 140, 964, 1732, 2443, 3094, 3685, 4217, 4692, 5111, 5478, 5798, 6074, 6312, 6519, 6700,
+    6862, 7011, 7154, 7296, 7444, 7601, 7773, 7962, 8171, 8402, 8656, 8931, 9226, 9541, 9871, 10214,
+    10566, 10923, 11281, 11636, 11983, 12321, 12645, 12954, 13247, 13523, 13783, 14028, 14260, 14484, 14703, 14921,
+    15145, 15379, 15629, 15902, 16201, 16534, 16903, 17312, 17764, 18260, 18801, 19385, 20010, 20672, 21368, 22091,
+    22834, 23591, 24352, 25110, 25856, 26582, 27279, 27940, 28558, 29127, 29643, 30101, 30499, 30836, 31113, 31330,
+    31489, 31595, 31652, 31664, 31636, 31575, 31485, 31371, 31238, 31091, 30931, 30761, 30582, 30394, 30194, 29980,
+    29749, 29495, 29213, 28897, 28539, 28134, 27674, 27153, 26566, 25906, 25171, 24357, 23464, 22492, 21443, 20320,
+    19128, 17875, 16569, 15219, 13836, 12430, 11015, 9603, 8205, 6833, 5499, 4214, 2987, 1826, 737, -274,
+    -1204, -2051, -2817, -3501, -4109, -4644, -5113, -5522, -5881, -6196, -6477, -6733, -6972, -7202, -7431, -7665,
+    -7910, -8169, -8448, -8747, -9068, -9410, -9772, -10152, -10546, -10951, -11364, -11778, -12191, -12596, -12991, -13372,
+    -13735, -14078, -14399, -14697, -14974, -15228, -15463, -15681, -15884, -16078, -16265, -16451, -16640, -16837, -17047, -17274,
+    -17521, -17793, -18092, -18420, -18778, -19167, -19588, -20038, -20517, -21022, -21549, -22097, -22660, -23234, -23816, -24400,
+    -24982, -25557, -26121, -26669, -27199, -27706, -28188, -28641, -29064, -29454, -29811, -30132, -30418, -30668, -30881, -31058,
+    -31200, -31306, -31377, -31414, -31417, -31387, -31324, -31229, -31102, -30943, -30752, -30529, -30274, -29987, -29668, -29315,
+    -28928, -28508, -28052, -27560, -27032, -26467, -25864, -25222, -24542, -23823, -23064, -22266, -21430, -20556, -19645, -18699,
+    -17720, -16709, -15671, -14607, -13523, -12422, -11309, -10189, -9067, -7949, -6841, -5749, -4679, -3638, -2629, -1660,
+  },
+  { // 4 harmonics
+    -1942, -1138, -360, 392, 1117, 1812, 2479, 3115, 3722, 4297, 4842, 5357, 5841, 6296, 6721, 7118,
+    7488, 7830, 8148, 8441, 8712, 8961, 9191, 9403, 9599, 9781, 9951, 10111, 10263, 10408, 10550, 10690,
+    10830, 10973, 11120, 11273, 11434, 11606, 11789, 11985, 12196, 12424, 12669, 12933, 13217, 13521, 13847, 14194,
+    14563, 14955, 15369, 15805, 16262, 16741, 17240, 17759, 18296, 18850, 19420, 20003, 20599, 21206, 21820, 22441,
+    23066, 23692, 24317, 24939, 25554, 26160, 26755, 27336, 27899, 28443, 28964, 29460, 29928, 30365, 30770, 31139,
+    31470, 31762, 32011, 32217, 32378, 32491, 32556, 32571, 32536, 32449, 32310, 32118, 31874, 31577, 31228, 30826,
+    30374, 29871, 29318, 28718, 28071, 27379, 26644, 25867, 25052, 24201, 23315, 22398, 21452, 20479, 19484, 18469,
+    17436, 16389, 15330, 14264, 13193, 12119, 11047, 9978, 8916, 7864, 6824, 5798, 4790, 3801, 2834, 1890,
+    972, 81, -781, -1613, -2414, -3183, -3920, -4623, -5292, -5928, -6530, -7098, -7634, -8136, -8607, -9048,
+    -9458, -9840, -10195, -10524, -10830, -11113, -11376, -11620, -11847, -12060, -12261, -12451, -12633, -12808, -12980, -13149,
+    -13319, -13490, -13665, -13846, -14034, -14231, -14438, -14657, -14890, -15136, -15398, -15676, -15970, -16282, -16612, -16959,
+    -17324, -17707, -18107, -18524, -18957, -19406, -19870, -20347, -20836, -21337, -21846, -22364, -22888, -23416, -23946, -24476,
+    -25005, -25530, -26049, -26560, -27060, -27547, -28019, -28474, -28909, -29323, -29713, -30076, -30412, -30717, -30991, -31231,
+    -31435, -31603, -31732, -31821, -31870, -31877, -31841, -31762, -31639, -31471, -31259, -31002, -30701, -30355, -29965, -29532,
+    -29057, -28539, -27981, -27384, -26749, -26077, -25370, -24630, -23859, -23058, -22231, -21378, -20503, -19607, -18693, -17763,
+    -16820, -15867, -14905, -13938, -12967, -11997, -11028, -10063, -9105, -8156, -7218, -6294, -5385, -4494, -3622, -2771,
+  },
+  { // 2 harmonics
+    -7233, -6621, -6005, -5386, -4764, -4140, -3513, -2885, -2255, -1624, -992, -359, 275, 908, 1541, 2174,
+    2806, 3437, 4067, 4695, 5320, 5944, 6565, 7183, 7797, 8408, 9015, 9618, 10217, 10810, 11399, 11981,
+    12558, 13129, 13694, 14251, 14802, 15345, 15880, 16407, 16926, 17436, 17936, 18428, 18910, 19381, 19843, 20294,
+    20733, 21162, 21579, 21984, 22377, 22757, 23125, 23480, 23821, 24149, 24462, 24762, 25048, 25318, 25574, 25815,
+    26040, 26250, 26444, 26622, 26784, 26930, 27059, 27171, 27267, 27345, 27407, 27451, 27478, 27487, 27479, 27453,
+    27410, 27349, 27270, 27173, 27059, 26927, 26777, 26609, 26423, 26220, 25999, 25761, 25506, 25233, 24943, 24636,
+    24312, 23971, 23614, 23241, 22852, 22447, 22026, 21590, 21138, 20672, 20192, 19697, 19189, 18667, 18131, 17583,
+    17022, 16450, 15865, 15270, 14663, 14046, 13419, 12782, 12137, 11482, 10819, 10149, 9471, 8787, 8096, 7400,
+    6698, 5991, 5280, 4566, 3848, 3127, 2405, 1680, 954, 228, -498, -1224, -1949, -2673, -3394, -4113,
+    -4829, -5542, -6250, -6954, -7653, -8347, -9034, -9716, -10390, -11057, -11716, -12366, -13009, -13641, -14265, -14878,
+    -15481, -16074, -16655, -17225, -17783, -18328, -18862, -19382, -19889, -20383, -20863, -21329, -21781, -22219, -22641, -23049,
+    -23442, -23819, -24181, -24527, -24857, -25171, -25469, -25751, -26017, -26266, -26499, -26715, -26914, -27097, -27263, -27412,
+    -27545, -27661, -27760, -27843, -27909, -27958, -27991, -28007, -28007, -27990, -27958, -27909, -27844, -27763, -27667, -27555,
+    -27427, -27285, -27127, -26954, -26766, -26564, -26347, -26116, -25871, -25612, -25339, -25053, -24754, -24442, -24117, -23779,
+    -23429, -23067, -22694, -22308, -21911, -21503, -21084, -20655, -20215, -19765, -19306, -18836, -18357, -17870, -17373, -16868,
+    -16354, -15833, -15304, -14767, -14223, -13672, -13115, -12551, -11981, -11405, -10823, -10237, -9645, -9048, -8447, -7842,
+  },
+  { // 1 harmonics
+    -7476, -6816, -6153, -5486, -4816, -4144, -3469, -2793, -2115, -1436, -757, -77, 602, 1280, 1958, 2634,
+    3308, 3979, 4648, 5314, 5977, 6635, 7290, 7939, 8583, 9222, 9855, 10482, 11103, 11716, 12322, 12920,
+    13510, 14091, 14664, 15228, 15782, 16326, 16861, 17384, 17897, 18399, 18890, 19369, 19835, 20290, 20732, 21161,
+    21577, 21980, 22370, 22745, 23107, 23454, 23787, 24105, 24409, 24697, 24971, 25228, 25471, 25698, 25909, 26104,
+    26283, 26445, 26592, 26722, 26836, 26934, 27015, 27079, 27127, 27158, 27172, 27170, 27151, 27115, 27063, 26994,
+    26909, 26807, 26688, 26554, 26402, 26235, 26052, 25852, 25637, 25406, 25159, 24897, 24620, 24327, 24020, 23697,
+    23361, 23009, 22644, 22265, 21871, 21465, 21045, 20612, 20167, 19709, 19239, 18757, 18263, 17758, 17242, 16715,
+    16178, 15631, 15074, 14508, 13933, 13349, 12757, 12157, 11549, 10933, 10311, 9683, 9048, 8408, 7762, 7111,
+    6455, 5796, 5132, 4466, 3796, 3123, 2449, 1772, 1095, 416, -263, -943, -1622, -2300, -2978, -3654,
+    -4328, -5000, -5669, -6335, -6997, -7655, -8310, -8959, -9604, -10243, -10876, -11502, -12123, -12736, -13342, -13940,
+    -14530, -15112, -15684, -16248, -16802, -17347, -17881, -18405, -18917, -19419, -19910, -20389, -20856, -21310, -21752, -22181,
+    -22598, -23001, -23390, -23765, -24127, -24474, -24807, -25126, -25429, -25717, -25991, -26249, -26491, -26718, -26929, -27124,
+    -27303, -27466, -27612, -27743, -27856, -27954, -28035, -28099, -28147, -28178, -28192, -28190, -28171, -28135, -28083, -28014,
+    -27929, -27827, -27709, -27574, -27423, -27255, -27072, -26872, -26657, -26426, -26180, -25917, -25640, -25347, -25040, -24718,
+    -24381, -24029, -23664, -23285, -22892, -22485, -22065, -21632, -21187, -20729, -20259, -19777, -19283, -18778, -18262, -17736,
+    -17199, -16651, -16095, -15528, -14953, -14369, -13777, -13177, -12569, -11954, -11332, -10703, -10068, -9428, -8782, -8131,
+  },
+};
+
+extern const int16_t waveform_oboe_0002_mipmaps[WAVE_MIPMAPS][256] PROGMEM = {
+  { // 64 harmonics
+    651, 2892, 5282, 7880, 10699, 13585, 16338, 18922, 21425, 23819, 25904, 27572, 28960, 30229, 31314, 32042,
+    32427, 32650, 32767, 32642, 32185, 31489, 30648, 29595, 28223, 26570, 24738, 22716, 20398, 17758, 14899, 11928,
+    8884, 5812, 2811, -2, -2563, -4850, -6852, -8557, -9968, -11094, -11927, -12429, -12545, -12242, -11537, -10481,
+    -9123, -7519, -5770, -4010, -2333, -771, 653, 1892, 2923, 3798, 4593, 5322, 5953, 6493, 6991, 7467,
+    7868, 8124, 8220, 8170, 7962, 7532, 6810, 5777, 4467, 2927, 1183, -744, -2797, -4884, -6920, -8861,
+    -10678, -12330, -13765, -14967, -15963, -16783, -17409, -17795, -17925, -17851, -17626, -17227, -16586, -15722, -14769, -13838,
+    -12890, -11829, -10689, -9604, -8593, -7510, -6252, -4920, -3648, -2391, -1011, 449, 1781, 2888, 3902, 4944,
+    5925, 6692, 7273, 7805, 8292, 8579, 8588, 8421, 8181, 7823, 7273, 6595, 5942, 5371, 4818, 4237,
+    3671, 3166, 2689, 2171, 1602, 1036, 520, 57, -381, -799, -1161, -1436, -1645, -1842, -2035, -2161,
+    -2169, -2084, -1952, -1752, -1429, -1008, -581, -190, 211, 650, 1067, 1400, 1665, 1917, 2153, 2318,
+    2390, 2398, 2368, 2289, 2142, 1936, 1698, 1449, 1182, 863, 473, 44, -377, -787, -1237, -1749,
+    -2278, -2773, -3234, -3686, -4122, -4513, -4846, -5123, -5335, -5474, -5559, -5602, -5592, -5530, -5442, -5338,
+    -5183, -4958, -4707, -4476, -4245, -3986, -3748, -3609, -3547, -3453, -3291, -3161, -3163, -3268, -3367, -3400,
+    -3378, -3328, -3258, -3195, -3175, -3199, -3217, -3176, -3075, -2958, -2860, -2785, -2722, -2673, -2648, -2647,
+    -2663, -2713, -2821, -2989, -3179, -3367, -3566, -3797, -4055, -4323, -4605, -4920, -5270, -5649, -6061, -6507,
+    -6962, -7394, -7802, -8193, -8531, -8748, -8808, -8722, -8498, -8107, -7511, -6714, -5745, -4587, -3161, -1402,
+  },
+  { // 32 harmonics
+    589, 2830, 5301, 7953, 10719, 13528, 16303, 18974, 21479, 23770, 25810, 27577, 29066, 30283, 31241, 31957,
+    32447, 32717, 32767, 32591, 32183, 31538, 30656, 29540, 28192, 26608, 24781, 22698, 20354, 17756, 14934, 11945,
+    8866, 5789, 2809, 7, -2556, -4845, -6845, -8556, -9980, -11111, -11931, -12413, -12523, -12238, -11553, -10495,
+    -9119, -7513, -5776, -4014, -2317, -752, 645, 1863, 2913, 3819, 4609, 5309, 5937, 6505, 7016, 7463,
+    7833, 8101, 8239, 8209, 7977, 7509, 6777, 5769, 4486, 2944, 1181, -754, -2796, -4875, -6923, -8876,
+    -10685, -12315, -13746, -14970, -15985, -16791, -17387, -17771, -17940, -17893, -17635, -17175, -16536, -15746, -14841, -13857,
+    -12828, -11780, -10724, -9660, -8573, -7445, -6256, -4998, -3677, -2314, -941, 405, 1690, 2888, 3985, 4976,
+    5863, 6644, 7315, 7862, 8269, 8517, 8589, 8481, 8201, 7774, 7234, 6625, 5990, 5366, 4774, 4221,
+    3699, 3189, 2676, 2148, 1605, 1059, 530, 36, -407, -795, -1129, -1417, -1664, -1871, -2032, -2135,
+    -2164, -2108, -1960, -1724, -1408, -1032, -616, -183, 248, 659, 1040, 1383, 1683, 1938, 2144, 2296,
+    2387, 2415, 2379, 2281, 2132, 1939, 1711, 1453, 1164, 840, 480, 82, -350, -808, -1282, -1767,
+    -2255, -2742, -3224, -3692, -4130, -4524, -4859, -5126, -5325, -5463, -5548, -5591, -5594, -5555, -5470, -5336,
+    -5156, -4941, -4706, -4466, -4233, -4014, -3813, -3633, -3478, -3357, -3277, -3242, -3248, -3279, -3318, -3345,
+    -3348, -3327, -3289, -3247, -3212, -3185, -3161, -3127, -3074, -2997, -2902, -2801, -2712, -2649, -2620, -2628,
+    -2671, -2746, -2852, -2987, -3152, -3347, -3566, -3804, -4059, -4327, -4614, -4924, -5266, -5643, -6056, -6496,
+    -6951, -7403, -7830, -8210, -8515, -8719, -8799, -8733, -8504, -8102, -7517, -6741, -5759, -4554, -3104, -1392,
+  },
+  { // 16 harmonics
+    702, 2999, 5485, 8112, 10822, 13555, 16250, 18849, 21301, 23562, 25600, 27391, 28924, 30192, 31200, 31953,
+    32460, 32729, 32767, 32577, 32158, 31508, 30619, 29486, 28103, 26467, 24580, 22451, 20096, 17539, 14814, 11961,
+    9028, 6070, 3146, 317, -2355, -4810, -6994, -8858, -10362, -11477, -12188, -12492, -12400, -11940, -11147, -10073,
+    -8774, -7313, -5752, -4154, -2574, -1059, 356, 1646, 2799, 3813, 4696, 5459, 6116, 6682, 7164, 7562,
+    7871, 8075, 8151, 8070, 7803, 7321, 6602, 5630, 4406, 2939, 1255, -607, -2596, -4655, -6721, -8731,
+    -10626, -12355, -13877, -15161, -16190, -16959, -17475, -17749, -17804, -17662, -17349, -16887, -16300, -15603, -14813, -13941,
+    -12994, -11980, -10904, -9772, -8590, -7364, -6102, -4815, -3512, -2205, -906, 369, 1607, 2792, 3907, 4936,
+    5862, 6668, 7339, 7864, 8232, 8440, 8488, 8382, 8134, 7762, 7286, 6732, 6123, 5485, 4840, 4207,
+    3598, 3022, 2482, 1976, 1499, 1045, 606, 180, -237, -641, -1025, -1379, -1691, -1946, -2129, -2229,
+    -2239, -2154, -1977, -1716, -1384, -998, -576, -139, 294, 706, 1084, 1416, 1698, 1926, 2100, 2223,
+    2296, 2323, 2305, 2243, 2137, 1985, 1785, 1538, 1241, 897, 510, 84, -373, -852, -1344, -1840,
+    -2329, -2804, -3256, -3681, -4074, -4430, -4746, -5020, -5248, -5427, -5554, -5627, -5643, -5602, -5506, -5360,
+    -5170, -4945, -4698, -4441, -4188, -3951, -3742, -3568, -3435, -3343, -3290, -3270, -3275, -3295, -3321, -3342,
+    -3353, -3348, -3326, -3286, -3231, -3165, -3094, -3022, -2953, -2891, -2839, -2796, -2764, -2743, -2734, -2737,
+    -2756, -2793, -2854, -2942, -3065, -3224, -3424, -3666, -3948, -4268, -4619, -4996, -5391, -5797, -6206, -6610,
+    -7003, -7378, -7726, -8039, -8302, -8501, -8615, -8618, -8483, -8180, -7677, -6946, -5961, -4706, -3173, -1365,
+  },
+  { // 8 harmonics
+    1279, 3243, 5343, 7555, 9853, 12206, 14584, 16952, 19275, 21517, 23643, 25618, 27408, 28983, 30313, 31376,
+    32148, 32616, 32767, 32595, 32100, 31287, 30165, 28751, 27066, 25134, 22986, 20654, 18176, 15590, 12937, 10258,
+    7595, 4990, 2480, 105, -2103, -4111, -5893, -7427, -8695, -9685, -10390, -10809, -10946, -10809, -10413, -9777,
+    -8923, -7878, -6672, -5337, -3906, -2415, -898, 609, 2071, 3458, 4737, 5883, 6870, 7678, 8290, 8694,
+    8882, 8848, 8595, 8126, 7451, 6582, 5534, 4328, 2983, 1526, -20, -1627, -3269, -4917, -6545, -8127,
+    -9638, -11054, -12355, -13522, -14538, -15392, -16071, -16569, -16882, -17008, -16949, -16710, -16297, -15721, -14993, -14126,
+    -13135, -12038, -10851, -9592, -8280, -6933, -5569, -4207, -2862, -1552, -291, 908, 2032, 3071, 4015, 4858,
+    5593, 6217, 6728, 7124, 7406, 7577, 7641, 7601, 7465, 7239, 6932, 6551, 6107, 5609, 5067, 4491,
+    3893, 3281, 2668, 2061, 1471, 907, 376, -113, -555, -943, -1273, -1542, -1747, -1887, -1962, -1973,
+    -1922, -1812, -1649, -1436, -1181, -891, -573, -236, 112, 462, 805, 1133, 1437, 1709, 1943, 2131,
+    2268, 2351, 2375, 2338, 2241, 2083, 1866, 1594, 1271, 902, 494, 53, -413, -895, -1384, -1873,
+    -2353, -2815, -3253, -3658, -4027, -4352, -4631, -4861, -5040, -5167, -5245, -5274, -5259, -5202, -5109, -4986,
+    -4837, -4671, -4492, -4307, -4122, -3941, -3771, -3615, -3476, -3356, -3256, -3178, -3119, -3079, -3056, -3046,
+    -3047, -3054, -3065, -3074, -3080, -3078, -3067, -3046, -3012, -2968, -2913, -2851, -2785, -2719, -2658, -2608,
+    -2575, -2564, -2584, -2639, -2735, -2876, -3065, -3305, -3596, -3936, -4321, -4747, -5204, -5683, -6173, -6658,
+    -7125, -7555, -7932, -8235, -8447, -8550, -8524, -8353, -8023, -7520, -6834, -5957, -4887, -3623, -2168, -530,
+  },
+  { // 4 harmonics
+    10459, 11494, 12493, 13451, 14362, 15222, 16025, 16767, 17444, 18053, 18590, 19052, 19438, 19747, 19976, 20126,
+    20197, 20189, 20103, 19941, 19706, 19399, 19023, 18583, 18081, 17523, 16911, 16251, 15548, 14807, 14033, 13231,
+    12406, 11564, 10711, 9850, 8988, 8128, 7277, 6438, 5615, 4812, 4034, 3282, 2560, 1871, 1216, 597,
+    15, -528, -1032, -1496, -1922, -2310, -2660, -2974, -3253, -3499, -3714, -3900, -4059, -4194, -4308, -4402,
+    -4480, -4545, -4598, -4643, -4681, -4716, -4750, -4783, -4819, -4858, -4903, -4954, -5011, -5076, -5149, -5230,
+    -5318, -5413, -5514, -5620, -5730, -5843, -5956, -6068, -6177, -6281, -6378, -6465, -6540, -6601, -6645, -6671,
+    -6677, -6660, -6619, -6552, -6458, -6335, -6183, -6001, -5789, -5546, -5272, -4969, -4637, -4277, -3890, -3479,
+    -3045, -2590, -2118, -1631, -1131, -623, -109, 407, 921, 1430, 1931, 2418, 2890, 3342, 3770, 4172,
+    4544, 4883, 5187, 5453, 5678, 5861, 6001, 6096, 6145, 6148, 6104, 6015, 5880, 5701, 5479, 5216,
+    4914, 4575, 4203, 3801, 3371, 2918, 2444, 1955, 1454, 945, 433, -79, -586, -1083, -1568, -2035,
+    -2482, -2905, -3300, -3664, -3996, -4292, -4550, -4769, -4948, -5085, -5181, -5236, -5249, -5221, -5155, -5051,
+    -4911, -4739, -4536, -4305, -4050, -3775, -3483, -3178, -2865, -2546, -2228, -1913, -1607, -1313, -1035, -777,
+    -544, -338, -162, -20, 85, 153, 180, 166, 110, 10, -132, -317, -543, -810, -1115, -1457,
+    -1832, -2238, -2671, -3127, -3602, -4091, -4590, -5095, -5599, -6098, -6586, -7058, -7509, -7933, -8325, -8681,
+    -8995, -9262, -9480, -9642, -9747, -9790, -9769, -9682, -9527, -9303, -9008, -8643, -8207, -7702, -7130, -6491,
+    -5789, -5026, -4205, -3332, -2410, -1443, -438, 602, 1669, 2758, 3862, 4976, 6093, 7206, 8309, 9396,
+  },
+  { // 2 harmonics
+    9237, 9594, 9936, 10263, 10573, 10866, 11141, 11397, 11635, 11853, 12051, 12229, 12386, 12522, 12636, 12729,
+    12801, 12850, 12877, 12882, 12865, 12826, 12765, 12682, 12577, 12451, 12304, 12136, 11948, 11740, 11512, 11265,
+    11000, 10717, 10416, 10099, 9766, 9418, 9056, 8680, 8292, 7891, 7479, 7058, 6627, 6188, 5741, 5289,
+    4830, 4368, 3902, 3434, 2964, 2494, 2025, 1557, 1092, 630, 173, -278, -723, -1161, -1590, -2010,
+    -2421, -2820, -3208, -3583, -3945, -4294, -4628, -4947, -5250, -5537, -5807, -6060, -6295, -6512, -6711, -6891,
+    -7052, -7194, -7316, -7420, -7503, -7568, -7613, -7638, -7644, -7632, -7600, -7550, -7481, -7395, -7291, -7170,
+    -7032, -6878, -6709, -6525, -6326, -6114, -5888, -5650, -5401, -5141, -4871, -4592, -4304, -4009, -3707, -3400,
+    -3087, -2771, -2452, -2130, -1807, -1484, -1162, -841, -523, -207, 104, 410, 710, 1003, 1289, 1566,
+    1835, 2093, 2341, 2578, 2803, 3016, 3215, 3401, 3572, 3729, 3871, 3997, 4108, 4203, 4281, 4343,
+    4387, 4415, 4426, 4420, 4397, 4357, 4300, 4227, 4136, 4030, 3907, 3769, 3616, 3447, 3264, 3067,
+    2856, 2632, 2396, 2149, 1890, 1621, 1342, 1054, 758, 454, 145, -171, -491, -816, -1143, -1473,
+    -1804, -2135, -2466, -2795, -3122, -3446, -3765, -4080, -4388, -4690, -4983, -5268, -5544, -5809, -6063, -6306,
+    -6535, -6752, -6955, -7142, -7315, -7472, -7612, -7736, -7842, -7930, -8000, -8051, -8084, -8097, -8091, -8066,
+    -8021, -7956, -7872, -7767, -7643, -7500, -7337, -7155, -6954, -6734, -6496, -6240, -5967, -5676, -5369, -5046,
+    -4708, -4355, -3988, -3608, -3215, -2810, -2394, -1968, -1533, -1089, -638, -180, 284, 753, 1225, 1700,
+    2176, 2654, 3131, 3607, 4081, 4552, 5018, 5479, 5934, 6382, 6822, 7252, 7673, 8082, 8480, 8865,
+  },
+  { // 1 harmonics
+    4230, 4279, 4326, 4371, 4414, 4454, 4492, 4527, 4560, 4591, 4619, 4645, 4668, 4688, 4707, 4722,
+    4735, 4746, 4754, 4760, 4763, 4763, 4761, 4756, 4749, 4739, 4727, 4712, 4695, 4675, 4653, 4628,
+    4601, 4571, 4539, 4504, 4467, 4428, 4386, 4342, 4296, 4247, 4196, 4143, 4088, 4031, 3971, 3910,
+    3846, 3780, 3713, 3643, 3572, 3499, 3424, 3347, 3269, 3189, 3107, 3024, 2939, 2853, 2765, 2677,
+    2586, 2495, 2402, 2309, 2214, 2118, 2021, 1923, 1825, 1725, 1625, 1525, 1423, 1322, 1219, 1117,
+    1013, 910, 806, 703, 599, 495, 391, 287, 183, 80, -23, -126, -229, -331, -432, -533,
+    -633, -733, -832, -930, -1027, -1123, -1218, -1312, -1405, -1497, -1588, -1677, -1765, -1852, -1937, -2021,
+    -2103, -2184, -2263, -2340, -2415, -2489, -2561, -2631, -2700, -2766, -2830, -2892, -2953, -3011, -3067, -3120,
+    -3172, -3221, -3269, -3313, -3356, -3396, -3434, -3469, -3502, -3533, -3561, -3587, -3610, -3631, -3649, -3665,
+    -3678, -3688, -3696, -3702, -3705, -3705, -3703, -3699, -3691, -3682, -3669, -3655, -3637, -3617, -3595, -3570,
+    -3543, -3513, -3481, -3446, -3409, -3370, -3328, -3284, -3238, -3189, -3139, -3086, -3030, -2973, -2913, -2852,
+    -2788, -2723, -2655, -2586, -2514, -2441, -2366, -2290, -2211, -2131, -2049, -1966, -1881, -1795, -1708, -1619,
+    -1529, -1437, -1345, -1251, -1156, -1060, -963, -866, -767, -668, -568, -467, -366, -264, -162, -59,
+    44, 148, 251, 355, 459, 563, 667, 771, 874, 978, 1081, 1184, 1286, 1388, 1490, 1591,
+    1691, 1791, 1889, 1987, 2085, 2181, 2276, 2370, 2463, 2555, 2646, 2735, 2823, 2910, 2995, 3079,
+    3161, 3241, 3320, 3398, 3473, 3547, 3619, 3689, 3757, 3824, 3888, 3950, 4010, 4068, 4124, 4178,
+  },
+};
+
+extern const int16_t waveform_piano_0013_mipmaps[WAVE_MIPMAPS][256] PROGMEM = {
+  { // 64 harmonics
+    53, 1460, 3371, 5595, 7611, 8950, 9506, 9525, 9419, 9624, 10461, 12000, 14047, 16325, 18621, 20767,
+    22578, 23945, 24971, 25906, 26926, 28007, 29039, 29987, 30898, 31776, 32481, 32765, 32401, 31289, 29464, 27048,
+    24217, 21205, 18277, 15620, 13255, 11071, 8957, 6891, 4907, 3043, 1343, -83, -1055, -1423, -1167, -398,
+    720, 2036, 3378, 4532, 5325, 5745, 5964, 6204, 6590, 7127, 7779, 8519, 9328, 10192, 11115, 12106,
+    13123, 14050, 14739, 15082, 15047, 14670, 14039, 13275, 12499, 11780, 11095, 10356, 9470, 8425, 7305, 6253,
+    5380, 4705, 4158, 3644, 3102, 2527, 1944, 1383, 863, 388, -76, -619, -1394, -2575, -4276, -6467,
+    -8953, -11444, -13691, -15592, -17178, -18515, -19626, -20517, -21253, -21981, -22837, -23850, -24928, -25920, -26684, -27113,
+    -27172, -26940, -26588, -26315, -26281, -26572, -27169, -27930, -28626, -29041, -29035, -28555, -27610, -26248, -24502, -22344,
+    -19762, -16925, -14232, -12106, -10713, -9876, -9241, -8483, -7418, -6054, -4582, -3279, -2335, -1745, -1326, -828,
+    -38, 1109, 2473, 3766, 4721, 5242, 5424, 5484, 5657, 6071, 6650, 7151, 7365, 7308, 7226, 7397,
+    7946, 8808, 9807, 10762, 11551, 12130, 12543, 12888, 13220, 13442, 13311, 12582, 11179, 9238, 7031, 4879,
+    3076, 1779, 896, 126, -833, -2092, -3551, -5014, -6281, -7174, -7535, -7245, -6265, -4703, -2849, -1106,
+    164, 773, 735, 248, -327, -533, -18, 1264, 3017, 4763, 6060, 6644, 6465, 5670, 4541, 3393,
+    2426, 1648, 913, 59, -992, -2254, -3734, -5421, -7215, -8945, -10475, -11767, -12829, -13621, -14065, -14123,
+    -13892, -13612, -13577, -13991, -14852, -15965, -17041, -17780, -17938, -17433, -16432, -15305, -14437, -14044, -14119, -14434,
+    -14583, -14125, -12812, -10731, -8248, -5821, -3852, -2574, -1996, -1940, -2169, -2464, -2604, -2403, -1828, -992,
+  },
+  { // 32 harmonics
+    -72, 1641, 3677, 5747, 7522, 8748, 9356, 9501, 9506, 9753, 10538, 11975, 13973, 16289, 18629, 20750,
+    22521, 23932, 25065, 26036, 26954, 27894, 28891, 29936, 30972, 31892, 32544, 32750, 32349, 31242, 29430, 27023,
+    24222, 21262, 18358, 15654, 13203, 10979, 8908, 6916, 4964, 3078, 1350, -79, -1055, -1453, -1228, -438,
+    757, 2128, 3436, 4500, 5241, 5695, 5983, 6250, 6613, 7125, 7773, 8518, 9323, 10183, 11110, 12104,
+    13118, 14049, 14755, 15111, 15063, 14650, 13994, 13243, 12508, 11821, 11134, 10363, 9448, 8397, 7293, 6254,
+    5380, 4700, 4163, 3674, 3143, 2540, 1900, 1302, 809, 414, 26, -514, -1374, -2668, -4419, -6546,
+    -8899, -11296, -13571, -15593, -17288, -18634, -19667, -20474, -21183, -21929, -22810, -23844, -24954, -25983, -26753, -27140,
+    -27135, -26853, -26496, -26276, -26336, -26703, -27292, -27951, -28519, -28868, -28910, -28573, -27783, -26468, -24594, -22215,
+    -19510, -16760, -14277, -12297, -10889, -9933, -9177, -8351, -7290, -5998, -4630, -3399, -2454, -1800, -1292, -717,
+    97, 1186, 2432, 3625, 4568, 5169, 5480, 5651, 5843, 6144, 6532, 6911, 7185, 7330, 7425, 7615,
+    8033, 8728, 9634, 10606, 11489, 12189, 12697, 13056, 13293, 13360, 13125, 12423, 11148, 9337, 7192, 5022,
+    3130, 1692, 691, -69, -863, -1915, -3293, -4864, -6345, -7399, -7761, -7317, -6147, -4492, -2687, -1079,
+    61, 599, 576, 197, -214, -313, 155, 1260, 2841, 4547, 5951, 6698, 6632, 5846, 4631, 3342,
+    2254, 1454, 834, 164, -776, -2094, -3745, -5568, -7371, -9017, -10454, -11688, -12725, -13532, -14034, -14184,
+    -14028, -13746, -13612, -13883, -14667, -15841, -17068, -17928, -18100, -17513, -16392, -15165, -14273, -13967, -14191, -14602,
+    -14724, -14151, -12727, -10594, -8129, -5785, -3925, -2718, -2128, -1989, -2097, -2277, -2401, -2360, -2036, -1303,
+  },
+  { // 16 harmonics
+    1206, 2162, 3206, 4319, 5476, 6657, 7844, 9028, 10208, 11391, 12590, 13824, 15109, 16462, 17891, 19397,
+    20971, 22592, 24228, 25841, 27383, 28803, 30048, 31065, 31805, 32226, 32291, 31974, 31260, 30145, 28641, 26772,
+    24576, 22110, 19439, 16643, 13810, 11034, 8405, 6012, 3929, 2217, 913, 35, -427, -503, -245, 283,
+    1007, 1850, 2743, 3629, 4463, 5223, 5903, 6515, 7083, 7640, 8218, 8845, 9536, 10296, 11109, 11947,
+    12767, 13516, 14141, 14590, 14820, 14803, 14527, 14002, 13253, 12322, 11262, 10132, 8991, 7892, 6880, 5985,
+    5220, 4586, 4067, 3635, 3256, 2888, 2491, 2023, 1450, 743, -120, -1152, -2359, -3736, -5272, -6948,
+    -8737, -10605, -12512, -14414, -16265, -18017, -19628, -21061, -22289, -23296, -24085, -24669, -25079, -25357, -25551, -25713,
+    -25892, -26126, -26438, -26831, -27291, -27779, -28241, -28612, -28818, -28791, -28471, -27819, -26816, -25471, -23820, -21922,
+    -19853, -17702, -15558, -13504, -11610, -9922, -8464, -7233, -6204, -5336, -4573, -3858, -3138, -2371, -1531, -611,
+    375, 1398, 2419, 3390, 4267, 5013, 5605, 6037, 6321, 6486, 6576, 6644, 6742, 6921, 7219, 7660,
+    8247, 8966, 9780, 10638, 11477, 12230, 12827, 13209, 13324, 13138, 12636, 11819, 10710, 9345, 7775, 6063,
+    4273, 2475, 735, -885, -2332, -3564, -4548, -5266, -5712, -5893, -5826, -5538, -5062, -4438, -3705, -2904,
+    -2069, -1233, -417, 361, 1093, 1773, 2401, 2976, 3496, 3953, 4336, 4623, 4790, 4806, 4640, 4264,
+    3656, 2808, 1722, 418, -1066, -2681, -4364, -6048, -7664, -9152, -10463, -11563, -12442, -13105, -13581, -13911,
+    -14144, -14333, -14527, -14761, -15057, -15415, -15818, -16230, -16602, -16880, -17008, -16937, -16634, -16081, -15284, -14267,
+    -13073, -11758, -10388, -9025, -7727, -6540, -5494, -4597, -3843, -3207, -2652, -2136, -1613, -1043, -395, 352,
+  },
+  { // 8 harmonics
+    508, 1286, 2151, 3114, 4183, 5362, 6655, 8057, 9563, 11161, 12839, 14576, 16352, 18141, 19918, 21652,
+    23314, 24874, 26301, 27567, 28645, 29512, 30146, 30532, 30658, 30517, 30108, 29434, 28507, 27339, 25953, 24371,
+    22624, 20744, 18765, 16726, 14665, 12620, 10630, 8730, 6954, 5335, 3898, 2665, 1655, 880, 345, 53,
+    -2, 171, 557, 1137, 1888, 2782, 3793, 4888, 6036, 7207, 8368, 9492, 10550, 11518, 12375, 13104,
+    13692, 14128, 14408, 14530, 14497, 14316, 13996, 13547, 12986, 12327, 11586, 10780, 9926, 9039, 8132, 7219,
+    6308, 5408, 4524, 3658, 2809, 1975, 1151, 330, -497, -1337, -2202, -3101, -4044, -5038, -6091, -7208,
+    -8391, -9641, -10956, -12329, -13753, -15216, -16707, -18208, -19702, -21169, -22591, -23946, -25213, -26372, -27405, -28294,
+    -29023, -29582, -29958, -30147, -30144, -29951, -29569, -29007, -28274, -27383, -26348, -25188, -23921, -22568, -21147, -19681,
+    -18188, -16689, -15200, -13737, -12314, -10943, -9632, -8387, -7211, -6106, -5071, -4100, -3190, -2334, -1522, -748,
+    -2, 725, 1440, 2151, 2862, 3578, 4301, 5030, 5764, 6498, 7226, 7941, 8631, 9287, 9896, 10445,
+    10923, 11316, 11613, 11803, 11877, 11829, 11653, 11348, 10914, 10355, 9677, 8889, 8004, 7037, 6004, 4924,
+    3817, 2704, 1608, 549, -450, -1370, -2193, -2903, -3485, -3929, -4229, -4379, -4380, -4236, -3953, -3542,
+    -3017, -2396, -1697, -944, -159, 633, 1407, 2138, 2801, 3374, 3835, 4166, 4351, 4378, 4238, 3926,
+    3442, 2787, 1970, 1001, -105, -1330, -2654, -4053, -5504, -6979, -8453, -9899, -11290, -12603, -13815, -14905,
+    -15856, -16653, -17286, -17747, -18034, -18146, -18087, -17866, -17492, -16980, -16346, -15607, -14781, -13890, -12953, -11989,
+    -11016, -10051, -9108, -8199, -7334, -6519, -5755, -5043, -4378, -3755, -3163, -2590, -2023, -1446, -842, -196,
+  },
+  { // 4 harmonics
+    3561, 5132, 6697, 8248, 9774, 11266, 12714, 14109, 15444, 16709, 17897, 19001, 20016, 20934, 21752, 22466,
+    23072, 23569, 23954, 24228, 24391, 24444, 24389, 24231, 23971, 23616, 23170, 22640, 22033, 21355, 20615, 19821,
+    18981, 18104, 17199, 16275, 15341, 14406, 13479, 12568, 11682, 10829, 10015, 9248, 8533, 7876, 7282, 6754,
+    6297, 5911, 5600, 5362, 5198, 5107, 5087, 5135, 5247, 5419, 5646, 5922, 6240, 6594, 6975, 7378,
+    7792, 8210, 8623, 9023, 9400, 9747, 10055, 10316, 10522, 10666, 10741, 10740, 10660, 10494, 10238, 9890,
+    9447, 8907, 8270, 7536, 6706, 5783, 4769, 3668, 2486, 1228, -100, -1491, -2936, -4427, -5956, -7512,
+    -9086, -10668, -12247, -13813, -15355, -16863, -18326, -19735, -21078, -22348, -23534, -24629, -25625, -26515, -27292, -27950,
+    -28487, -28896, -29176, -29326, -29343, -29228, -28982, -28606, -28105, -27482, -26741, -25888, -24930, -23873, -22724, -21494,
+    -20189, -18821, -17397, -15928, -14425, -12897, -11355, -9809, -8269, -6745, -5246, -3782, -2361, -991, 319, 1564,
+    2736, 3830, 4842, 5768, 6604, 7347, 7997, 8553, 9015, 9384, 9661, 9849, 9952, 9972, 9914, 9784,
+    9586, 9326, 9011, 8648, 8242, 7800, 7330, 6838, 6331, 5816, 5299, 4785, 4282, 3793, 3325, 2881,
+    2466, 2082, 1732, 1419, 1143, 906, 707, 547, 424, 336, 281, 257, 260, 287, 334, 395,
+    467, 544, 622, 696, 759, 808, 838, 843, 819, 762, 667, 533, 355, 132, -139, -459,
+    -829, -1248, -1715, -2230, -2791, -3395, -4038, -4717, -5428, -6165, -6923, -7695, -8476, -9258, -10036, -10800,
+    -11544, -12261, -12942, -13581, -14169, -14700, -15168, -15564, -15884, -16122, -16272, -16330, -16293, -16157, -15919, -15580,
+    -15136, -14589, -13940, -13190, -12341, -11398, -10364, -9244, -8043, -6769, -5428, -4028, -2577, -1083, 444, 1996,
+  },
+  { // 2 harmonics
+    888, 1593, 2308, 3030, 3758, 4490, 5225, 5961, 6697, 7430, 8160, 8884, 9601, 10309, 11007, 11693,
+    12365, 13021, 13661, 14283, 14885, 15465, 16023, 16557, 17066, 17548, 18003, 18428, 18824, 19188, 19521, 19821,
+    20087, 20319, 20516, 20677, 20803, 20891, 20943, 20958, 20935, 20874, 20777, 20641, 20469, 20259, 20013, 19730,
+    19411, 19057, 18668, 18245, 17789, 17301, 16780, 16230, 15649, 15041, 14405, 13744, 13057, 12348, 11617, 10865,
+    10094, 9306, 8502, 7684, 6854, 6013, 5162, 4304, 3441, 2573, 1703, 833, -36, -902, -1764, -2619,
+    -3466, -4303, -5128, -5940, -6738, -7520, -8283, -9028, -9752, -10453, -11132, -11785, -12413, -13014, -13586, -14129,
+    -14643, -15125, -15575, -15993, -16378, -16729, -17045, -17327, -17573, -17785, -17960, -18100, -18204, -18273, -18306, -18304,
+    -18267, -18195, -18089, -17949, -17776, -17571, -17334, -17067, -16769, -16443, -16089, -15707, -15301, -14869, -14414, -13937,
+    -13440, -12923, -12388, -11837, -11271, -10692, -10100, -9499, -8888, -8270, -7647, -7019, -6390, -5759, -5129, -4502,
+    -3878, -3260, -2649, -2046, -1453, -872, -304, 251, 790, 1312, 1816, 2301, 2766, 3210, 3631, 4029,
+    4403, 4752, 5075, 5372, 5642, 5885, 6100, 6287, 6445, 6574, 6675, 6746, 6789, 6803, 6788, 6744,
+    6673, 6574, 6447, 6294, 6115, 5910, 5681, 5428, 5152, 4854, 4535, 4196, 3838, 3462, 3070, 2662,
+    2241, 1807, 1362, 907, 443, -27, -504, -984, -1466, -1950, -2433, -2914, -3392, -3865, -4331, -4789,
+    -5238, -5676, -6101, -6513, -6910, -7290, -7653, -7997, -8321, -8624, -8904, -9161, -9394, -9601, -9783, -9937,
+    -10064, -10163, -10233, -10273, -10284, -10265, -10215, -10134, -10023, -9881, -9708, -9504, -9270, -9006, -8711, -8387,
+    -8034, -7653, -7244, -6807, -6345, -5857, -5344, -4808, -4249, -3668, -3068, -2448, -1811, -1157, -489, 194,
+  },
+  { // 1 harmonics
+    7110, 7204, 7294, 7379, 7460, 7537, 7608, 7676, 7738, 7796, 7849, 7898, 7941, 7980, 8014, 8043,
+    8067, 8086, 8101, 8110, 8115, 8115, 8109, 8099, 8084, 8064, 8039, 8009, 7975, 7935, 7891, 7842,
+    7788, 7730, 7666, 7598, 7526, 7449, 7367, 7281, 7191, 7096, 6997, 6893, 6786, 6674, 6558, 6439,
+    6315, 6188, 6056, 5921, 5783, 5641, 5495, 5347, 5195, 5039, 4881, 4720, 4556, 4389, 4219, 4047,
+    3872, 3695, 3516, 3335, 3151, 2966, 2779, 2590, 2399, 2207, 2014, 1819, 1624, 1427, 1229, 1031,
+    832, 632, 432, 232, 32, -169, -369, -570, -769, -969, -1168, -1366, -1564, -1760, -1956, -2150,
+    -2343, -2535, -2725, -2914, -3101, -3286, -3469, -3650, -3829, -4006, -4180, -4352, -4521, -4688, -4852, -5012,
+    -5170, -5325, -5477, -5625, -5770, -5911, -6049, -6184, -6315, -6441, -6565, -6684, -6799, -6910, -7017, -7120,
+    -7218, -7312, -7402, -7488, -7569, -7645, -7717, -7784, -7847, -7904, -7958, -8006, -8050, -8088, -8122, -8151,
+    -8176, -8195, -8209, -8219, -8223, -8223, -8218, -8207, -8192, -8172, -8147, -8118, -8083, -8044, -7999, -7950,
+    -7896, -7838, -7775, -7707, -7634, -7557, -7476, -7390, -7299, -7204, -7105, -7002, -6894, -6783, -6667, -6547,
+    -6423, -6296, -6165, -6030, -5891, -5749, -5604, -5455, -5303, -5148, -4989, -4828, -4664, -4497, -4328, -4155,
+    -3981, -3804, -3625, -3443, -3260, -3074, -2887, -2698, -2508, -2316, -2122, -1928, -1732, -1535, -1338, -1139,
+    -940, -741, -541, -340, -140, 60, 261, 461, 661, 861, 1060, 1258, 1455, 1652, 1847, 2042,
+    2235, 2427, 2617, 2806, 2993, 3178, 3361, 3542, 3721, 3898, 4072, 4244, 4413, 4579, 4743, 4904,
+    5062, 5217, 5368, 5517, 5662, 5803, 5941, 6075, 6206, 6333, 6456, 6575, 6690, 6802, 6909, 7011,
+  },
+};
+
+extern const int16_t waveform_violin_0003_mipmaps[WAVE_MIPMAPS][256] PROGMEM = {
+  { // 64 harmonics
+    607, 3495, 6682, 9991, 13222, 16238, 19065, 21776, 24305, 26510, 28391, 30059, 31477, 32411, 32728, 32566,
+    32105, 31294, 29979, 28195, 26162, 24039, 21854, 19640, 17486, 15419, 13404, 11495, 9868, 8674, 7926, 7553,
+    7465, 7516, 7496, 7238, 6697, 5900, 4875, 3657, 2287, 780, -875, -2630, -4360, -5958, -7409, -8770,
+    -10143, -11688, -13545, -15680, -17862, -19867, -21627, -23127, -24245, -24817, -24837, -24471, -23887, -23163, -22378, -21678,
+    -21197, -20960, -20911, -21003, -21209, -21481, -21758, -22005, -22213, -22346, -22304, -21942, -21146, -19892, -18255, -16379,
+    -14418, -12469, -10539, -8579, -6574, -4608, -2820, -1330, -226, 412, 544, 271, -179, -623, -1058, -1566,
+    -2121, -2570, -2778, -2722, -2418, -1843, -1000, 4, 1014, 1968, 2927, 3979, 5145, 6392, 7683, 8999,
+    10296, 11499, 12518, 13290, 13791, 14027, 14030, 13866, 13654, 13554, 13715, 14214, 15044, 16154, 17468, 18892,
+    20319, 21668, 22896, 23972, 24844, 25446, 25732, 25694, 25359, 24811, 24168, 23526, 22911, 22305, 21706, 21133,
+    20585, 20030, 19452, 18852, 18201, 17433, 16500, 15417, 14226, 12963, 11690, 10512, 9501, 8622, 7768, 6860,
+    5857, 4707, 3365, 1848, 227, -1482, -3347, -5416, -7630, -9863, -12016, -14026, -15842, -17441, -18865, -20165,
+    -21316, -22231, -22854, -23216, -23385, -23408, -23335, -23234, -23145, -23026, -22790, -22414, -21967, -21529, -21100, -20610,
+    -20001, -19274, -18458, -17578, -16661, -15759, -14955, -14304, -13775, -13261, -12656, -11945, -11209, -10543, -9969, -9423,
+    -8806, -8057, -7194, -6310, -5521, -4891, -4421, -4072, -3791, -3486, -3006, -2223, -1157, -23, 873, 1301,
+    1209, 688, -174, -1367, -2880, -4533, -5959, -6820, -7014, -6637, -5782, -4471, -2807, -1070, 420, 1528,
+    2333, 2955, 3402, 3591, 3453, 2997, 2300, 1454, 534, -434, -1463, -2528, -3440, -3821, -3298, -1757,
+  },
+  { // 32 harmonics
+    594, 3394, 6566, 9887, 13172, 16292, 19183, 21827, 24232, 26409, 28349, 30019, 31359, 32297, 32767, 32728,
+    32180, 31165, 29760, 28057, 26144, 24088, 21936, 19724, 17493, 15303, 13240, 11404, 9888, 8755, 8013, 7615,
+    7461, 7421, 7358, 7151, 6713, 5996, 4993, 3730, 2259, 650, -1020, -2681, -4285, -5810, -7272, -8722,
+    -10226, -11854, -13650, -15611, -17676, -19729, -21614, -23168, -24261, -24822, -24862, -24474, -23804, -23023, -22279, -21676,
+    -21258, -21022, -20938, -20976, -21116, -21348, -21656, -21998, -22297, -22446, -22331, -21862, -20998, -19758, -18208, -16437,
+    -14529, -12545, -10520, -8480, -6467, -4547, -2816, -1379, -323, 306, 520, 383, -9, -549, -1143, -1714,
+    -2200, -2550, -2716, -2657, -2351, -1797, -1030, -106, 909, 1959, 3015, 4081, 5183, 6355, 7609, 8928,
+    10251, 11491, 12549, 13342, 13825, 14008, 13955, 13776, 13601, 13561, 13758, 14251, 15052, 16125, 17407, 18813,
+    20256, 21652, 22926, 24010, 24847, 25398, 25645, 25601, 25304, 24816, 24208, 23547, 22882, 22245, 21646, 21083,
+    20545, 20014, 19468, 18875, 18197, 17397, 16453, 15368, 14176, 12934, 11714, 10572, 9535, 8595, 7705, 6800,
+    5814, 4694, 3406, 1940, 299, -1505, -3450, -5510, -7642, -9796, -11911, -13928, -15797, -17482, -18963, -20229,
+    -21279, -22111, -22729, -23144, -23373, -23449, -23406, -23282, -23104, -22889, -22640, -22353, -22015, -21616, -21142, -20582,
+    -19932, -19193, -18379, -17519, -16653, -15819, -15048, -14348, -13711, -13110, -12519, -11919, -11303, -10674, -10034, -9375,
+    -8682, -7941, -7155, -6354, -5595, -4943, -4436, -4066, -3763, -3414, -2903, -2165, -1222, -194, 721, 1309,
+    1398, 911, -111, -1522, -3106, -4627, -5871, -6673, -6931, -6615, -5760, -4468, -2894, -1231, 328, 1624,
+    2564, 3131, 3376, 3379, 3209, 2892, 2405, 1701, 750, -413, -1664, -2794, -3551, -3698, -3069, -1616,
+  },
+  { // 16 harmonics
+    1191, 3668, 6488, 9535, 12689, 15839, 18885, 21747, 24359, 26671, 28646, 30256, 31477, 32291, 32682, 32640,
+    32163, 31259, 29953, 28286, 26318, 24126, 21802, 19444, 17152, 15017, 13116, 11500, 10197, 9202, 8484, 7988,
+    7643, 7370, 7087, 6725, 6225, 5550, 4682, 3623, 2387, 1002, -501, -2094, -3751, -5456, -7197, -8970,
+    -10771, -12592, -14420, -16230, -17984, -19635, -21126, -22401, -23408, -24105, -24473, -24516, -24264, -23775, -23125, -22406,
+    -21712, -21131, -20731, -20556, -20613, -20878, -21290, -21762, -22190, -22464, -22480, -22154, -21431, -20291, -18751, -16866,
+    -14721, -12423, -10090, -7838, -5772, -3977, -2510, -1400, -646, -221, -80, -165, -410, -753, -1135, -1505,
+    -1823, -2058, -2183, -2180, -2030, -1720, -1235, -569, 285, 1319, 2518, 3853, 5281, 6748, 8193, 9551,
+    10761, 11775, 12561, 13108, 13432, 13572, 13589, 13558, 13561, 13678, 13976, 14502, 15275, 16288, 17501, 18854,
+    20265, 21647, 22911, 23983, 24803, 25339, 25582, 25551, 25285, 24837, 24266, 23631, 22980, 22347, 21750, 21188,
+    20644, 20092, 19502, 18843, 18093, 17241, 16289, 15252, 14155, 13027, 11899, 10797, 9733, 8709, 7711, 6711,
+    5672, 4550, 3306, 1904, 323, -1441, -3373, -5442, -7598, -9783, -11934, -13986, -15884, -17584, -19058, -20291,
+    -21287, -22058, -22630, -23030, -23286, -23424, -23465, -23421, -23300, -23104, -22832, -22483, -22057, -21556, -20989, -20365,
+    -19696, -18997, -18281, -17556, -16831, -16108, -15388, -14668, -13945, -13219, -12490, -11763, -11045, -10346, -9675, -9040,
+    -8442, -7878, -7339, -6806, -6260, -5678, -5042, -4342, -3577, -2765, -1939, -1144, -439, 114, 457, 540,
+    337, -153, -904, -1854, -2918, -3989, -4949, -5686, -6099, -6120, -5714, -4892, -3708, -2258, -669, 916,
+    2345, 3484, 4223, 4495, 4281, 3612, 2569, 1273, -124, -1458, -2567, -3304, -3554, -3241, -2331, -837,
+  },
+  { // 8 harmonics
+    6899, 8727, 10639, 12605, 14592, 16568, 18496, 20343, 22076, 23663, 25075, 26289, 27283, 28040, 28550, 28806,
+    28809, 28561, 28073, 27358, 26436, 25326, 24055, 22648, 21132, 19537, 17889, 16215, 14540, 12884, 11268, 9705,
+    8208, 6784, 5437, 4166, 2968, 1835, 760, -272, -1271, -2253, -3230, -4217, -5226, -6266, -7346, -8470,
+    -9642, -10859, -12118, -13410, -14724, -16048, -17365, -18657, -19904, -21087, -22184, -23178, -24048, -24778, -25353, -25762,
+    -25996, -26049, -25921, -25613, -25131, -24485, -23685, -22749, -21692, -20536, -19301, -18008, -16680, -15338, -14003, -12694,
+    -11427, -10219, -9082, -8024, -7053, -6173, -5384, -4685, -4071, -3535, -3069, -2663, -2306, -1985, -1689, -1405,
+    -1122, -828, -514, -170, 209, 630, 1096, 1611, 2175, 2787, 3446, 4148, 4891, 5669, 6476, 7309,
+    8161, 9026, 9899, 10776, 11651, 12520, 13379, 14224, 15052, 15860, 16646, 17406, 18137, 18838, 19505, 20135,
+    20725, 21271, 21770, 22219, 22612, 22946, 23217, 23420, 23553, 23611, 23592, 23492, 23311, 23045, 22696, 22262,
+    21745, 21146, 20466, 19709, 18877, 17973, 17002, 15966, 14871, 13719, 12515, 11261, 9962, 8621, 7241, 5824,
+    4375, 2896, 1390, -139, -1686, -3248, -4819, -6393, -7963, -9522, -11059, -12567, -14034, -15450, -16802, -18080,
+    -19271, -20363, -21345, -22207, -22939, -23534, -23985, -24288, -24441, -24443, -24298, -24010, -23586, -23035, -22371, -21604,
+    -20751, -19828, -18852, -17839, -16807, -15772, -14751, -13757, -12804, -11901, -11058, -10280, -9571, -8932, -8361, -7855,
+    -7409, -7014, -6664, -6347, -6055, -5778, -5506, -5231, -4945, -4643, -4322, -3979, -3615, -3232, -2836, -2432,
+    -2030, -1638, -1266, -926, -626, -379, -191, -70, -20, -44, -142, -308, -538, -820, -1143, -1489,
+    -1841, -2179, -2481, -2725, -2888, -2948, -2884, -2678, -2314, -1780, -1066, -169, 913, 2172, 3601, 5183,
+  },
+  { // 4 harmonics
+    10079, 11229, 12381, 13527, 14657, 15763, 16837, 17869, 18850, 19773, 20628, 21409, 22107, 22715, 23227, 23638,
+    23941, 24134, 24211, 24171, 24010, 23729, 23326, 22802, 22159, 21398, 20523, 19538, 18448, 17258, 15974, 14603,
+    13153, 11631, 10047, 8410, 6727, 5011, 3269, 1512, -249, -2006, -3748, -5464, -7147, -8787, -10374, -11901,
+    -13360, -14744, -16046, -17261, -18382, -19405, -20328, -21145, -21857, -22460, -22955, -23341, -23620, -23792, -23860, -23828,
+    -23698, -23474, -23162, -22767, -22293, -21746, -21134, -20462, -19736, -18964, -18151, -17305, -16432, -15538, -14630, -13713,
+    -12792, -11874, -10962, -10061, -9175, -8308, -7462, -6639, -5841, -5070, -4327, -3611, -2922, -2260, -1624, -1012,
+    -422, 149, 702, 1241, 1768, 2286, 2799, 3310, 3822, 4339, 4862, 5395, 5940, 6500, 7076, 7670,
+    8283, 8916, 9569, 10242, 10934, 11643, 12369, 13109, 13860, 14619, 15382, 16145, 16905, 17655, 18391, 19107,
+    19798, 20459, 21082, 21662, 22193, 22669, 23085, 23434, 23712, 23913, 24033, 24067, 24012, 23864, 23621, 23281,
+    22841, 22302, 21664, 20926, 20091, 19160, 18136, 17023, 15825, 14546, 13193, 11772, 10288, 8750, 7165, 5541,
+    3887, 2211, 523, -1168, -2854, -4524, -6171, -7784, -9354, -10874, -12335, -13729, -15049, -16288, -17440, -18500,
+    -19462, -20322, -21077, -21724, -22262, -22690, -23006, -23213, -23311, -23302, -23191, -22979, -22672, -22274, -21792, -21232,
+    -20599, -19902, -19148, -18344, -17498, -16619, -15714, -14793, -13862, -12931, -12005, -11094, -10204, -9341, -8512, -7723,
+    -6977, -6280, -5636, -5047, -4516, -4043, -3631, -3279, -2987, -2752, -2574, -2449, -2373, -2344, -2356, -2404,
+    -2483, -2587, -2709, -2844, -2984, -3123, -3255, -3371, -3467, -3534, -3568, -3561, -3510, -3408, -3251, -3036,
+    -2758, -2416, -2007, -1530, -984, -370, 312, 1059, 1869, 2739, 3664, 4641, 5663, 6724, 7819, 8940,
+  },
+  { // 2 harmonics
+    17352, 17605, 17813, 17976, 18094, 18167, 18194, 18175, 18110, 18001, 17846, 17647, 17403, 17116, 16787, 16416,
+    16004, 15553, 15063, 14535, 13972, 13374, 12743, 12080, 11388, 10668, 9922, 9151, 8358, 7544, 6712, 5864,
+    5001, 4127, 3242, 2350, 1453, 552, -350, -1250, -2147, -3038, -3921, -4794, -5654, -6500, -7330, -8140,
+    -8930, -9698, -10440, -11157, -11845, -12503, -13129, -13722, -14281, -14803, -15289, -15735, -16142, -16508, -16832, -17113,
+    -17351, -17546, -17696, -17801, -17860, -17875, -17844, -17768, -17646, -17479, -17268, -17013, -16714, -16372, -15988, -15562,
+    -15097, -14592, -14050, -13470, -12856, -12207, -11527, -10815, -10075, -9308, -8515, -7699, -6861, -6004, -5129, -4239,
+    -3336, -2422, -1499, -569, 365, 1300, 2236, 3169, 4098, 5019, 5932, 6832, 7720, 8591, 9444, 10278,
+    11089, 11877, 12638, 13372, 14076, 14748, 15388, 15993, 16562, 17094, 17586, 18039, 18450, 18819, 19145, 19427,
+    19664, 19856, 20002, 20102, 20155, 20161, 20121, 20033, 19899, 19719, 19492, 19220, 18903, 18542, 18137, 17690,
+    17201, 16672, 16103, 15497, 14854, 14175, 13464, 12720, 11947, 11145, 10316, 9463, 8587, 7691, 6776, 5845,
+    4900, 3943, 2976, 2001, 1022, 39, -944, -1926, -2904, -3875, -4838, -5790, -6730, -7654, -8561, -9448,
+    -10314, -11156, -11973, -12763, -13523, -14252, -14949, -15611, -16238, -16827, -17378, -17889, -18359, -18786, -19171, -19511,
+    -19807, -20057, -20262, -20419, -20531, -20595, -20612, -20582, -20505, -20382, -20212, -19996, -19734, -19428, -19078, -18685,
+    -18250, -17774, -17258, -16703, -16111, -15484, -14822, -14127, -13401, -12647, -11865, -11057, -10226, -9373, -8501, -7612,
+    -6707, -5789, -4861, -3924, -2981, -2033, -1084, -135, 811, 1752, 2686, 3610, 4523, 5422, 6304, 7169,
+    8013, 8836, 9634, 10406, 11150, 11865, 12548, 13199, 13815, 14396, 14939, 15443, 15908, 16333, 16715, 17055,
+  },
+  { // 1 harmonics
+    -1192, -1161, -1130, -1098, -1066, -1033, -999, -965, -930, -895, -859, -822, -785, -748, -710, -672,
+    -634, -595, -556, -516, -476, -436, -396, -355, -315, -274, -233, -192, -150, -109, -68, -26,
+    15, 56, 98, 139, 180, 221, 262, 303, 343, 383, 423, 463, 502, 541, 580, 618,
+    656, 694, 731, 768, 804, 839, 875, 909, 943, 977, 1009, 1041, 1073, 1104, 1134, 1163,
+    1192, 1220, 1247, 1274, 1300, 1325, 1349, 1372, 1394, 1416, 1436, 1456, 1475, 1493, 1510, 1526,
+    1541, 1555, 1569, 1581, 1592, 1603, 1612, 1620, 1628, 1634, 1639, 1644, 1647, 1649, 1651, 1651,
+    1650, 1648, 1646, 1642, 1637, 1631, 1625, 1617, 1608, 1598, 1587, 1576, 1563, 1549, 1535, 1519,
+    1503, 1485, 1467, 1447, 1427, 1406, 1384, 1362, 1338, 1314, 1288, 1262, 1235, 1208, 1180, 1150,
+    1121, 1090, 1059, 1027, 995, 962, 928, 894, 859, 824, 788, 751, 715, 677, 640, 601,
+    563, 524, 485, 445, 405, 365, 325, 285, 244, 203, 162, 121, 79, 38, -3, -45,
+    -86, -127, -169, -210, -251, -292, -333, -373, -414, -454, -494, -534, -573, -612, -651, -689,
+    -727, -765, -802, -838, -875, -910, -945, -980, -1014, -1047, -1080, -1112, -1144, -1175, -1205, -1234,
+    -1263, -1291, -1318, -1345, -1371, -1395, -1419, -1443, -1465, -1487, -1507, -1527, -1546, -1564, -1581, -1597,
+    -1612, -1626, -1640, -1652, -1663, -1674, -1683, -1691, -1699, -1705, -1710, -1715, -1718, -1720, -1722, -1722,
+    -1721, -1719, -1717, -1713, -1708, -1702, -1695, -1688, -1679, -1669, -1658, -1647, -1634, -1620, -1605, -1590,
+    -1573, -1556, -1538, -1518, -1498, -1477, -1455, -1432, -1409, -1384, -1359, -1333, -1306, -1279, -1250, -1221,
+  },
+};
+
+#endif // BANDLIMITED_WAVES
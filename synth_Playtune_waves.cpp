@@ -285,7 +285,7 @@ extern const int16_t waveform_violin_0003[256] PROGMEM = {
 2316, 1527, 458, -472, -1359, -2541, -3555, -3719, -3265, -1866
 };
 
-#if DO_PERCUSSION
+#if DO_PERCUSSION && !COMPRESSED_PERCUSSION // (else see synth_Playtune_adpcm.cpp)
 //*******************************************************************************************************
 //  percussion sample wave tables
 //
@@ -948,12 +948,12 @@ extern const int16_t waveform_steel_bell_c6[] PROGMEM = {
 -3722, -6581
 };
 
-extern const uint16_t drum_waveform_size[] = {
+extern const uint32_t drum_waveform_size[] = {
   sizeof(waveform_base_drum_04) / 2, sizeof(waveform_snare_drum_1) / 2,
   sizeof(waveform_mid_high_tom) / 2, sizeof(waveform_cymbal_2) / 2,
   sizeof(waveform_hi_bongo) / 2, sizeof(waveform_steel_bell_c6) / 2
 };
-#endif // DO_PERCUSSION
+#endif // DO_PERCUSSION && !COMPRESSED_PERCUSSION
 
 // end of synth_Playtune_waves.c
 